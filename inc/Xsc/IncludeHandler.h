@@ -48,6 +48,18 @@ class XSC_EXPORT IncludeHandler
         //! Returns the constant list of search paths.
         const std::vector<std::string>& GetSearchPaths() const;
 
+        /**
+        \brief Returns the resolved filename of the file that was opened by the most recent call to "Include".
+        \remarks This is used to record the include dependencies (see Reflection::ReflectionData::includeFiles).
+        If this is empty, the include filename is used as it was written in the '#include'-directive.
+        */
+        const std::string& GetResolvedFilename() const;
+
+    protected:
+
+        //! Sets the resolved filename for the most recent call to "Include". Custom include handlers should call this if the filename was resolved.
+        void SetResolvedFilename(const std::string& filename);
+
     private:
 
         // PImple idiom
@@ -11,6 +11,8 @@
 
 #include "Export.h"
 #include <limits>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <ostream>
@@ -238,6 +240,9 @@ struct Resource
 
     //! Zero-based binding slot number. If this is -1, the binding slot was not specified. By default -1.
     int             slot        = -1;
+
+    //! Zero-based descriptor set number (i.e. the register space). Only used if the binding slot was specified. By default 0.
+    int             set         = 0;
 };
 
 /**
@@ -303,6 +308,31 @@ struct Record
     unsigned int        padding         = 0;
 };
 
+/**
+\brief Range of a constant buffer that has been merged into another constant buffer.
+\see ConstantBuffer::mergedBuffers
+*/
+struct ConstantBufferRange
+{
+    //! Name of the original constant buffer.
+    std::string     name;
+
+    //! Zero-based binding slot number of the original constant buffer. If this is -1, the binding slot was not specified. By default -1.
+    int             slot        = -1;
+
+    //! Offset (in bytes) of the original constant buffer within the merged constant buffer. This is always a multiple of 16. By default 0.
+    unsigned int    offset      = 0;
+
+    //! Size (in bytes) of the original constant buffer with a 16-byte alignment. By default 0.
+    unsigned int    size        = 0;
+
+    //! Index of the first field of the original constant buffer within the fields of the merged constant buffer. By default 0.
+    std::size_t     firstField  = 0;
+
+    //! Number of fields of the original constant buffer. By default 0.
+    std::size_t     numFields   = 0;
+};
+
 /**
 \brief Constant buffer reflection structure.
 \see ReflectionData::constantBuffers
@@ -310,25 +340,38 @@ struct Record
 struct ConstantBuffer
 {
     //! Specifies whether this constant buffer is referenced in the output shader unit. By default false.
-    bool                referenced  = false;
+    bool                                referenced   = false;
 
     //! Resource type. By default ResourceType::Undefined.
-    ResourceType        type        = ResourceType::Undefined;
+    ResourceType                        type         = ResourceType::Undefined;
 
     //! Name of the constant buffer.
-    std::string         name;
+    std::string                         name;
 
     //! Zero-based binding slot number. If this is -1, the binding slot was not specified. By default -1.
-    int                 slot        = -1;
+    int                                 slot         = -1;
+
+    //! Zero-based descriptor set number (i.e. the register space). Only used if the binding slot was specified. By default 0.
+    int                                 set          = 0;
+
+    //! Specifies whether this constant buffer is mapped to a push constant block (only for VKSL output). By default false.
+    bool                                pushConstant = false;
 
     //! Collection of all fields within this constant buffer.
-    std::vector<Field>  fields;
+    std::vector<Field>                  fields;
 
     //! Size (in bytes) of the constant buffer with a 16-byte alignment. If this is 0xFFFFFFFF, the buffer size could not be determined. By default 0.
-    unsigned int        size        = 0;
+    unsigned int                        size         = 0;
 
     //! Size (in bytes) of the padding that is added to the constant buffer. By default 0.
-    unsigned int        padding     = 0;
+    unsigned int                        padding      = 0;
+
+    /**
+    \brief Ranges of all constant buffers that have been merged into this constant buffer.
+    \remarks If this container is empty, the constant buffer has not been merged.
+    \see BufferMerging
+    */
+    std::vector<ConstantBufferRange>    mergedBuffers;
 };
 
 /**
@@ -346,6 +389,9 @@ struct SamplerState
     //! Zero-based binding slot number. If this is -1, the binding slot was not specified. By default -1.
     int             slot        = -1;
 
+    //! Zero-based descriptor set number (i.e. the register space). Only used if the binding slot was specified. By default 0.
+    int             set         = 0;
+
     //! Specifies whether this record is referenced in the output shader unit. By default false.
     bool            referenced  = false;
 };
@@ -366,6 +412,28 @@ struct StaticSamplerState
     SamplerStateDesc    desc;
 };
 
+/**
+\brief Vulkan specialization constant reflection structure.
+\see ReflectionData::specConstants
+*/
+struct SpecConstant
+{
+    //! Specifies whether this constant is referenced in the output shader unit. By default false.
+    bool        referenced      = false;
+
+    //! Name of the specialization constant.
+    std::string name;
+
+    //! Scalar type of the specialization constant. By default FieldType::Undefined.
+    FieldType   type            = FieldType::Undefined;
+
+    //! Specialization constant ID (i.e. 'constant_id' layout qualifier). By default -1.
+    int         constantID      = -1;
+
+    //! Default value of the specialization constant (exact for all boolean and 32-bit integer values). By default 0.
+    double      defaultValue    = 0.0;
+};
+
 /**
 \brief Number of threads within each work group of a compute shader.
 \see ReflectionData::numThreads
@@ -382,12 +450,133 @@ struct NumThreads
     int z = 0;
 };
 
+/**
+\brief Include file reflection structure for dependency tracking.
+\see ReflectionData::includeFiles
+*/
+struct IncludeFile
+{
+    //! Filename as it was written in the '#include'-directive.
+    std::string     name;
+
+    //! Resolved filename as it was opened by the include handler (see IncludeHandler::GetResolvedFilename). If the include handler did not provide a resolved filename, this is equal to 'name'.
+    std::string     path;
+
+    //! 64-bit FNV-1a hash of the entire content of the included file.
+    std::uint64_t   hash    = 0;
+};
+
+/**
+\brief Static cost estimate of the entry point.
+\remarks The estimate is determined from the final AST (i.e. after optimization and code conversion), and it is only meant to compare shaders or shader permutations with each other.
+All operations are counted over the statements that are reachable from the entry point, where each called function is counted once per call site
+and each loop body is counted once (i.e. the number of loop iterations is not considered).
+ALU operations are weighted by the number of scalar components (e.g. a 'float4' addition counts as four operations).
+\see ReflectionData::cost
+*/
+struct CostEstimate
+{
+    //! Number of arithmetic operations (i.e. '+', '-', '*', negation, increment, and decrement).
+    unsigned int                arithmeticOps       = 0;
+
+    //! Number of division and modulo operations.
+    unsigned int                divisionOps         = 0;
+
+    //! Number of bitwise operations (i.e. '&', '|', '^', '~', '<<', and '>>').
+    unsigned int                bitwiseOps          = 0;
+
+    //! Number of comparison and logical operations.
+    unsigned int                comparisonOps       = 0;
+
+    //! Number of transcendental operations (e.g. 'sin', 'exp', 'pow', and 'rsqrt').
+    unsigned int                transcendentalOps   = 0;
+
+    //! Number of calls to all other intrinsics (e.g. 'dot', 'lerp', and 'saturate'). This does not include texture and buffer accesses.
+    unsigned int                intrinsicCalls      = 0;
+
+    //! Number of texture sample and gather operations.
+    unsigned int                textureSamples      = 0;
+
+    //! Number of texture and buffer fetches (e.g. 'Load' or a buffer subscript) that read memory without a sampler.
+    unsigned int                textureFetches      = 0;
+
+    //! Number of loops.
+    unsigned int                loops               = 0;
+
+    //! Number of loops whose iteration count is not known at compile time. Only 'for'-loops with a constant counter condition are static.
+    unsigned int                dynamicLoops        = 0;
+
+    //! Number of 'if' and 'switch' statements.
+    unsigned int                branches            = 0;
+
+    //! Number of branches whose condition is not known at compile time (e.g. depends on a uniform or a texture value).
+    unsigned int                dynamicBranches     = 0;
+
+    //! Number of interpolator locations, i.e. the user-defined outputs of the entry point, or the user-defined inputs for a fragment shader.
+    unsigned int                interpolators       = 0;
+
+    //! Identifiers of all intrinsics that are used in the output shader unit (in alphabetical order and without duplicates).
+    std::vector<std::string>    intrinsics;
+};
+
+/**
+\brief Local variable that is live at the peak of the register pressure.
+\see RegisterPressure::liveVariables
+*/
+struct LiveVariable
+{
+    //! Identifier of the local variable or function parameter.
+    std::string     name;
+
+    //! Number of 32-bit scalar components of the variable (64-bit components count twice).
+    unsigned int    components  = 0;
+};
+
+/**
+\brief Register pressure estimate of the entry point.
+\remarks The estimate is determined by a liveness analysis over the local variables, function parameters, and expression temporaries of the final AST,
+where the register pressure at each program point is the number of 32-bit scalar components of all values that are live at that point.
+Each called function adds its own peak on top of the variables that are live across the call.
+Global variables, uniforms, and resources are not included, and the register allocation of the driver is not considered.
+\see ReflectionData::registerPressure
+*/
+struct RegisterPressure
+{
+    //! Maximal number of scalar components that are live at the same time (including the temporaries).
+    unsigned int                maxLiveComponents   = 0;
+
+    //! Number of scalar components of the expression temporaries at the peak.
+    unsigned int                temporaries         = 0;
+
+    //! Identifier of the function that contains the peak.
+    std::string                 function;
+
+    //! Source line of the program point at the peak (starting with 1), or 0 if unknown.
+    unsigned int                line                = 0;
+
+    //! Source column of the program point at the peak (starting with 1), or 0 if unknown.
+    unsigned int                column              = 0;
+
+    //! Local variables that are live at the peak (sorted by the number of scalar components in descending order).
+    std::vector<LiveVariable>   liveVariables;
+};
+
 //! Structure for shader output statistics (e.g. texture/buffer binding points).
 struct ReflectionData
 {
     //! All defined macros after pre-processing.
     std::vector<std::string>        macros;
 
+    /**
+    \brief All macros that were tested (with '#if', '#ifdef', '#ifndef', or 'defined') or expanded during pre-processing.
+    \remarks Standard macros (such as '__FILE__') are not included.
+    Any macro that is not in this list (e.g. a macro defined for a shader permutation) had no effect on the output code.
+    */
+    std::vector<std::string>        usedMacros;
+
+    //! All files that have been included during pre-processing (in the order of their first inclusion, without duplicates).
+    std::vector<IncludeFile>        includeFiles;
+
     //! All records declared both globally and within constant buffers (also called structure, struct, or compound data).
     std::vector<Record>             records;
 
@@ -400,6 +589,9 @@ struct ReflectionData
     //! Single shader uniforms.
     std::vector<Attribute>          uniforms;
 
+    //! Vulkan specialization constants (only for VKSL output).
+    std::vector<SpecConstant>       specConstants;
+
     //! Texture and buffer resources.
     std::vector<Resource>           resources;
 
@@ -414,6 +606,391 @@ struct ReflectionData
 
     //! Number of local threads in a compute shader.
     NumThreads                      numThreads;
+
+    //! Static cost estimate of the entry point.
+    CostEstimate                    cost;
+
+    //! Register pressure estimate of the entry point.
+    RegisterPressure                registerPressure;
+};
+
+
+/* ===== Binary reflection format ===== */
+
+/**
+\brief Namespace of the binary reflection format.
+\remarks The binary format is a single flat memory block, which can be memory-mapped and read in place by the ReflectionReader class.
+It starts with the Header, followed by all tables and the string table. Each table begins at an offset that is a multiple of 8.
+All numbers are stored in the byte order of the platform that has written the binary reflection.
+Indices of records (e.g. Field::typeRecordIndex) refer to the Records table,
+and all strings are stored as null-terminated character arrays in the string table.
+\see WriteReflection
+\see ReflectionReader
+*/
+namespace Binary
+{
+
+
+//! Version number of the binary reflection format. This is increased whenever the layout of the binary format changes.
+static const std::uint32_t version = 3;
+
+//! Table enumeration for the 'tables' array in the binary reflection header.
+enum class Table
+{
+    Macros,                 //!< Table of String entries for ReflectionData::macros.
+    UsedMacros,             //!< Table of String entries for ReflectionData::usedMacros.
+    IncludeFiles,           //!< Table of IncludeFile entries for ReflectionData::includeFiles.
+    Records,                //!< Table of Record entries for ReflectionData::records.
+    Fields,                 //!< Table of Field entries of all records and constant buffers.
+    ArrayElements,          //!< Table of 32-bit unsigned integers for the array dimensions of all fields.
+    InputAttributes,        //!< Table of Attribute entries for ReflectionData::inputAttributes.
+    OutputAttributes,       //!< Table of Attribute entries for ReflectionData::outputAttributes.
+    Uniforms,               //!< Table of Attribute entries for ReflectionData::uniforms.
+    SpecConstants,          //!< Table of SpecConstant entries for ReflectionData::specConstants.
+    Resources,              //!< Table of Resource entries for ReflectionData::resources.
+    ConstantBuffers,        //!< Table of ConstantBuffer entries for ReflectionData::constantBuffers.
+    ConstantBufferRanges,   //!< Table of ConstantBufferRange entries of all merged constant buffers.
+    SamplerStates,          //!< Table of SamplerState entries for ReflectionData::samplerStates.
+    StaticSamplerStates,    //!< Table of StaticSamplerState entries for ReflectionData::staticSamplerStates.
+    Intrinsics,             //!< Table of String entries for CostEstimate::intrinsics.
+    LiveVariables,          //!< Table of LiveVariable entries for RegisterPressure::liveVariables.
+
+    Count,                  //!< Number of tables.
+};
+
+//! Reference to a null-terminated string within the string table.
+struct String
+{
+    //! Offset (in bytes) of the first character within the string table.
+    std::uint32_t offset;
+
+    //! Number of characters (without the null terminator).
+    std::uint32_t length;
+};
+
+//! Location of a table within the binary reflection.
+struct TableRange
+{
+    //! Offset (in bytes) of the first table entry from the beginning of the binary reflection.
+    std::uint32_t offset;
+
+    //! Number of table entries.
+    std::uint32_t count;
+};
+
+//! Binary entry of the CostEstimate structure. The intrinsics are stored in the Intrinsics table.
+struct CostEstimate
+{
+    std::uint32_t   arithmeticOps;
+    std::uint32_t   divisionOps;
+    std::uint32_t   bitwiseOps;
+    std::uint32_t   comparisonOps;
+    std::uint32_t   transcendentalOps;
+    std::uint32_t   intrinsicCalls;
+    std::uint32_t   textureSamples;
+    std::uint32_t   textureFetches;
+    std::uint32_t   loops;
+    std::uint32_t   dynamicLoops;
+    std::uint32_t   branches;
+    std::uint32_t   dynamicBranches;
+    std::uint32_t   interpolators;
+};
+
+//! Binary entry of the RegisterPressure structure. The live variables are stored in the LiveVariables table.
+struct RegisterPressure
+{
+    std::uint32_t   maxLiveComponents;
+    std::uint32_t   temporaries;
+    String          function;
+    std::uint32_t   line;
+    std::uint32_t   column;
+};
+
+//! Header of the binary reflection.
+struct Header
+{
+    //! Magic number of the binary reflection. This is always "XSRF".
+    char                magic[4];
+
+    //! Version number of the binary reflection format (see Binary::version).
+    std::uint32_t       version;
+
+    //! Size (in bytes) of the entire binary reflection (including this header).
+    std::uint32_t       size;
+
+    //! Offset (in bytes) of the string table from the beginning of the binary reflection.
+    std::uint32_t       stringsOffset;
+
+    //! Size (in bytes) of the string table.
+    std::uint32_t       stringsSize;
+
+    //! Number of local threads in a compute shader (see ReflectionData::numThreads).
+    std::int32_t        numThreads[3];
+
+    //! Static cost estimate of the entry point (see ReflectionData::cost).
+    CostEstimate        cost;
+
+    //! Register pressure estimate of the entry point (see ReflectionData::registerPressure).
+    RegisterPressure    registerPressure;
+
+    //! Locations of all tables (see Binary::Table).
+    TableRange          tables[static_cast<std::size_t>(Table::Count)];
+};
+
+//! Binary entry of the IncludeFile structure.
+struct IncludeFile
+{
+    String          name;
+    String          path;
+    std::uint64_t   hash;
+};
+
+//! Binary entry of the Record structure. The fields of a record are stored in the Fields table.
+struct Record
+{
+    String          name;
+    std::uint32_t   referenced;
+    std::int32_t    baseRecordIndex;
+    std::uint32_t   firstField;
+    std::uint32_t   numFields;
+    std::uint32_t   size;
+    std::uint32_t   padding;
+};
+
+//! Binary entry of the Field structure. The array dimensions of a field are stored in the ArrayElements table.
+struct Field
+{
+    String          name;
+    std::uint32_t   referenced;
+    std::uint32_t   type;
+    std::uint32_t   dimensions[2];
+    std::int32_t    typeRecordIndex;
+    std::uint32_t   size;
+    std::uint32_t   offset;
+    std::uint32_t   firstArrayElement;
+    std::uint32_t   numArrayElements;
+};
+
+//! Binary entry of the Attribute structure.
+struct Attribute
+{
+    String          name;
+    std::uint32_t   referenced;
+    std::int32_t    slot;
+};
+
+//! Binary entry of the SpecConstant structure.
+struct SpecConstant
+{
+    String          name;
+    std::uint32_t   referenced;
+    std::uint32_t   type;
+    std::int32_t    constantID;
+    std::uint32_t   reserved;
+    double          defaultValue;
+};
+
+//! Binary entry of the Resource structure.
+struct Resource
+{
+    String          name;
+    std::uint32_t   referenced;
+    std::uint32_t   type;
+    std::int32_t    slot;
+    std::int32_t    set;
+};
+
+//! Binary entry of the ConstantBuffer structure. The fields and merged buffers are stored in the Fields and ConstantBufferRanges tables.
+struct ConstantBuffer
+{
+    String          name;
+    std::uint32_t   referenced;
+    std::uint32_t   pushConstant;
+    std::uint32_t   type;
+    std::int32_t    slot;
+    std::int32_t    set;
+    std::uint32_t   size;
+    std::uint32_t   padding;
+    std::uint32_t   firstField;
+    std::uint32_t   numFields;
+    std::uint32_t   firstMergedBuffer;
+    std::uint32_t   numMergedBuffers;
+};
+
+//! Binary entry of the ConstantBufferRange structure. The 'firstField' member is relative to the fields of the merged constant buffer.
+struct ConstantBufferRange
+{
+    String          name;
+    std::int32_t    slot;
+    std::uint32_t   offset;
+    std::uint32_t   size;
+    std::uint32_t   firstField;
+    std::uint32_t   numFields;
+};
+
+//! Binary entry of the SamplerState structure.
+struct SamplerState
+{
+    String          name;
+    std::uint32_t   referenced;
+    std::uint32_t   type;
+    std::int32_t    slot;
+    std::int32_t    set;
+};
+
+//! Binary entry of the StaticSamplerState structure.
+struct StaticSamplerState
+{
+    String          name;
+    std::uint32_t   type;
+    std::uint32_t   filter;
+    std::uint32_t   addressU;
+    std::uint32_t   addressV;
+    std::uint32_t   addressW;
+    float           mipLODBias;
+    std::uint32_t   maxAnisotropy;
+    std::uint32_t   comparisonFunc;
+    float           borderColor[4];
+    float           minLOD;
+    float           maxLOD;
+};
+
+//! Binary entry of the LiveVariable structure.
+struct LiveVariable
+{
+    String          name;
+    std::uint32_t   components;
+};
+
+
+} // /namespace Binary
+
+//! Read-only view of a contiguous array within a binary reflection.
+template <typename T>
+class ArrayView
+{
+
+    public:
+
+        ArrayView() = default;
+
+        inline ArrayView(const T* data, std::size_t size) :
+            data_ { data },
+            size_ { size }
+        {
+        }
+
+        inline const T* begin() const
+        {
+            return data_;
+        }
+
+        inline const T* end() const
+        {
+            return (data_ + size_);
+        }
+
+        inline std::size_t size() const
+        {
+            return size_;
+        }
+
+        inline bool empty() const
+        {
+            return (size_ == 0);
+        }
+
+        inline const T& operator [] (std::size_t index) const
+        {
+            return data_[index];
+        }
+
+    private:
+
+        const T*    data_   = nullptr;
+        std::size_t size_   = 0;
+
+};
+
+/**
+\brief Zero-copy reader for the binary reflection format.
+\remarks The reader does not copy the binary reflection, i.e. the memory block must stay valid as long as the reader is used.
+All table entries are accessed in place, so the memory block must be aligned to 8 bytes (e.g. a memory-mapped file).
+\see WriteReflection
+\see ReadReflection
+*/
+class XSC_EXPORT ReflectionReader
+{
+
+    public:
+
+        ReflectionReader() = default;
+
+        //! Constructs the reader and loads the specified binary reflection. Use IsValid to determine whether loading succeeded.
+        ReflectionReader(const void* data, std::size_t size);
+
+        /**
+        \brief Loads the specified binary reflection.
+        \param[in] data Pointer to the memory block of the binary reflection. This must be aligned to 8 bytes.
+        \param[in] size Size (in bytes) of the memory block.
+        \return True if the binary reflection is valid. Otherwise, the reader is reset and false is returned,
+        e.g. if the magic number or the version number does not match, or if any table exceeds the memory block.
+        */
+        bool Load(const void* data, std::size_t size);
+
+        //! Returns true if a valid binary reflection has been loaded.
+        inline bool IsValid() const
+        {
+            return (header_ != nullptr);
+        }
+
+        //! Returns the header of the binary reflection, or null if no binary reflection has been loaded.
+        inline const Binary::Header* GetHeader() const
+        {
+            return header_;
+        }
+
+        //! Returns the specified null-terminated string from the string table, or an empty string if the string reference is invalid.
+        const char* GetString(const Binary::String& s) const;
+
+        ArrayView<Binary::String>               GetMacros() const;
+        ArrayView<Binary::String>               GetUsedMacros() const;
+        ArrayView<Binary::IncludeFile>          GetIncludeFiles() const;
+        ArrayView<Binary::Record>               GetRecords() const;
+        ArrayView<Binary::Attribute>            GetInputAttributes() const;
+        ArrayView<Binary::Attribute>            GetOutputAttributes() const;
+        ArrayView<Binary::Attribute>            GetUniforms() const;
+        ArrayView<Binary::SpecConstant>         GetSpecConstants() const;
+        ArrayView<Binary::Resource>             GetResources() const;
+        ArrayView<Binary::ConstantBuffer>       GetConstantBuffers() const;
+        ArrayView<Binary::SamplerState>         GetSamplerStates() const;
+        ArrayView<Binary::StaticSamplerState>   GetStaticSamplerStates() const;
+        ArrayView<Binary::String>               GetIntrinsics() const;
+        ArrayView<Binary::LiveVariable>         GetLiveVariables() const;
+
+        //! Returns the fields of the specified record, or an empty view if the field range is invalid.
+        ArrayView<Binary::Field> GetFields(const Binary::Record& record) const;
+
+        //! Returns the fields of the specified constant buffer, or an empty view if the field range is invalid.
+        ArrayView<Binary::Field> GetFields(const Binary::ConstantBuffer& constantBuffer) const;
+
+        //! Returns the array dimensions of the specified field, or an empty view if the field does not denote an array.
+        ArrayView<std::uint32_t> GetArrayElements(const Binary::Field& field) const;
+
+        //! Returns the ranges of all constant buffers that have been merged into the specified constant buffer.
+        ArrayView<Binary::ConstantBufferRange> GetMergedBuffers(const Binary::ConstantBuffer& constantBuffer) const;
+
+    private:
+
+        template <typename T>
+        ArrayView<T> GetTable(const Binary::Table table) const;
+
+        template <typename T>
+        ArrayView<T> GetTableRange(const Binary::Table table, std::uint32_t first, std::uint32_t count) const;
+
+        const char*             data_   = nullptr;
+        const Binary::Header*   header_ = nullptr;
+
 };
 
 
@@ -444,6 +1021,45 @@ This can be <code>std::cout</code> to print to the standard output for instance,
 */
 XSC_EXPORT void PrintReflection(std::ostream& stream, const Reflection::ReflectionData& reflectionData, bool referencedOnly = false);
 
+/**
+\brief Prints the include dependencies into the output stream in the Makefile format (also supported by Ninja as 'depfile').
+\param[out] stream Specifies the output stream to which the dependency rule will be printed.
+\param[in] target Specifies the target filename of the rule (i.e. the output shader filename).
+\param[in] source Specifies the filename of the input shader, which is written as first prerequisite. This can be empty.
+\param[in] reflectionData Specifies the input reflection data that can be obtained by the \c CompileShader function.
+\remarks Example output: <code>Example.VS.vert: Example.hlsl Common.hlsli</code>.
+\see ReflectionData::includeFiles
+*/
+XSC_EXPORT void PrintDependencies(std::ostream& stream, const std::string& target, const std::string& source, const Reflection::ReflectionData& reflectionData);
+
+/**
+\brief Writes the reflection data into the output stream in the binary reflection format.
+\param[out] stream Specifies the output stream to which the binary reflection will be written. This should be opened in binary mode.
+\param[in] reflectionData Specifies the input reflection data that can be obtained by the \c CompileShader function.
+\see ReflectionReader
+\see Reflection::Binary
+*/
+XSC_EXPORT void WriteReflection(std::ostream& stream, const Reflection::ReflectionData& reflectionData);
+
+/**
+\brief Reads the reflection data from the specified binary reflection.
+\param[in] data Pointer to the memory block of the binary reflection. This must be aligned to 8 bytes.
+\param[in] size Size (in bytes) of the memory block.
+\param[out] reflectionData Specifies the output reflection data.
+\return True if the binary reflection is valid. Otherwise, the output reflection data is not modified.
+\remarks To access the binary reflection without copying it, use the ReflectionReader class instead.
+\see WriteReflection
+*/
+XSC_EXPORT bool ReadReflection(const void* data, std::size_t size, Reflection::ReflectionData& reflectionData);
+
+/**
+\brief Prints the reflection data into the output stream in the JSON format.
+\param[out] stream Specifies the output stream to which the reflection will be printed.
+\param[in] reflectionData Specifies the input reflection data that can be obtained by the \c CompileShader function.
+\remarks All objects are printed with their 'referenced' member. The enumerations are printed as strings.
+*/
+XSC_EXPORT void PrintReflectionJSON(std::ostream& stream, const Reflection::ReflectionData& reflectionData);
+
 
 } // /namespace Xsc
 
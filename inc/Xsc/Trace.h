@@ -0,0 +1,87 @@
+/*
+ * Trace.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_TRACE_H
+#define XSC_TRACE_H
+
+
+#include "Export.h"
+#include <string>
+#include <ostream>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace Xsc
+{
+
+
+/* ===== Public classes ===== */
+
+/**
+\brief Trace recorder class for the durations of all compiler stages and passes.
+\remarks A trace recorder can be shared by several compilations, also across multiple threads (all functions are thread-safe).
+Each event is recorded with the thread it has been recorded on, and the events of each compilation are tagged with the filename of its input.
+The recorded events can be written in the Trace Event Format, which can be viewed with "chrome://tracing" or "https://ui.perfetto.dev".
+\see ShaderOutput::traceRecorder
+*/
+class XSC_EXPORT TraceRecorder
+{
+
+    public:
+
+        TraceRecorder();
+        ~TraceRecorder();
+
+        TraceRecorder(const TraceRecorder&) = delete;
+        TraceRecorder& operator = (const TraceRecorder&) = delete;
+
+        //! Returns the current time (in nanoseconds) relative to the construction of this trace recorder.
+        std::uint64_t Now() const;
+
+        /**
+        \brief Records a new event on the calling thread.
+        \param[in] name Specifies the name of the event (e.g. "Parsing").
+        \param[in] category Specifies the category of the event (e.g. "stage").
+        \param[in] startTime Specifies the start time (in nanoseconds) of the event. This should be a value returned by the "Now" function.
+        \param[in] duration Specifies the duration (in nanoseconds) of the event.
+        \param[in] filename Specifies the optional filename of the shader the event belongs to.
+        */
+        void RecordEvent(
+            const std::string&  name,
+            const std::string&  category,
+            std::uint64_t       startTime,
+            std::uint64_t       duration,
+            const std::string&  filename    = ""
+        );
+
+        //! Writes all recorded events as JSON object in the Trace Event Format to the specified output stream.
+        void WriteJSON(std::ostream& stream) const;
+
+        //! Returns the number of recorded events.
+        std::size_t NumEvents() const;
+
+        //! Removes all recorded events.
+        void Clear();
+
+    private:
+
+        // PImple idiom
+        struct OpaqueData;
+        OpaqueData* data_ = nullptr;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
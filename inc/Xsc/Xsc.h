@@ -15,6 +15,7 @@
 #include "Targets.h"
 #include "Version.h"
 #include "Reflection.h"
+#include "Trace.h"
 
 #include <string>
 #include <vector>
@@ -22,6 +23,7 @@
 #include <istream>
 #include <ostream>
 #include <memory>
+#include <cstdint>
 
 
 /**
@@ -111,10 +113,13 @@ struct Extensions
 {
     enum : unsigned int
     {
-        LayoutAttribute = (1 << 0), //!< Enables the 'layout' attribute extension (e.g. "[layout(rgba8)]").
-        SpaceAttribute  = (1 << 1), //!< Enables the 'space' attribute extension for a stronger type system (e.g. "[space(OBJECT, MODEL)]").
+        LayoutAttribute          = (1 << 0), //!< Enables the 'layout' attribute extension (e.g. "[layout(rgba8)]").
+        SpaceAttribute           = (1 << 1), //!< Enables the 'space' attribute extension for a stronger type system (e.g. "[space(OBJECT, MODEL)]").
+        ConstantIDAttribute      = (1 << 2), //!< Enables the 'constant_id' attribute extension for Vulkan specialization constants (e.g. "[constant_id(3)]").
+        ReorderMembersAttribute  = (1 << 3), //!< Enables the 'reorder_members' attribute extension for constant buffers (e.g. "[reorder_members] cbuffer Settings { ... };").
+        UpdateFrequencyAttribute = (1 << 4), //!< Enables the 'update_frequency' attribute extension for constant buffers (e.g. "[update_frequency(PerFrame)] cbuffer Camera { ... };").
 
-        All             = (~0u)     //!< All extensions.
+        All                      = (~0u)     //!< All extensions.
     };
 };
 
@@ -152,6 +157,12 @@ struct Options
     //! If true, the shader output may contain GLSL extensions, if the target shader version is too low. By default false.
     bool    allowExtensions         = false;
 
+    /**
+    \brief If true, only the functions which are reachable from the entry point(s) are analyzed. By default false.
+    \remarks This speeds up the compilation of large shader libraries, but no errors or warnings are reported for unreachable functions.
+    */
+    bool    analyzeReachableOnly    = false;
+
     /**
     \brief If true, binding slots for all buffer types will be generated sequentially, starting with index at 'autoBindingStartSlot'. By default false.
     \remarks This will also enable 'explicitBinding'.
@@ -164,6 +175,13 @@ struct Options
     //! If true, explicit binding slots are enabled. By default false.
     bool    explicitBinding         = false;
 
+    /**
+    \brief If true, the members of constant buffers are laid out to match the HLSL packing rules byte by byte (as reported by the reflection). By default false.
+    \remarks VKSL output uses explicit 'offset' layout qualifiers, and GLSL output uses inserted padding members.
+    Compilation fails if a member can not be placed at its HLSL offset with the std140 layout rules.
+    */
+    bool    matchBufferLayout       = false;
+
     //! If true, code obfuscation is performed. By default false.
     bool    obfuscate               = false;
 
@@ -180,6 +198,18 @@ struct Options
     //! If true, commentaries are preserved for each statement. By default false.
     bool    preserveComments        = false;
 
+    /**
+    \brief If true, only the code reflection is performed, i.e. the shader is analyzed and its references are marked, but neither converted nor generated. By default false.
+    \remarks No output code is written. The reflection describes the input code, i.e. output transformations such as 'autoBinding', 'uniformPacking', 'bufferMerging', and 'bindingLayout' are not reflected.
+    Anonymous structures are named in order of their declaration with the same scheme as in the output code (e.g. "xst_anonym0").
+    The cost estimate and the register pressure describe the unconverted code, so they can differ from a full compilation
+    (e.g. intrinsics that are only introduced by the code conversion are not counted).
+    */
+    bool    reflectOnly             = false;
+
+    //! If true, the members of the packed uniform buffer (see 'uniformPacking') and of all constant buffers with the 'reorder_members' attribute are reordered to minimize the buffer size. By default false.
+    bool    reorderUniforms         = false;
+
     //! If true, matrices have row-major alignment. Otherwise the matrices have column-major alignment. By default false.
     bool    rowMajorAlignment       = false;
 
@@ -334,6 +364,175 @@ struct UniformPacking
     std::string bufferName  = "xsp_buffer";
 };
 
+/**
+\brief Constant buffer merging descriptor structure.
+\remarks Reachable constant buffers are merged into a single uniform buffer, if they have the same update frequency tag
+(see 'update_frequency' attribute extension) or if they have no such tag and their size does not exceed the size threshold.
+Each merged constant buffer starts at a 16 byte boundary, and its range is reported in Reflection::ConstantBuffer::mergedBuffers.
+The members of a merged constant buffer are placed at the same offsets as with the HLSL packing rules only if 'Options::matchBufferLayout' is enabled.
+\see ShaderOutput::bufferMerging
+*/
+struct BufferMerging
+{
+    //! If true, small constant buffers and constant buffers with the same update frequency are merged into a single uniform buffer. By default false.
+    bool            enabled         = false;
+
+    //! Maximum size (in bytes) of constant buffers without update frequency tag that are merged. If this is 0, only tagged constant buffers are merged. By default 64.
+    unsigned int    sizeThreshold   = 64;
+
+    /**
+    \brief Name of the merged uniform buffer. By default "xsm_buffer".
+    \remarks Constant buffers with an update frequency tag are merged into a uniform buffer with the tag appended to this name (e.g. "xsm_buffer_PerFrame").
+    */
+    std::string     bufferName      = "xsm_buffer";
+};
+
+/**
+\brief Descriptor binding layout parameter structure for VKSL output.
+\remarks The register space of each resource is mapped to a descriptor set, e.g. "register(t2, space1)" is mapped to "layout(set = 1, binding = ...)".
+If enabled, the binding slots of all referenced resources are compacted within each descriptor set, so that there are no holes between them.
+The bindings are assigned in the order of the register types (constant buffers, textures, samplers, and unordered access views) and register slots.
+\see ShaderOutput::bindingLayout
+*/
+struct BindingLayout
+{
+    //! If true, the binding slots within each descriptor set are compacted. This implies 'Options::explicitBinding'. Only used for VKSL output. By default false.
+    bool        enabled             = false;
+
+    //! Name of the constant buffer that is mapped to a push constant block instead of a binding slot. Only used for VKSL output. By default empty.
+    std::string pushConstantBuffer;
+};
+
+/**
+\brief Precision qualification policy for ESSL output.
+\remarks By default, all floating-point variables are qualified with 'highp', and only 'half' (or 'min16float') variables are qualified with 'mediump'.
+If this policy is enabled, the precision of each floating-point variable is inferred from its semantic and its usage instead.
+Semantic names are compared case insensitive and without index. The legacy names "COLOR", "POSITION", and "DEPTH"
+also match the system value semantics "SV_Target", "SV_Position", and "SV_Depth" respectively.
+\see ShaderOutput::precisionPolicy
+*/
+struct PrecisionPolicy
+{
+    //! If true, the precision of each floating-point variable is inferred by this policy. Only used for ESSL output. By default false.
+    bool                        enabled         = false;
+
+    //! Semantics of variables that are qualified with 'mediump'. By default "COLOR", "NORMAL", "TANGENT", and "BINORMAL".
+    std::vector<std::string>    mediumSemantics = { "COLOR", "NORMAL", "TANGENT", "BINORMAL" };
+
+    //! Semantics of variables that are always qualified with 'highp', even if they are declared as 'half'. By default "POSITION" and "DEPTH".
+    std::vector<std::string>    highSemantics   = { "POSITION", "DEPTH" };
+
+    //! If true, local variables that are only assigned from medium precision expressions are qualified with 'mediump' as well. By default true.
+    bool                        inferLocals     = true;
+};
+
+/**
+\brief Location of a varying, i.e. a shader output of one stage that is passed as shader input to the next stage.
+\see VaryingLayout::varyings
+*/
+struct VaryingLocation
+{
+    //! Semantic of the varying with its index (e.g. "TEXCOORD0"). Semantics are compared case insensitive.
+    std::string semantic;
+
+    //! Zero-based location of the interpolator.
+    int         location    = 0;
+
+    //! Zero-based index of the first interpolator component the varying is packed into (0 for 'x' up to 3 for 'w'). By default 0.
+    int         component   = 0;
+};
+
+/**
+\brief Layout of all varyings between two consecutive shader stages.
+\remarks This layout is usually determined by the "LinkShaderStages" function, which assigns the same layout to both shader stages.
+\see ShaderOutput::inputVaryings
+\see ShaderOutput::outputVaryings
+\see LinkShaderStages
+*/
+struct VaryingLayout
+{
+    //! If true, the locations of all varyings are taken from this layout. By default false.
+    bool                            enabled     = false;
+
+    /**
+    \brief Locations of all varyings that are passed between the two shader stages.
+    \remarks Vertex shader outputs with a user-defined semantic, which is not in this list, are removed together with their assignments.
+    */
+    std::vector<VaryingLocation>    varyings;
+};
+
+/**
+\brief Constant value of a uniform to specialize the shader with.
+\see ShaderOutput::uniformValues
+*/
+struct UniformValue
+{
+    //! Uniform value type enumeration.
+    enum class Type
+    {
+        Bool,   //!< Boolean value (see 'boolValue').
+        Int,    //!< Integral value (see 'intValue').
+        Float,  //!< Floating-point value (see 'floatValue').
+    };
+
+    //! Default constructor.
+    UniformValue() = default;
+
+    //! Constructor to initialize a boolean value.
+    inline UniformValue(bool value) :
+        type        { Type::Bool },
+        boolValue   { value      }
+    {
+    }
+
+    //! Constructor to initialize an integral value.
+    inline UniformValue(int value) :
+        type        { Type::Int },
+        intValue    { value     }
+    {
+    }
+
+    //! Constructor to initialize an integral value.
+    inline UniformValue(unsigned int value) :
+        type        { Type::Int },
+        intValue    { value     }
+    {
+    }
+
+    //! Constructor to initialize an integral value.
+    inline UniformValue(long long value) :
+        type        { Type::Int },
+        intValue    { value     }
+    {
+    }
+
+    //! Constructor to initialize a floating-point value.
+    inline UniformValue(float value) :
+        type        { Type::Float },
+        floatValue  { value       }
+    {
+    }
+
+    //! Constructor to initialize a floating-point value.
+    inline UniformValue(double value) :
+        type        { Type::Float },
+        floatValue  { value       }
+    {
+    }
+
+    //! Specifies the type of this value. By default Type::Int.
+    Type        type        = Type::Int;
+
+    //! Boolean value. Only relevant if 'type' is Type::Bool. By default false.
+    bool        boolValue   = false;
+
+    //! Integral value. Only relevant if 'type' is Type::Int. By default 0.
+    long long   intValue    = 0;
+
+    //! Floating-point value. Only relevant if 'type' is Type::Float. By default 0.0.
+    double      floatValue  = 0.0;
+};
+
 /**
 \brief Shader output descriptor structure.
 \see CompileShader
@@ -355,6 +554,50 @@ struct ShaderOutput
     //! Optional parameters to pack all global uniforms into a single output uniform buffer.
     UniformPacking              uniformPacking;
 
+    //! Optional parameters to merge small constant buffers into a single output uniform buffer.
+    BufferMerging               bufferMerging;
+
+    //! Optional parameters to map register spaces to descriptor sets and to compact the binding slots for VKSL output.
+    BindingLayout               bindingLayout;
+
+    /**
+    \brief Optional map of uniform names to constant values to specialize the shader with. By default empty.
+    \remarks Each global uniform and constant buffer member with a scalar type, whose name is in this map, is replaced by a constant.
+    The resulting expressions are folded and branches with a constant condition are removed, even if 'Options::optimize' is disabled.
+    Specialized global uniforms do not appear in the output code nor in the reflection data.
+    Specialized constant buffer members keep their place in the constant buffer, so the layout of the constant buffer remains unchanged,
+    and their constants are renamed with the 'NameMangling::temporaryPrefix' (e.g. "xst_useFog").
+    \see UniformValue
+    */
+    std::map<std::string, UniformValue> uniformValues;
+
+    /**
+    \brief Optional map of global constant names to Vulkan specialization constant IDs. By default empty.
+    \remarks Each global constant with a scalar type and a constant initializer (e.g. "static const bool useFog = true;"), whose name is in this map,
+    is written as specialization constant (e.g. "layout(constant_id = 3) const bool useFog = true;"). Such constants are not folded by the optimizer.
+    This is only supported for VKSL output. If the compiler was build with the 'XSC_ENABLE_LANGUAGE_EXT' macro,
+    specialization constants can also be declared with the 'constant_id' attribute (see Extensions::ConstantIDAttribute).
+    \see Reflection::ReflectionData::specConstants
+    */
+    std::map<std::string, int>          specConstantIDs;
+
+    //! Optional policy to infer the precision qualifiers for ESSL output.
+    PrecisionPolicy                     precisionPolicy;
+
+    //! Optional layout of the shader inputs that are passed from the previous shader stage (ignored for vertex shaders).
+    VaryingLayout                       inputVaryings;
+
+    //! Optional layout of the shader outputs that are passed to the next shader stage (ignored for fragment shaders).
+    VaryingLayout                       outputVaryings;
+
+    /**
+    \brief Optional trace recorder for the durations of all compiler stages and passes. By default null.
+    \remarks The same trace recorder can be used for several compilations, also for compilations that run in parallel on multiple threads.
+    The events are tagged with the filename of the shader input (see ShaderInput::filename).
+    \see TraceRecorder
+    */
+    TraceRecorder*                      traceRecorder   = nullptr;
+
     //! Additional options to configure the code generation.
     Options                     options;
 
@@ -390,6 +633,61 @@ struct AssemblyDescriptor
     bool                    indentOperands          = true;
 };
 
+/**
+\brief Compile statistics structure, e.g. to find the shaders that dominate the build time.
+\remarks All durations are in nanoseconds. Stages that have not been reached (e.g. due to a compile error) have a duration of zero.
+\see CompileShader
+*/
+struct CompileStatistics
+{
+    //! Duration of a single pass within a compiler stage.
+    struct Pass
+    {
+        //! Name of the pass (e.g. "GLSLConverter").
+        std::string     name;
+
+        //! Duration (in nanoseconds) of the pass.
+        std::uint64_t   duration    = 0;
+    };
+
+    //! Duration (in nanoseconds) of the pre-processing.
+    std::uint64_t       preProcessingTime   = 0;
+
+    //! Duration (in nanoseconds) of the parsing.
+    std::uint64_t       parsingTime         = 0;
+
+    //! Duration (in nanoseconds) of the context analysis.
+    std::uint64_t       analysisTime        = 0;
+
+    //! Duration (in nanoseconds) of the AST optimization (including uniform specialization and varying elimination).
+    std::uint64_t       optimizationTime    = 0;
+
+    //! Duration (in nanoseconds) of the AST conversion and code generation.
+    std::uint64_t       generationTime      = 0;
+
+    //! Duration (in nanoseconds) of the code reflection.
+    std::uint64_t       reflectionTime      = 0;
+
+    //! Durations of the individual passes within the compiler stages (i.e. the AST optimizations, conversions, code generation, and code reflection) in the order of their execution.
+    std::vector<Pass>   passes;
+
+    //! Number of tokens that have been scanned by the pre-processor and the parser.
+    std::size_t         numTokens           = 0;
+
+    //! Number of AST nodes that have been created during the compilation (including the nodes of all AST conversions).
+    std::size_t         numASTNodes         = 0;
+
+    //! Number of heap allocations for tokens, AST nodes, and type denoters during the compilation.
+    std::size_t         numAllocations      = 0;
+
+    /**
+    \brief Peak memory usage (in bytes) of the process after the compilation, or 0 if the platform does not support this query.
+    \remarks This is the peak resident set size (or peak working set on Windows) of the entire process,
+    so it also includes the memory of the host application and of all previous compilations.
+    */
+    std::size_t         peakMemory          = 0;
+};
+
 
 /* ===== Public functions ===== */
 
@@ -399,18 +697,52 @@ struct AssemblyDescriptor
 \param[in] outputDesc Output shader code descriptor.
 \param[in] log Optional pointer to an output log. Inherit from the "Log" class interface. By default null.
 \param[out] reflectionData Optional pointer to a code reflection data structure. By default null.
+\param[out] statistics Optional pointer to a compile statistics structure. Statistics are only collected if this is not null. By default null.
 \return True if the code has been translated successfully.
 \throw std::invalid_argument If either the input or output streams are null.
 \see ShaderInput
 \see ShaderOutput
 \see Log
 \see ReflectionData
+\see CompileStatistics
 */
 XSC_EXPORT bool CompileShader(
     const ShaderInput&          inputDesc,
     const ShaderOutput&         outputDesc,
     Log*                        log             = nullptr,
-    Reflection::ReflectionData* reflectionData  = nullptr
+    Reflection::ReflectionData* reflectionData  = nullptr,
+    CompileStatistics*          statistics      = nullptr
+);
+
+/**
+\brief Prints the compile statistics into the output stream in a human readable format.
+\param[in,out] stream Specifies the output stream.
+\param[in] statistics Specifies the compile statistics (see CompileShader).
+\see CompileStatistics
+*/
+XSC_EXPORT void PrintStatistics(std::ostream& stream, const CompileStatistics& statistics);
+
+/**
+\brief Links the varyings of consecutive shader stages (e.g. vertex and fragment shader, or vertex, geometry, and fragment shader).
+\param[in] inputDescs Input shader code descriptors of all shader stages in pipeline order.
+\param[in,out] outputDescs Output shader code descriptors of all shader stages in the same order. The members 'inputVaryings' and 'outputVaryings' are set by this function.
+\param[in] log Optional pointer to an output log. Inherit from the "Log" class interface. By default null.
+\return True if all shader stages have been analyzed successfully.
+\remarks Each shader stage is only analyzed and no output code is generated, so the shaders must still be compiled with "CompileShader" afterwards.
+The input streams are reset to their previous positions after the analysis.
+Vertex shader outputs that are never read by the next shader stage are removed during compilation together with their assignments.
+Inputs that are neither written by the previous shader stage nor read by the entry point are declared as private variables.
+The remaining floating-point scalar and vector varyings with equal interpolation modifiers are packed into as few four-component interpolators as possible,
+by assigning the same location with different components (e.g. "layout(location = 0, component = 3)"), which requires GLSL 440 or the 'GL_ARB_enhanced_layouts' extension.
+Varyings are not packed if any shader stage is compiled to ESSL.
+\throw std::invalid_argument If the number of input and output descriptors differ, or if any input stream is null.
+\see ShaderOutput::inputVaryings
+\see ShaderOutput::outputVaryings
+*/
+XSC_EXPORT bool LinkShaderStages(
+    const std::vector<ShaderInput>& inputDescs,
+    std::vector<ShaderOutput>&      outputDescs,
+    Log*                            log             = nullptr
 );
 
 /**
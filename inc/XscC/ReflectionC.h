@@ -173,6 +173,22 @@ struct XscAttribute
     int         slot;
 };
 
+/**
+\brief Vulkan specialization constant reflection structure.
+\see XscReflectionData::specConstants
+*/
+struct XscSpecConstant
+{
+    //! Name of the specialization constant.
+    const char* name;
+
+    //! Specialization constant ID (i.e. 'constant_id' layout qualifier).
+    int         constantID;
+
+    //! Default value of the specialization constant (exact for all boolean and 32-bit integer values).
+    double      defaultValue;
+};
+
 /**
 \brief Resource reflection structure for textures, combined texture samplers, and buffers.
 \see XscReflectionData::resources
@@ -268,6 +284,12 @@ struct XscReflectionData
     //! Number of elements in 'macros'.
     size_t                              macrosCount;
 
+    //! All macros that were tested or expanded during pre-processing.
+    const char**                        usedMacros;
+
+    //! Number of elements in 'usedMacros'.
+    size_t                              usedMacrosCount;
+
     //! Shader input attributes.
     const struct XscAttribute*          inputAttributes;
 
@@ -286,6 +308,12 @@ struct XscReflectionData
     //! Number of elements in 'uniforms'.
     size_t                              uniformsCount;
 
+    //! Vulkan specialization constants (only for VKSL output).
+    const struct XscSpecConstant*       specConstants;
+
+    //! Number of elements in 'specConstants'.
+    size_t                              specConstantsCount;
+
     //! Texture bindings.
     const struct XscResource*           resources;
 
@@ -329,6 +357,37 @@ XSC_EXPORT void XscComparisonFuncToString(const enum XscComparisonFunc t, char*
 //! Returns the string representation of the specified <XscResourceType> type.
 XSC_EXPORT void XscResourceTypeToString(const enum XscResourceType t, char* str, size_t maxSize);
 
+/**
+\brief Writes the reflection data of the last call to XscCompileShader (in the current thread) in the binary reflection format.
+\param[out] buffer Optional pointer to the output buffer. If NULL, only the required size is returned.
+\param[in] maxSize Specifies the size (in bytes) of the output buffer. If the buffer is too small, nothing is written.
+\return Required size (in bytes) of the binary reflection.
+\remarks The reflection data is only available if XscCompileShader was called with a non-null reflection data structure.
+\see Xsc::WriteReflection
+*/
+XSC_EXPORT size_t XscWriteReflection(void* buffer, size_t maxSize);
+
+/**
+\brief Reads the reflection data from the specified binary reflection (e.g. a memory-mapped file).
+\param[in] data Pointer to the memory block of the binary reflection. This must be aligned to 8 bytes.
+\param[in] size Specifies the size (in bytes) of the memory block.
+\param[out] reflectionData Pointer to the output reflection data structure.
+All strings refer directly to the binary reflection, i.e. they are valid as long as the memory block is valid.
+The returned arrays are only valid until this function or XscCompileShader is called the next time.
+\return None-zero if the binary reflection is valid.
+\see Xsc::Reflection::ReflectionReader
+*/
+XSC_EXPORT int XscReadReflection(const void* data, size_t size, struct XscReflectionData* reflectionData);
+
+/**
+\brief Writes the reflection data of the last call to XscCompileShader (in the current thread) in the JSON format.
+\param[out] str Optional pointer to the output string. If NULL, only the required size is returned.
+\param[in] maxSize Specifies the size (in bytes) of the output string. If the string is too small, it is filled with zeros.
+\return Required size (in bytes) of the JSON string (including the null terminator).
+\see Xsc::PrintReflectionJSON
+*/
+XSC_EXPORT size_t XscWriteReflectionJSON(char* str, size_t maxSize);
+
 
 #ifdef __cplusplus
 } // /extern "C"
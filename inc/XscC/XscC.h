@@ -47,10 +47,13 @@ enum XscWarnings
 */
 enum XscExtensions
 {
-    XscExtLayoutAttribute   = (1 << 0), //!< Enables the 'layout' attribute (e.g. "[layout(rgba8)]").
-    XscExtSpaceAttribute    = (1 << 1), //!< Enables the 'space' attribute extension for a stronger type system (e.g. "[space(OBJECT, MODEL)]").
+    XscExtLayoutAttribute           = (1 << 0), //!< Enables the 'layout' attribute (e.g. "[layout(rgba8)]").
+    XscExtSpaceAttribute            = (1 << 1), //!< Enables the 'space' attribute extension for a stronger type system (e.g. "[space(OBJECT, MODEL)]").
+    XscExtConstantIDAttribute       = (1 << 2), //!< Enables the 'constant_id' attribute extension for Vulkan specialization constants (e.g. "[constant_id(3)]").
+    XscExtReorderMembersAttribute   = (1 << 3), //!< Enables the 'reorder_members' attribute extension for constant buffers (e.g. "[reorder_members] cbuffer Settings { ... };").
+    XscExtUpdateFrequencyAttribute  = (1 << 4), //!< Enables the 'update_frequency' attribute extension for constant buffers (e.g. "[update_frequency(PerFrame)] cbuffer Camera { ... };").
 
-    XscExtAll               = (~0u)     //!< All extensions.
+    XscExtAll                       = (~0u)     //!< All extensions.
 };
 
 //! Formatting descriptor structure for the output shader.
@@ -84,6 +87,12 @@ struct XscOptions
     //! If none-zero, the shader output may contain GLSL extensions, if the target shader version is too low. By default false.
     XscBoolean  allowExtensions;
 
+    /**
+    \brief If none-zero, only the functions which are reachable from the entry point(s) are analyzed. By default false.
+    \remarks This speeds up the compilation of large shader libraries, but no errors or warnings are reported for unreachable functions.
+    */
+    XscBoolean  analyzeReachableOnly;
+
     /**
     \brief If none-zero, binding slots for all buffer types will be generated sequentially, starting with index at 'autoBindingStartSlot'. By default false.
     \remarks This will also enable 'explicitBinding'.
@@ -96,6 +105,12 @@ struct XscOptions
     //! If none-zero, explicit binding slots are enabled. By default false.
     XscBoolean  explicitBinding;
 
+    /**
+    \brief If none-zero, the members of constant buffers are laid out to match the HLSL packing rules byte by byte (as reported by the reflection). By default false.
+    \remarks VKSL output uses explicit 'offset' layout qualifiers, and GLSL output uses inserted padding members.
+    */
+    XscBoolean  matchBufferLayout;
+
     //! If none-zero, code obfuscation is performed. By default false.
     XscBoolean  obfuscate;
 
@@ -111,6 +126,12 @@ struct XscOptions
     //! If none-zero, commentaries are preserved for each statement. By default false.
     XscBoolean  preserveComments;
 
+    //! If none-zero, only the code reflection is performed, i.e. the shader is analyzed, but neither converted nor generated. By default false.
+    XscBoolean  reflectOnly;
+
+    //! If none-zero, the members of the packed uniform buffer and of all constant buffers with the 'reorder_members' attribute are reordered to minimize the buffer size. By default false.
+    XscBoolean  reorderUniforms;
+
     //! If none-zero, matrices have row-major alignment. Otherwise the matrices have column-major alignment. By default false.
     XscBoolean  rowMajorAlignment;
 
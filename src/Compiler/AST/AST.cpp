@@ -15,6 +15,7 @@
 #include "ReportIdents.h"
 #include "HLSLKeywords.h"
 #include "GLSLKeywords.h"
+#include "Profiler.h"
 #include <algorithm>
 #include <cctype>
 
@@ -53,6 +54,11 @@ bool IsDeclStmntAST(const AST::Types t)
 
 /* ----- AST ----- */
 
+AST::AST()
+{
+    Profiler::CountASTNode();
+}
+
 AST::~AST()
 {
     // dummy
@@ -81,6 +87,11 @@ void TypedAST::ResetTypeDenoter()
     bufferedTypeDenoter_.reset();
 }
 
+bool TypedAST::HasBufferedTypeDenoter() const
+{
+    return (bufferedTypeDenoter_ != nullptr);
+}
+
 
 /* ----- Expr ----- */
 
@@ -270,7 +281,12 @@ std::string Register::ToString() const
     else
         s += RegisterTypeToString(registerType);
 
-    s += "[" + std::to_string(slot) + "])";
+    s += "[" + std::to_string(slot) + "]";
+
+    if (space > 0)
+        s += ", space" + std::to_string(space);
+
+    s += ")";
 
     return s;
 }
@@ -573,6 +589,24 @@ bool VarDecl::HasStaticConstInitializer() const
     );
 }
 
+bool VarDecl::IsSpecConstant() const
+{
+    return (specConstantID >= 0);
+}
+
+bool VarDecl::IsCompileTimeConst() const
+{
+    if (declStmntRef != nullptr && initializer != nullptr && bufferDeclRef == nullptr && !IsSpecConstant())
+    {
+        if (declStmntRef->typeSpecifier->IsConst() && !declStmntRef->flags(VarDeclStmnt::isParameter))
+        {
+            /* Non-static global constants are uniforms, whose initializer is only a default value */
+            return (IsStatic() || !declStmntRef->flags(VarDeclStmnt::isGlobal));
+        }
+    }
+    return false;
+}
+
 void VarDecl::SetCustomTypeDenoter(const TypeDenoterPtr& typeDenoter)
 {
     customTypeDenoter = typeDenoter;
@@ -1459,10 +1493,11 @@ bool UniformBufferDecl::AccumAlignedVectorSize(unsigned int& size, unsigned int&
     if (bufferType == UniformBufferType::ConstantBuffer)
     {
         /* Accumulate size for each member */
-        for (const auto& member : varMembers)
+        for (std::size_t i = 0; i < varMembers.size(); ++i)
         {
             /* Store offset only for first element */
-            member->AccumAlignedVectorSize(size, padding, offset);
+            AccumMergedBufferPadding(i, size, padding);
+            varMembers[i]->AccumAlignedVectorSize(size, padding, offset);
             offset = nullptr;
         }
 
@@ -1476,6 +1511,24 @@ bool UniformBufferDecl::AccumAlignedVectorSize(unsigned int& size, unsigned int&
     return false;
 }
 
+void UniformBufferDecl::AccumMergedBufferPadding(std::size_t memberIndex, unsigned int& size, unsigned int& padding) const
+{
+    if (memberIndex > 0)
+    {
+        for (const auto& mergedBuffer : mergedBuffers)
+        {
+            if (mergedBuffer.firstMember == memberIndex)
+            {
+                /* Each merged constant buffer starts at a 16 byte boundary, just like the original constant buffer */
+                auto remainingPadding = RemainingVectorSize(size);
+                size += remainingPadding;
+                padding += remainingPadding;
+                break;
+            }
+        }
+    }
+}
+
 
 /* ----- BufferDeclStmnt ----- */
 
@@ -1575,6 +1628,16 @@ bool VarDeclStmnt::IsConstOrUniform() const
     return typeSpecifier->IsConstOrUniform();
 }
 
+bool VarDeclStmnt::HasSpecConstants() const
+{
+    for (const auto& varDecl : varDecls)
+    {
+        if (varDecl->IsSpecConstant())
+            return true;
+    }
+    return false;
+}
+
 void VarDeclStmnt::SetTypeModifier(const TypeModifier modifier)
 {
     typeSpecifier->SetTypeModifier(modifier);
@@ -1877,8 +1940,34 @@ bool TernaryExpr::IsVectorCondition() const
 
 /* ----- BinaryExpr ----- */
 
+BinaryExpr::~BinaryExpr()
+{
+    /* Release all binary expressions of the left-hand-side chain that are not referenced elsewhere one after another (e.g. for sums of thousands of terms) */
+    auto subExpr = std::move(lhsExpr);
+
+    while (subExpr && subExpr.use_count() == 1)
+    {
+        if (auto binaryExpr = subExpr->As<BinaryExpr>())
+        {
+            auto nextSubExpr = std::move(binaryExpr->lhsExpr);
+            subExpr = std::move(nextSubExpr);
+        }
+        else
+            break;
+    }
+}
+
 TypeDenoterPtr BinaryExpr::DeriveTypeDenoter(const TypeDenoter* /*expectedTypeDenoter*/)
 {
+    /* Derive types of the left-hand-side chain from the inner most binary expression first, to avoid deep recursion (e.g. for sums of thousands of terms) */
+    std::vector<BinaryExpr*> lhsChain;
+
+    for (auto subExpr = lhsExpr->As<BinaryExpr>(); subExpr != nullptr && !subExpr->HasBufferedTypeDenoter(); subExpr = subExpr->lhsExpr->As<BinaryExpr>())
+        lhsChain.push_back(subExpr);
+
+    for (auto it = lhsChain.rbegin(); it != lhsChain.rend(); ++it)
+        (*it)->GetTypeDenoter();
+
     /* Return type of left-hand-side sub expresion if the types are compatible */
     const auto& lhsTypeDen = lhsExpr->GetTypeDenoter()->GetAliased();
     const auto& rhsTypeDen = rhsExpr->GetTypeDenoter()->GetAliased();
@@ -1911,13 +2000,26 @@ const Expr* BinaryExpr::Find(const FindPredicateConstFunctor& predicate, unsigne
         /* Call predicate for this expression */
         CALL_EXPR_FIND_PREDICATE(predicate);
 
-        /* Search in sub expressions */
+        /* Search in sub expressions (iterate over chain of left-hand-side binary expressions to avoid deep recursion) */
         if ((flags & SearchRValue) != 0)
         {
-            if (auto e = lhsExpr->Find(predicate, flags))
-                return e;
-            if (auto e = rhsExpr->Find(predicate, flags))
+            std::vector<const BinaryExpr*> lhsChain { this };
+
+            for (auto binaryExpr = lhsExpr->As<BinaryExpr>(); binaryExpr != nullptr; binaryExpr = binaryExpr->lhsExpr->As<BinaryExpr>())
+            {
+                if (predicate(*binaryExpr))
+                    return binaryExpr;
+                lhsChain.push_back(binaryExpr);
+            }
+
+            if (auto e = lhsChain.back()->lhsExpr->Find(predicate, flags))
                 return e;
+
+            for (auto it = lhsChain.rbegin(); it != lhsChain.rend(); ++it)
+            {
+                if (auto e = (*it)->rhsExpr->Find(predicate, flags))
+                    return e;
+            }
         }
     }
     return nullptr;
@@ -163,6 +163,7 @@ struct AST
         InitializerExpr,
     };
 
+    AST();
     virtual ~AST();
 
     // Returns the AST node type.
@@ -248,6 +249,9 @@ struct TypedAST : public AST
         // Resets the buffered type denoter.
         void ResetTypeDenoter();
 
+        // Returns true if this AST node has a buffered type denoter, i.e. "GetTypeDenoter" does not need to derive it again.
+        bool HasBufferedTypeDenoter() const;
+
     protected:
 
         virtual TypeDenoterPtr DeriveTypeDenoter(const TypeDenoter* expectedTypeDenoter) = 0;
@@ -451,6 +455,7 @@ struct Register : public AST
     ShaderTarget    shaderTarget    = ShaderTarget::Undefined;  // Shader target (or profile). Undefined means all targets are affected.
     RegisterType    registerType    = RegisterType::Undefined;  // Type of the register. Must not be undefined.
     int             slot            = 0;                        // Zero-based register slot index. By default 0.
+    int             space           = 0;                        // Zero-based register space index (descriptor set for VKSL output). By default 0.
 };
 
 // Pack offset.
@@ -495,6 +500,12 @@ struct TypeSpecifier : public TypedAST
 {
     AST_INTERFACE(TypeSpecifier);
 
+    FLAG_ENUM
+    {
+        FLAG( isMediumPrecision, 0 ), // This type is qualified with medium precision (only for ESSL output).
+        FLAG( isHighPrecision,   1 ), // This type is qualified with high precision (only for ESSL output).
+    };
+
     // Returns the name of this type and all modifiers.
     std::string ToString() const;
 
@@ -555,6 +566,7 @@ struct VarDecl : public Decl
         FLAG( isDynamicArray,       5 ), // This variable is a dynamic array (for input/output semantics).
         FLAG( isEntryPointOutput,   6 ), // This variable is used as entry point output (return value, output parameter, stream output).
         FLAG( isEntryPointLocal,    7 ), // This variable is a local variable of the entry point.
+        FLAG( isUnlinkedVarying,    8 ), // This variable is an entry point input or output, which is not linked with the adjacent shader stage (see VaryingLinker).
 
         isShaderInputSV     = (isShaderInput  | isSystemValue), // This variable is used as shader input, and it is a system value.
         isShaderOutputSV    = (isShaderOutput | isSystemValue), // This variable is used as shader output, and it is a system value.
@@ -584,6 +596,12 @@ struct VarDecl : public Decl
     // Returns true if this is a non-parameter local variable with a constant initializer.
     bool HasStaticConstInitializer() const;
 
+    // Returns true if this variable is a Vulkan specialization constant, i.e. its value is only known at pipeline creation time.
+    bool IsSpecConstant() const;
+
+    // Returns true if the initializer of this variable is its only value, i.e. this is a static or local constant (but not a uniform, parameter, or specialization constant).
+    bool IsCompileTimeConst() const;
+
     // Sets a custom type denoter, or the default type denoter if the parameter is null.
     void SetCustomTypeDenoter(const TypeDenoterPtr& typeDenoter);
 
@@ -603,6 +621,7 @@ struct VarDecl : public Decl
 
     TypeDenoterPtr                  customTypeDenoter;              // Optional type denoter which can be different from the type of its declaration statement.
     Variant                         initializerValue;               // Optional variant of the initializer value (if the initializer is a constant expression).
+    int                             specConstantID      = -1;       // Vulkan specialization constant ID, or -1 if this is not a specialization constant.
 
     VarDeclStmnt*                   declStmntRef        = nullptr;  // Reference to its declaration statement (parent node). May be null.
     UniformBufferDecl*              bufferDeclRef       = nullptr;  // Reference to its uniform buffer declaration (optional parent-parent-node). May be null.
@@ -870,6 +889,21 @@ struct UniformBufferDecl : public Decl
 {
     AST_INTERFACE(UniformBufferDecl);
 
+    FLAG_ENUM
+    {
+        FLAG( isReorderable,  2 ), // Members of this uniform buffer can be reordered to minimize its size (see UniformPacker::ReorderMembers).
+        FLAG( isPushConstant, 3 ), // This uniform buffer is mapped to a push constant block (only for VKSL output).
+    };
+
+    // Range of variable members of a constant buffer that has been merged into this uniform buffer (see UniformPacker::MergeBuffers).
+    struct MergedBuffer
+    {
+        std::string                 ident;              // Identifier of the original constant buffer.
+        std::vector<RegisterPtr>    slotRegisters;      // Slot register list of the original constant buffer. May be empty.
+        std::size_t                 firstMember = 0;    // Index of the first variable member statement (see 'varMembers' member).
+        std::size_t                 numMembers  = 0;    // Number of variable member statements.
+    };
+
     TypeDenoterPtr DeriveTypeDenoter(const TypeDenoter* expectedTypeDenoter) override;
 
     std::string ToString() const override;
@@ -880,6 +914,9 @@ struct UniformBufferDecl : public Decl
     // Accumulates the vector size of the entire uniform buffer (with 16 byte alignemnd for each vector), and return true on success.
     bool AccumAlignedVectorSize(unsigned int& size, unsigned int& padding, unsigned int* offset = nullptr);
 
+    // Accumulates the padding to align the specified variable member to 16 bytes, if it is the first member of a merged constant buffer.
+    void AccumMergedBufferPadding(std::size_t memberIndex, unsigned int& size, unsigned int& padding) const;
+
     UniformBufferType               bufferType          = UniformBufferType::Undefined; // Type of this uniform buffer. Must not be undefined.
     std::vector<RegisterPtr>        slotRegisters;                                      // Slot register list. May be empty.
     std::vector<StmntPtr>           localStmnts;                                        // Local declaration statements.
@@ -887,6 +924,9 @@ struct UniformBufferDecl : public Decl
     std::vector<VarDeclStmntPtr>    varMembers;                                         // List of all member variable declaration statements.
     TypeModifier                    commonStorageLayout = TypeModifier::ColumnMajor;    // Type modifier of the common matrix/vector storage.
 
+    std::string                     updateFrequency;                                    // Update frequency tag (e.g. "PerFrame"). May be empty.
+    std::vector<MergedBuffer>       mergedBuffers;                                      // Ranges of all constant buffers that have been merged into this uniform buffer.
+
     BasicDeclStmnt*                 declStmntRef        = nullptr;                      // Reference to its declaration statement (parent node). Must not be null.
 };
 
@@ -937,6 +977,7 @@ struct VarDeclStmnt : public Stmnt
         FLAG( isSelfParameter,  3 ), // This variable is the 'self' parameter of a member function.
         FLAG( isBaseMember,     4 ), // This variable is the 'base' member of a structure with inheritance.
         FLAG( isImplicitConst,  5 ), // This variable is implicitly declared as constant.
+        FLAG( isGlobal,         6 ), // This variable is declared in the global scope (also as member of a uniform buffer).
     };
 
     // Implements Stmnt::CollectDeclIdents
@@ -963,6 +1004,9 @@ struct VarDeclStmnt : public Stmnt
     // Returns true if the 'const' type modifier or the 'uniform' input modifier is set.
     bool IsConstOrUniform() const;
 
+    // Returns true if any of the variables is a Vulkan specialization constant.
+    bool HasSpecConstants() const;
+
     // Inserts the specified type modifier. Overlapping matrix packings will be removed.
     void SetTypeModifier(const TypeModifier modifier);
 
@@ -1187,6 +1231,9 @@ struct BinaryExpr : public Expr
 {
     AST_INTERFACE(BinaryExpr);
 
+    // Releases the chain of left-hand-side binary expressions iteratively (to avoid deep recursion).
+    ~BinaryExpr();
+
     TypeDenoterPtr DeriveTypeDenoter(const TypeDenoter* expectedTypeDenoter) override;
 
     const Expr* Find(const FindPredicateConstFunctor& predicate, unsigned int flags = SearchAll) const override;
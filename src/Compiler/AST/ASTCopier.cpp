@@ -0,0 +1,485 @@
+/*
+ * ASTCopier.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ASTCopier.h"
+#include "Exception.h"
+#include "ReportIdents.h"
+
+
+namespace Xsc
+{
+
+
+// Makes a new AST node with the source area and flags of the specified AST node.
+template <typename T>
+std::shared_ptr<T> MakeASTCopy(const T* ast)
+{
+    auto copy = std::make_shared<T>(ast->area);
+    copy->flags = ast->flags;
+    return copy;
+}
+
+StmntPtr ASTCopier::CopyStmnt(const Stmnt* ast)
+{
+    if (!ast)
+        return nullptr;
+
+    StmntPtr stmnt;
+
+    switch (ast->Type())
+    {
+        case AST::Types::NullStmnt:
+        {
+            stmnt = MakeASTCopy(static_cast<const NullStmnt*>(ast));
+        }
+        break;
+
+        case AST::Types::CodeBlockStmnt:
+        {
+            auto src = static_cast<const CodeBlockStmnt*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->codeBlock = CopyCodeBlock(src->codeBlock.get());
+            }
+            stmnt = dst;
+        }
+        break;
+
+        case AST::Types::VarDeclStmnt:
+        {
+            stmnt = CopyVarDeclStmnt(static_cast<const VarDeclStmnt*>(ast));
+        }
+        break;
+
+        case AST::Types::ForLoopStmnt:
+        {
+            auto src = static_cast<const ForLoopStmnt*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->initStmnt  = CopyStmnt(src->initStmnt.get());
+                dst->condition  = CopyExpr(src->condition.get());
+                dst->iteration  = CopyExpr(src->iteration.get());
+                dst->bodyStmnt  = CopyStmnt(src->bodyStmnt.get());
+            }
+            stmnt = dst;
+        }
+        break;
+
+        case AST::Types::WhileLoopStmnt:
+        {
+            auto src = static_cast<const WhileLoopStmnt*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->condition  = CopyExpr(src->condition.get());
+                dst->bodyStmnt  = CopyStmnt(src->bodyStmnt.get());
+            }
+            stmnt = dst;
+        }
+        break;
+
+        case AST::Types::DoWhileLoopStmnt:
+        {
+            auto src = static_cast<const DoWhileLoopStmnt*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->bodyStmnt  = CopyStmnt(src->bodyStmnt.get());
+                dst->condition  = CopyExpr(src->condition.get());
+            }
+            stmnt = dst;
+        }
+        break;
+
+        case AST::Types::IfStmnt:
+        {
+            auto src = static_cast<const IfStmnt*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->condition = CopyExpr(src->condition.get());
+                dst->bodyStmnt = CopyStmnt(src->bodyStmnt.get());
+                if (src->elseStmnt)
+                {
+                    auto elseStmnt = MakeASTCopy(src->elseStmnt.get());
+                    {
+                        elseStmnt->bodyStmnt = CopyStmnt(src->elseStmnt->bodyStmnt.get());
+                    }
+                    dst->elseStmnt = elseStmnt;
+                }
+            }
+            stmnt = dst;
+        }
+        break;
+
+        case AST::Types::SwitchStmnt:
+        {
+            auto src = static_cast<const SwitchStmnt*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->selector = CopyExpr(src->selector.get());
+                for (const auto& switchCase : src->cases)
+                    dst->cases.push_back(CopySwitchCase(switchCase.get()));
+            }
+            stmnt = dst;
+        }
+        break;
+
+        case AST::Types::ExprStmnt:
+        {
+            auto src = static_cast<const ExprStmnt*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->expr = CopyExpr(src->expr.get());
+            }
+            stmnt = dst;
+        }
+        break;
+
+        case AST::Types::ReturnStmnt:
+        {
+            auto src = static_cast<const ReturnStmnt*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->expr = CopyExpr(src->expr.get());
+            }
+            stmnt = dst;
+        }
+        break;
+
+        case AST::Types::CtrlTransferStmnt:
+        {
+            auto src = static_cast<const CtrlTransferStmnt*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->transfer = src->transfer;
+            }
+            stmnt = dst;
+        }
+        break;
+
+        default:
+        {
+            RuntimeErr(R_CantCopyASTNode, ast);
+        }
+        break;
+    }
+
+    /* Copy common statement attributes */
+    stmnt->comment = ast->comment;
+    for (const auto& attrib : ast->attribs)
+        stmnt->attribs.push_back(CopyAttribute(attrib.get()));
+
+    return stmnt;
+}
+
+ExprPtr ASTCopier::CopyExpr(const Expr* ast)
+{
+    if (!ast)
+        return nullptr;
+
+    switch (ast->Type())
+    {
+        case AST::Types::NullExpr:
+        {
+            return MakeASTCopy(static_cast<const NullExpr*>(ast));
+        }
+
+        case AST::Types::SequenceExpr:
+        {
+            auto src = static_cast<const SequenceExpr*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                CopyExprList(dst->exprs, src->exprs);
+            }
+            return dst;
+        }
+
+        case AST::Types::LiteralExpr:
+        {
+            auto src = static_cast<const LiteralExpr*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->value      = src->value;
+                dst->dataType   = src->dataType;
+            }
+            return dst;
+        }
+
+        case AST::Types::TernaryExpr:
+        {
+            auto src = static_cast<const TernaryExpr*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->condExpr = CopyExpr(src->condExpr.get());
+                dst->thenExpr = CopyExpr(src->thenExpr.get());
+                dst->elseExpr = CopyExpr(src->elseExpr.get());
+            }
+            return dst;
+        }
+
+        case AST::Types::BinaryExpr:
+        {
+            auto src = static_cast<const BinaryExpr*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->lhsExpr    = CopyExpr(src->lhsExpr.get());
+                dst->op         = src->op;
+                dst->rhsExpr    = CopyExpr(src->rhsExpr.get());
+            }
+            return dst;
+        }
+
+        case AST::Types::UnaryExpr:
+        {
+            auto src = static_cast<const UnaryExpr*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->op     = src->op;
+                dst->expr   = CopyExpr(src->expr.get());
+            }
+            return dst;
+        }
+
+        case AST::Types::PostUnaryExpr:
+        {
+            auto src = static_cast<const PostUnaryExpr*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->expr   = CopyExpr(src->expr.get());
+                dst->op     = src->op;
+            }
+            return dst;
+        }
+
+        case AST::Types::CallExpr:
+        {
+            auto src = static_cast<const CallExpr*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->prefixExpr         = CopyExpr(src->prefixExpr.get());
+                dst->isStatic           = src->isStatic;
+                dst->ident              = src->ident;
+                dst->typeDenoter        = src->typeDenoter;
+                CopyExprList(dst->arguments, src->arguments);
+                dst->funcDeclRef        = src->funcDeclRef;
+                dst->intrinsic          = src->intrinsic;
+                dst->defaultParamRefs   = src->defaultParamRefs;
+            }
+            return dst;
+        }
+
+        case AST::Types::BracketExpr:
+        {
+            auto src = static_cast<const BracketExpr*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->expr = CopyExpr(src->expr.get());
+            }
+            return dst;
+        }
+
+        case AST::Types::AssignExpr:
+        {
+            auto src = static_cast<const AssignExpr*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->lvalueExpr = CopyExpr(src->lvalueExpr.get());
+                dst->op         = src->op;
+                dst->rvalueExpr = CopyExpr(src->rvalueExpr.get());
+            }
+            return dst;
+        }
+
+        case AST::Types::ObjectExpr:
+        {
+            auto src = static_cast<const ObjectExpr*>(ast);
+
+            /* Replace reference to symbol by its replacement expression */
+            if (!src->prefixExpr && src->symbolRef)
+            {
+                auto it = symbolExprs_.find(src->symbolRef);
+                if (it != symbolExprs_.end())
+                    return CopyExpr(it->second.get());
+            }
+
+            auto dst = MakeASTCopy(src);
+            {
+                dst->prefixExpr = CopyExpr(src->prefixExpr.get());
+                dst->isStatic   = src->isStatic;
+                dst->ident      = src->ident;
+                dst->symbolRef  = FetchSymbolCopy(src->symbolRef);
+            }
+            return dst;
+        }
+
+        case AST::Types::ArrayExpr:
+        {
+            auto src = static_cast<const ArrayExpr*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->prefixExpr = CopyExpr(src->prefixExpr.get());
+                CopyExprList(dst->arrayIndices, src->arrayIndices);
+            }
+            return dst;
+        }
+
+        case AST::Types::CastExpr:
+        {
+            auto src = static_cast<const CastExpr*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                dst->typeSpecifier  = CopyTypeSpecifier(src->typeSpecifier.get());
+                dst->expr           = CopyExpr(src->expr.get());
+            }
+            return dst;
+        }
+
+        case AST::Types::InitializerExpr:
+        {
+            auto src = static_cast<const InitializerExpr*>(ast);
+            auto dst = MakeASTCopy(src);
+            {
+                CopyExprList(dst->exprs, src->exprs);
+            }
+            return dst;
+        }
+
+        default:
+        break;
+    }
+
+    RuntimeErr(R_CantCopyASTNode, ast);
+}
+
+void ASTCopier::ReplaceSymbol(const Decl* symbol, const ExprPtr& expr)
+{
+    symbolExprs_[symbol] = expr;
+}
+
+void ASTCopier::SetVarIdentPrefix(const std::string& prefix)
+{
+    varIdentPrefix_ = prefix;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+CodeBlockPtr ASTCopier::CopyCodeBlock(const CodeBlock* ast)
+{
+    auto copy = MakeASTCopy(ast);
+    {
+        CopyStmntList(copy->stmnts, ast->stmnts);
+    }
+    return copy;
+}
+
+SwitchCasePtr ASTCopier::CopySwitchCase(const SwitchCase* ast)
+{
+    auto copy = MakeASTCopy(ast);
+    {
+        copy->expr = CopyExpr(ast->expr.get());
+        CopyStmntList(copy->stmnts, ast->stmnts);
+    }
+    return copy;
+}
+
+AttributePtr ASTCopier::CopyAttribute(const Attribute* ast)
+{
+    auto copy = MakeASTCopy(ast);
+    {
+        copy->attributeType = ast->attributeType;
+        CopyExprList(copy->arguments, ast->arguments);
+    }
+    return copy;
+}
+
+TypeSpecifierPtr ASTCopier::CopyTypeSpecifier(const TypeSpecifier* ast)
+{
+    /* Inner structure declarations can not be copied */
+    if (ast->structDecl)
+        RuntimeErr(R_CantCopyASTNode, ast->structDecl.get());
+
+    auto copy = MakeASTCopy(ast);
+    {
+        copy->isInput           = ast->isInput;
+        copy->isOutput          = ast->isOutput;
+        copy->isUniform         = ast->isUniform;
+        copy->storageClasses    = ast->storageClasses;
+        copy->interpModifiers   = ast->interpModifiers;
+        copy->typeModifiers     = ast->typeModifiers;
+        copy->primitiveType     = ast->primitiveType;
+        copy->typeDenoter       = ast->typeDenoter;
+    }
+    return copy;
+}
+
+ArrayDimensionPtr ASTCopier::CopyArrayDimension(const ArrayDimension* ast)
+{
+    auto copy = MakeASTCopy(ast);
+    {
+        copy->expr  = CopyExpr(ast->expr.get());
+        copy->size  = ast->size;
+    }
+    return copy;
+}
+
+VarDeclStmntPtr ASTCopier::CopyVarDeclStmnt(const VarDeclStmnt* ast)
+{
+    auto copy = MakeASTCopy(ast);
+    {
+        copy->typeSpecifier = CopyTypeSpecifier(ast->typeSpecifier.get());
+
+        for (const auto& src : ast->varDecls)
+        {
+            auto dst = MakeASTCopy(src.get());
+            {
+                dst->ident              = src->ident;
+                for (const auto& arrayDim : src->arrayDims)
+                    dst->arrayDims.push_back(CopyArrayDimension(arrayDim.get()));
+                dst->semantic           = src->semantic;
+                dst->initializer        = CopyExpr(src->initializer.get());
+                dst->customTypeDenoter  = src->customTypeDenoter;
+                dst->initializerValue   = src->initializerValue;
+                dst->declStmntRef       = copy.get();
+            }
+            if (!varIdentPrefix_.empty())
+                dst->ident.AppendPrefix(varIdentPrefix_);
+            copy->varDecls.push_back(dst);
+
+            /* Redirect all following references to the copied variable */
+            symbolCopies_[src.get()] = dst.get();
+        }
+    }
+    return copy;
+}
+
+void ASTCopier::CopyStmntList(std::vector<StmntPtr>& dst, const std::vector<StmntPtr>& src)
+{
+    dst.reserve(src.size());
+    for (const auto& stmnt : src)
+        dst.push_back(CopyStmnt(stmnt.get()));
+}
+
+void ASTCopier::CopyExprList(std::vector<ExprPtr>& dst, const std::vector<ExprPtr>& src)
+{
+    dst.reserve(src.size());
+    for (const auto& expr : src)
+        dst.push_back(CopyExpr(expr.get()));
+}
+
+Decl* ASTCopier::FetchSymbolCopy(Decl* symbol) const
+{
+    auto it = symbolCopies_.find(symbol);
+    return (it != symbolCopies_.end() ? it->second : symbol);
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
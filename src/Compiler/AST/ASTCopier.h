@@ -0,0 +1,72 @@
+/*
+ * ASTCopier.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_AST_COPIER_H
+#define XSC_AST_COPIER_H
+
+
+#include "AST.h"
+#include <map>
+#include <string>
+
+
+namespace Xsc
+{
+
+
+/*
+Deep copier for statements and expressions of function bodies (e.g. for loop unrolling).
+Local variables are copied as well, and all references to them are redirected to their copies.
+Structure and alias declarations can not be copied, in which case a runtime error is thrown.
+*/
+class ASTCopier
+{
+
+    public:
+
+        // Returns a deep copy of the specified statement, or throws a runtime error if the statement can not be copied.
+        StmntPtr CopyStmnt(const Stmnt* ast);
+
+        // Returns a deep copy of the specified expression, or throws a runtime error if the expression can not be copied.
+        ExprPtr CopyExpr(const Expr* ast);
+
+        // Replaces all references to the specified declaration object by a copy of the specified expression (e.g. the induction variable by a literal).
+        void ReplaceSymbol(const Decl* symbol, const ExprPtr& expr);
+
+        // Sets the prefix that is appended to the identifiers of all copied variables (e.g. to avoid name collisions of inlined functions).
+        void SetVarIdentPrefix(const std::string& prefix);
+
+    private:
+
+        CodeBlockPtr        CopyCodeBlock(const CodeBlock* ast);
+        SwitchCasePtr       CopySwitchCase(const SwitchCase* ast);
+        AttributePtr        CopyAttribute(const Attribute* ast);
+        TypeSpecifierPtr    CopyTypeSpecifier(const TypeSpecifier* ast);
+        ArrayDimensionPtr   CopyArrayDimension(const ArrayDimension* ast);
+        VarDeclStmntPtr     CopyVarDeclStmnt(const VarDeclStmnt* ast);
+
+        void CopyStmntList(std::vector<StmntPtr>& dst, const std::vector<StmntPtr>& src);
+        void CopyExprList(std::vector<ExprPtr>& dst, const std::vector<ExprPtr>& src);
+
+        // Returns the copy of the specified declaration object, or the declaration object itself if it has not been copied.
+        Decl* FetchSymbolCopy(Decl* symbol) const;
+
+        std::map<const Decl*, Decl*>    symbolCopies_;  // Copied declaration objects.
+        std::map<const Decl*, ExprPtr>  symbolExprs_;   // Expressions that replace references to a declaration object.
+        std::string                     varIdentPrefix_;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
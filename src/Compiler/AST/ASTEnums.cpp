@@ -1168,7 +1168,7 @@ bool IsGLSLAttributeType(const AttributeType t)
 
 bool IsExtAttributeType(const AttributeType t)
 {
-    return (t >= AttributeType::Space && t <= AttributeType::Layout);
+    return (t >= AttributeType::Space && t <= AttributeType::UpdateFrequency);
 }
 
 #endif
@@ -1224,6 +1224,29 @@ bool IsInterlockedIntristic(const Intrinsic t)
     return (t >= Intrinsic::InterlockedAdd && t <= Intrinsic::InterlockedXor);
 }
 
+bool HasIntrinsicSideEffects(const Intrinsic t)
+{
+    switch (t)
+    {
+        case Intrinsic::Abort:
+        case Intrinsic::AllMemoryBarrier:
+        case Intrinsic::AllMemoryBarrierWithGroupSync:
+        case Intrinsic::Clip:
+        case Intrinsic::DeviceMemoryBarrier:
+        case Intrinsic::DeviceMemoryBarrierWithGroupSync:
+        case Intrinsic::GroupMemoryBarrier:
+        case Intrinsic::GroupMemoryBarrierWithGroupSync:
+            return true;
+        default:
+            return
+            (
+                IsInterlockedIntristic(t)   ||
+                IsStreamOutputIntrinsic(t)  ||
+                (t >= Intrinsic::Image_Store && t <= Intrinsic::Image_AtomicExchange)
+            );
+    }
+}
+
 bool IsTextureGatherIntrisic(const Intrinsic t)
 {
     return (t >= Intrinsic::Texture_Gather_2 && t <= Intrinsic::Texture_GatherCmpAlpha_8);
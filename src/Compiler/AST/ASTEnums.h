@@ -725,6 +725,9 @@ enum class AttributeType
     /* --- Extended Attributes --- */
     Space,                      // Extended attribute to specify a vector space.
     Layout,                     // Extended attribute to specify a layout format.
+    ConstantID,                 // Extended attribute to specify a Vulkan specialization constant ID.
+    ReorderMembers,             // Extended attribute to allow reordering the members of a constant buffer.
+    UpdateFrequency,            // Extended attribute to specify the update frequency of a constant buffer.
 
     #endif
 };
@@ -743,7 +746,7 @@ bool IsGLSLAttributeType(const AttributeType t);
 
 #ifdef XSC_ENABLE_LANGUAGE_EXT
 
-// Returns true if the specified attribute is an extended attribute, i.e. AttributeType::Space, AttributeType::Layout.
+// Returns true if the specified attribute is an extended attribute, i.e. AttributeType::Space, AttributeType::Layout, AttributeType::ConstantID.
 bool IsExtAttributeType(const AttributeType t);
 
 #endif
@@ -1095,6 +1098,9 @@ bool IsImageIntrinsic(const Intrinsic t);
 // Returns true if the specified intrinsic in an interlocked intrinsic (e.g. Intrinsic::InterlockedAdd).
 bool IsInterlockedIntristic(const Intrinsic t);
 
+// Returns true if the specified intrinsic has side effects besides its return value (e.g. Intrinsic::Clip, Intrinsic::GroupMemoryBarrier).
+bool HasIntrinsicSideEffects(const Intrinsic t);
+
 // Returns the respective intrinsic for the specified binary compare operator, or Intrinsic::Undefined if the operator is not a compare operator.
 Intrinsic CompareOpToIntrinsic(const BinaryOp op);
 
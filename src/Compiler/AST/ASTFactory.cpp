@@ -119,6 +119,16 @@ BinaryExprPtr MakeBinaryExpr(const ExprPtr& lhsExpr, const BinaryOp op, const Ex
     return ast;
 }
 
+UnaryExprPtr MakeUnaryExpr(const UnaryOp op, const ExprPtr& expr)
+{
+    auto ast = MakeAST<UnaryExpr>();
+    {
+        ast->op     = op;
+        ast->expr   = expr;
+    }
+    return ast;
+}
+
 LiteralExprPtr MakeLiteralExpr(const DataType literalType, const std::string& literalValue)
 {
     auto ast = MakeAST<LiteralExpr>();
@@ -134,11 +144,11 @@ LiteralExprPtr MakeLiteralExprOrNull(const Variant& literalValue)
     switch (literalValue.Type())
     {
         case Variant::Types::Bool:
-            return MakeLiteralExpr(DataType::Bool, std::to_string(literalValue.Bool()));
+            return MakeLiteralExpr(DataType::Bool, literalValue.ToString());
         case Variant::Types::Int:
-            return MakeLiteralExpr(DataType::Int, std::to_string(literalValue.Int()));
+            return MakeLiteralExpr(DataType::Int, literalValue.ToString());
         case Variant::Types::Real:
-            return MakeLiteralExpr(DataType::Float, std::to_string(literalValue.Real()));
+            return MakeLiteralExpr(DataType::Float, literalValue.ToString() + "f");
         default:
             return nullptr;
     }
@@ -431,6 +441,11 @@ CodeBlockStmntPtr MakeCodeBlockStmnt(const StmntPtr& stmnt)
     return ast;
 }
 
+NullStmntPtr MakeNullStmnt()
+{
+    return MakeAST<NullStmnt>();
+}
+
 BasicDeclStmntPtr MakeStructDeclStmnt(const StructDeclPtr& structDecl)
 {
     auto ast = MakeAST<BasicDeclStmnt>();
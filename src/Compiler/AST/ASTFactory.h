@@ -43,11 +43,12 @@ CastExprPtr                     MakeCastExpr(const TypeDenoterPtr& typeDenoter,
 CastExprPtr                     MakeLiteralCastExpr(const TypeDenoterPtr& typeDenoter, const DataType literalType, const std::string& literalValue);
 
 BinaryExprPtr                   MakeBinaryExpr(const ExprPtr& lhsExpr, const BinaryOp op, const ExprPtr& rhsExpr);
+UnaryExprPtr                    MakeUnaryExpr(const UnaryOp op, const ExprPtr& expr);
 
 // Makes a new LiteralExpr of the specified data type and literal value.
 LiteralExprPtr                  MakeLiteralExpr(const DataType literalType, const std::string& literalValue);
 
-// Makes a new LiteralExpr if the specified variant is either a boolean, integral, or real type. Otherwise, null is returned.
+// Makes a new LiteralExpr if the specified variant is either a boolean, integral, or real type (with 'f' suffix, like converted float literals). Otherwise, null is returned.
 LiteralExprPtr                  MakeLiteralExprOrNull(const Variant& literalValue);
 
 AliasDeclStmntPtr               MakeBaseTypeAlias(const DataType dataType, const std::string& ident);
@@ -101,6 +102,8 @@ ArrayDimensionPtr               MakeArrayDimension(int arraySize);
 // Makes a code block statement with initial code block and the specified statement inserted.
 CodeBlockStmntPtr               MakeCodeBlockStmnt(const StmntPtr& stmnt);
 
+NullStmntPtr                    MakeNullStmnt();
+
 BasicDeclStmntPtr               MakeStructDeclStmnt(const StructDeclPtr& structDecl);
 
 // Makes a uniform buffer declaration with the specified identifier.
@@ -46,17 +46,6 @@ std::string SourcePosition::ToString(bool printFilename) const
     return s;
 }
 
-void SourcePosition::IncRow()
-{
-    ++row_;
-    column_ = 0;
-}
-
-void SourcePosition::IncColumn()
-{
-    ++column_;
-}
-
 bool SourcePosition::IsValid() const
 {
     return (row_ > 0 && column_ > 0);
@@ -47,10 +47,17 @@ class SourcePosition
         std::string ToString(bool printFilename = true) const;
 
         // Increases the row by 1 and sets the column to 0.
-        void IncRow();
+        inline void IncRow()
+        {
+            ++row_;
+            column_ = 0;
+        }
 
-        // Increases the column by 1.
-        void IncColumn();
+        // Increases the column by the specified number (by 1 by default).
+        inline void IncColumn(unsigned int n = 1)
+        {
+            column_ += n;
+        }
 
         // Returns true if this is a valid source position. False if row and column are 0.
         bool IsValid() const;
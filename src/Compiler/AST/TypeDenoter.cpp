@@ -9,6 +9,7 @@
 #include "Exception.h"
 #include "AST.h"
 #include "ReportIdents.h"
+#include "Profiler.h"
 #include <algorithm>
 
 
@@ -166,6 +167,11 @@ bool operator != (const VectorSpace& lhs, const VectorSpace& rhs)
 
 /* ----- TypeDenoter ----- */
 
+TypeDenoter::TypeDenoter()
+{
+    Profiler::CountTypeDenoter();
+}
+
 TypeDenoter::~TypeDenoter()
 {
     // dummy
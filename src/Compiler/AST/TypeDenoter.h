@@ -116,6 +116,7 @@ struct TypeDenoter : std::enable_shared_from_this<TypeDenoter>
 
     /* ----- Common ----- */
 
+    TypeDenoter();
     virtual ~TypeDenoter();
 
     // Returns the type (kind) of this type denoter.
@@ -743,6 +743,22 @@ ASTPrinter::PrintableTree* ASTPrinter::TopPrintable()
         return parentNodeStack_.top();
 }
 
+bool ASTPrinter::OmitSubNodes(const AST* ast)
+{
+    /* Limit tree depth to avoid deep recursion (e.g. for sums of thousands of terms) */
+    static const std::size_t maxTreeDepth = 256;
+
+    if (parentNodeStack_.size() < maxTreeDepth)
+        return false;
+
+    /* Add single placeholder for all omitted sub nodes */
+    const auto& children = TopPrintable()->children;
+    if (children.empty() || children.back().label != "...")
+        Printable(ast, "...");
+
+    return true;
+}
+
 void ASTPrinter::PushMemberName(const std::string& name)
 {
     memberNameStack_.push(name);
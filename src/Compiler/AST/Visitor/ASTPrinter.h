@@ -102,7 +102,7 @@ class ASTPrinter : private Visitor
         template <typename T>
         void VisitMember(T ast, const std::string& name)
         {
-            if (ast)
+            if (ast && !OmitSubNodes(ast.get()))
             {
                 PushMemberName(name);
                 ast->Visit(this, nullptr);
@@ -128,6 +128,9 @@ class ASTPrinter : private Visitor
 
         PrintableTree* TopPrintable();
 
+        // Returns true if the sub nodes of the specified AST must be omitted, because the maximal tree depth has been reached.
+        bool OmitSubNodes(const AST* ast);
+
         void PushMemberName(const std::string& name);
         void PopMemberName();
 
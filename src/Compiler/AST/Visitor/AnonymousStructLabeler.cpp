@@ -0,0 +1,66 @@
+/*
+ * AnonymousStructLabeler.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "AnonymousStructLabeler.h"
+#include "AST.h"
+
+
+namespace Xsc
+{
+
+
+void AnonymousStructLabeler::LabelAnonymousStructs(Program& program, const NameMangling& nameMangling)
+{
+    nameMangling_   = (&nameMangling);
+    anonymCounter_  = 0;
+    Visit(&program);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void AnonymousStructLabeler::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+IMPLEMENT_VISIT_PROC(StructDecl)
+{
+    if (ast->IsAnonymous())
+    {
+        /* Set identifier to "{TempPrefix}anonym{AnonymousCounter}" (see Converter::LabelAnonymousDecl) */
+        ast->ident = nameMangling_->temporaryPrefix + "anonym" + std::to_string(anonymCounter_);
+        ++anonymCounter_;
+    }
+
+    VISIT_DEFAULT(StructDecl);
+}
+
+IMPLEMENT_VISIT_PROC(AliasDeclStmnt)
+{
+    /* Use first alias name as structure name (see GLSLConverter::VisitAliasDeclStmnt) */
+    if (ast->structDecl && ast->structDecl->ident.Empty() && !ast->aliasDecls.empty())
+    {
+        ast->structDecl->ident = ast->aliasDecls.front()->ident;
+
+        for (auto& aliasDecl : ast->aliasDecls)
+            aliasDecl->typeDenoter->SetIdentIfAnonymous(ast->structDecl->ident);
+    }
+
+    VISIT_DEFAULT(AliasDeclStmnt);
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
@@ -0,0 +1,55 @@
+/*
+ * AnonymousStructLabeler.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_ANONYMOUS_STRUCT_LABELER_H
+#define XSC_ANONYMOUS_STRUCT_LABELER_H
+
+
+#include "Visitor.h"
+#include <Xsc/Xsc.h>
+
+
+namespace Xsc
+{
+
+
+/*
+Anonymous structure labeler AST visitor.
+This helper class for the code reflection (when code conversion is skipped) names all anonymous structures
+in the same way as the code converter does, i.e. by the first alias name of a type alias declaration,
+or by "{TempPrefix}anonym{AnonymousCounter}" in order of their declaration.
+*/
+class AnonymousStructLabeler : private Visitor
+{
+
+    public:
+
+        void LabelAnonymousStructs(Program& program, const NameMangling& nameMangling);
+
+    private:
+
+        /* ----- Visitor implementation ----- */
+
+        DECL_VISIT_PROC( StructDecl     );
+        DECL_VISIT_PROC( AliasDeclStmnt );
+
+        /* === Members === */
+
+        const NameMangling* nameMangling_   = nullptr;
+        unsigned int        anonymCounter_  = 0;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
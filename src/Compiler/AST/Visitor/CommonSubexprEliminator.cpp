@@ -0,0 +1,883 @@
+/*
+ * CommonSubexprEliminator.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CommonSubexprEliminator.h"
+#include "IntrinsicAdept.h"
+#include "ASTFactory.h"
+#include "AST.h"
+#include "Helper.h"
+#include <algorithm>
+#include <cstdint>
+
+
+namespace Xsc
+{
+
+
+/* Maximal number of AST nodes of an expression that is considered for elimination */
+static const std::size_t g_maxExprNodes = 32;
+
+/* Minimal cost of an expression that is worth being stored in a temporary variable (see EstimateExprCost) */
+static const std::size_t g_minExprCost = 2;
+
+void CommonSubexprEliminator::EliminateCommonSubexprs(Program& program, const NameMangling& nameMangling)
+{
+    nameMangling_ = (&nameMangling);
+    Visit(&program);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+/* --- Statement processing --- */
+
+void CommonSubexprEliminator::ProcessFunctionBody(FunctionDecl* funcDecl)
+{
+    exprEntries_.clear();
+    availableExprs_.clear();
+    writeTimes_.clear();
+
+    declOrderCounter_   = 0;
+    writeCounter_       = 0;
+    writeAllTime_       = 0;
+    anchorStmnt_        = AnchorStmnt();
+
+    ProcessStmntList(funcDecl->codeBlock->stmnts, true);
+
+    HoistExprEntries();
+}
+
+// Returns true if the specified statement or any of its nested statements is a return, discard, break, or continue statement.
+static bool ContainsEarlyExit(const Stmnt* stmnt)
+{
+    if (!stmnt)
+        return false;
+
+    switch (stmnt->Type())
+    {
+        case AST::Types::ReturnStmnt:
+        case AST::Types::CtrlTransferStmnt:
+            return true;
+
+        case AST::Types::CodeBlockStmnt:
+        {
+            for (const auto& subStmnt : static_cast<const CodeBlockStmnt*>(stmnt)->codeBlock->stmnts)
+            {
+                if (ContainsEarlyExit(subStmnt.get()))
+                    return true;
+            }
+            return false;
+        }
+
+        case AST::Types::IfStmnt:
+        {
+            auto ifStmnt = static_cast<const IfStmnt*>(stmnt);
+            return (ContainsEarlyExit(ifStmnt->bodyStmnt.get()) || (ifStmnt->elseStmnt && ContainsEarlyExit(ifStmnt->elseStmnt->bodyStmnt.get())));
+        }
+
+        case AST::Types::ForLoopStmnt:
+            return ContainsEarlyExit(static_cast<const ForLoopStmnt*>(stmnt)->bodyStmnt.get());
+
+        case AST::Types::WhileLoopStmnt:
+            return ContainsEarlyExit(static_cast<const WhileLoopStmnt*>(stmnt)->bodyStmnt.get());
+
+        case AST::Types::DoWhileLoopStmnt:
+            return ContainsEarlyExit(static_cast<const DoWhileLoopStmnt*>(stmnt)->bodyStmnt.get());
+
+        case AST::Types::SwitchStmnt:
+        {
+            for (const auto& switchCase : static_cast<const SwitchStmnt*>(stmnt)->cases)
+            {
+                for (const auto& subStmnt : switchCase->stmnts)
+                {
+                    if (ContainsEarlyExit(subStmnt.get()))
+                        return true;
+                }
+            }
+            return false;
+        }
+
+        default:
+            return false;
+    }
+}
+
+void CommonSubexprEliminator::ProcessStmntList(std::vector<StmntPtr>& stmnts, bool allowNewEntries)
+{
+    auto prevStmnts             = activeStmnts_;
+    auto prevStmntIndex         = activeStmntIndex_;
+    auto prevAllowNewEntries    = allowNewEntries_;
+
+    activeStmnts_ = (&stmnts);
+
+    for (std::size_t i = 0; i < stmnts.size(); ++i)
+    {
+        if (!stmnts[i]->flags(AST::isDeadCode))
+        {
+            activeStmntIndex_   = i;
+            allowNewEntries_    = allowNewEntries;
+            ProcessStmnt(stmnts[i].get());
+
+            /* Following temporaries must not be declared before the enclosing code blocks, once these blocks might have been left early (e.g. after a bounds check) */
+            if (anchorStmnt_.stmnts && ContainsEarlyExit(stmnts[i].get()))
+                anchorStmnt_ = AnchorStmnt();
+        }
+    }
+
+    /* Expressions of this statement list are out of scope for all following statements */
+    for (auto it = availableExprs_.begin(); it != availableExprs_.end();)
+    {
+        if (it->second->stmnts == &stmnts)
+            it = availableExprs_.erase(it);
+        else
+            ++it;
+    }
+
+    activeStmnts_       = prevStmnts;
+    activeStmntIndex_   = prevStmntIndex;
+    allowNewEntries_    = prevAllowNewEntries;
+}
+
+void CommonSubexprEliminator::ProcessStmnt(Stmnt* stmnt)
+{
+    switch (stmnt->Type())
+    {
+        case AST::Types::VarDeclStmnt:
+        {
+            auto varDeclStmnt = static_cast<VarDeclStmnt*>(stmnt);
+
+            /* Temporaries can only be declared before this statement if no initializer reads a previous variable of the same statement */
+            if (varDeclStmnt->varDecls.size() > 1)
+                allowNewEntries_ = false;
+
+            for (auto& varDecl : varDeclStmnt->varDecls)
+            {
+                if (varDecl->initializer)
+                    ProcessExprOrInvalidate(varDecl->initializer);
+
+                /* Declared variables are not visible before this statement */
+                writeTimes_[varDecl.get()] = ++writeCounter_;
+            }
+        }
+        break;
+
+        case AST::Types::ExprStmnt:
+        {
+            auto exprStmnt = static_cast<ExprStmnt*>(stmnt);
+            if (auto assignExpr = exprStmnt->expr->As<AssignExpr>())
+            {
+                /* Collect right-hand side first, since it is evaluated before the variable is written to */
+                if (!HasSideEffects(assignExpr->lvalueExpr.get()) && !HasSideEffects(assignExpr->rvalueExpr.get()))
+                    CollectExpr(assignExpr->rvalueExpr);
+                InvalidateWrites(assignExpr);
+            }
+            else
+                ProcessExprOrInvalidate(exprStmnt->expr);
+        }
+        break;
+
+        case AST::Types::ReturnStmnt:
+        {
+            auto returnStmnt = static_cast<ReturnStmnt*>(stmnt);
+            if (returnStmnt->expr)
+                ProcessExprOrInvalidate(returnStmnt->expr);
+        }
+        break;
+
+        case AST::Types::IfStmnt:
+        {
+            auto ifStmnt = static_cast<IfStmnt*>(stmnt);
+
+            ProcessExprOrInvalidate(ifStmnt->condition);
+
+            ProcessNestedStmnt(ifStmnt->bodyStmnt.get());
+            if (ifStmnt->elseStmnt)
+                ProcessNestedStmnt(ifStmnt->elseStmnt->bodyStmnt.get());
+        }
+        break;
+
+        case AST::Types::CodeBlockStmnt:
+        {
+            ProcessCodeBlockStmnt(static_cast<CodeBlockStmnt*>(stmnt));
+        }
+        break;
+
+        case AST::Types::ForLoopStmnt:
+        case AST::Types::WhileLoopStmnt:
+        case AST::Types::DoWhileLoopStmnt:
+        {
+            /* Invalidate all writes of the loop first, since the loop body can be executed multiple times */
+            InvalidateWrites(stmnt);
+
+            if (auto forLoopStmnt = stmnt->As<ForLoopStmnt>())
+                ProcessNestedStmnt(forLoopStmnt->bodyStmnt.get());
+            else if (auto whileLoopStmnt = stmnt->As<WhileLoopStmnt>())
+                ProcessNestedStmnt(whileLoopStmnt->bodyStmnt.get());
+            else if (auto doWhileLoopStmnt = stmnt->As<DoWhileLoopStmnt>())
+                ProcessNestedStmnt(doWhileLoopStmnt->bodyStmnt.get());
+
+            InvalidateWrites(stmnt);
+        }
+        break;
+
+        case AST::Types::SwitchStmnt:
+        {
+            auto switchStmnt = static_cast<SwitchStmnt*>(stmnt);
+
+            ProcessExprOrInvalidate(switchStmnt->selector);
+
+            /* Case blocks can fall through, so they are processed in order, but they never provide new temporaries */
+            auto prevAnchorStmnt = anchorStmnt_;
+            anchorStmnt_ = AnchorStmnt();
+            {
+                for (auto& switchCase : switchStmnt->cases)
+                    ProcessStmntList(switchCase->stmnts, false);
+            }
+            anchorStmnt_ = prevAnchorStmnt;
+
+            InvalidateWrites(stmnt);
+        }
+        break;
+
+        default:
+        {
+            InvalidateWrites(stmnt);
+        }
+        break;
+    }
+}
+
+void CommonSubexprEliminator::ProcessNestedStmnt(Stmnt* stmnt)
+{
+    if (stmnt)
+    {
+        /* Nested statements are executed conditionally, so their temporaries must not be declared before an enclosing code block */
+        auto prevAnchorStmnt = anchorStmnt_;
+        anchorStmnt_ = AnchorStmnt();
+
+        if (auto codeBlockStmnt = stmnt->As<CodeBlockStmnt>())
+            ProcessStmntList(codeBlockStmnt->codeBlock->stmnts, true);
+        else
+        {
+            /* Single statements (e.g. "if (c) x = y;") have no statement list to declare temporaries in */
+            auto prevAllowNewEntries = allowNewEntries_;
+            allowNewEntries_ = false;
+            {
+                ProcessStmnt(stmnt);
+            }
+            allowNewEntries_ = prevAllowNewEntries;
+        }
+
+        anchorStmnt_ = prevAnchorStmnt;
+    }
+}
+
+void CommonSubexprEliminator::ProcessCodeBlockStmnt(CodeBlockStmnt* codeBlockStmnt)
+{
+    if (!anchorStmnt_.stmnts && allowNewEntries_ && activeStmnts_)
+    {
+        /* Declare temporaries of this and all nested unconditional code blocks before this block, so they are available in the following sibling blocks */
+        anchorStmnt_.stmnts     = activeStmnts_;
+        anchorStmnt_.stmntIndex = activeStmntIndex_;
+        anchorStmnt_.writeTime  = writeCounter_;
+        {
+            ProcessStmntList(codeBlockStmnt->codeBlock->stmnts, true);
+        }
+        anchorStmnt_ = AnchorStmnt();
+    }
+    else
+        ProcessStmntList(codeBlockStmnt->codeBlock->stmnts, true);
+}
+
+void CommonSubexprEliminator::ProcessExprOrInvalidate(ExprPtr& expr)
+{
+    auto writeSet = GatherWrites(expr.get());
+    if (writeSet.writesAll || !writeSet.decls.empty())
+        InvalidateWrites(writeSet);
+    else
+        CollectExpr(expr);
+}
+
+// Returns the estimated cost of the specified expression: Each operator counts one, and each intrinsic call (e.g. a texture sample) counts as much as the minimal cost.
+static std::size_t EstimateExprCost(const Expr* expr)
+{
+    if (!expr)
+        return 0;
+
+    switch (expr->Type())
+    {
+        case AST::Types::ObjectExpr:
+            return EstimateExprCost(static_cast<const ObjectExpr*>(expr)->prefixExpr.get());
+
+        case AST::Types::BinaryExpr:
+        {
+            auto binaryExpr = static_cast<const BinaryExpr*>(expr);
+            return (1 + EstimateExprCost(binaryExpr->lhsExpr.get()) + EstimateExprCost(binaryExpr->rhsExpr.get()));
+        }
+
+        case AST::Types::UnaryExpr:
+            return (1 + EstimateExprCost(static_cast<const UnaryExpr*>(expr)->expr.get()));
+
+        case AST::Types::CallExpr:
+            return g_minExprCost;
+
+        case AST::Types::BracketExpr:
+            return EstimateExprCost(static_cast<const BracketExpr*>(expr)->expr.get());
+
+        case AST::Types::ArrayExpr:
+        {
+            auto arrayExpr = static_cast<const ArrayExpr*>(expr);
+            auto cost = EstimateExprCost(arrayExpr->prefixExpr.get());
+            for (const auto& arrayIndex : arrayExpr->arrayIndices)
+                cost += EstimateExprCost(arrayIndex.get());
+            return cost;
+        }
+
+        case AST::Types::CastExpr:
+            return EstimateExprCost(static_cast<const CastExpr*>(expr)->expr.get());
+
+        default:
+            return 0;
+    }
+}
+
+bool CommonSubexprEliminator::CollectExprEntry(ExprPtr& expr, ExprEntry*& newEntry)
+{
+    newEntry = nullptr;
+
+    if (IsCandidateExpr(*expr))
+    {
+        std::string             key;
+        std::set<const Decl*>   readDecls;
+        std::size_t             numNodes    = 0;
+
+        /* Cheap expressions (e.g. "a + 1") are not worth a temporary variable (the number of nodes is limited by 'MakeExprKey') */
+        if (MakeExprKey(expr.get(), key, readDecls, numNodes) && !readDecls.empty() && EstimateExprCost(expr.get()) >= g_minExprCost)
+        {
+            auto it = availableExprs_.find(key);
+            if (it != availableExprs_.end())
+            {
+                /* Add occurrence to existing entry, and ignore the sub expressions which are already part of the first occurrence */
+                it->second->exprSlots.push_back(&expr);
+                return false;
+            }
+
+            if (allowNewEntries_ && activeStmnts_)
+            {
+                /* Add new entry for the first occurrence of this expression */
+                auto entry = MakeUnique<ExprEntry>();
+                {
+                    entry->exprSlots.push_back(&expr);
+                    entry->readDecls    = std::move(readDecls);
+                    entry->stmnts       = activeStmnts_;
+                    entry->stmntIndex   = activeStmntIndex_;
+                    entry->declOrder    = 0;
+
+                    /* Declare temporary before the enclosing unconditional code blocks, if the expression reads no object that has changed since then */
+                    if (anchorStmnt_.stmnts && !IsWrittenSince(entry->readDecls, anchorStmnt_.writeTime))
+                    {
+                        entry->stmnts       = anchorStmnt_.stmnts;
+                        entry->stmntIndex   = anchorStmnt_.stmntIndex;
+                    }
+                }
+                newEntry = entry.get();
+                availableExprs_[key] = entry.get();
+                exprEntries_.push_back(std::move(entry));
+            }
+        }
+    }
+    return true;
+}
+
+void CommonSubexprEliminator::FinishExprEntry(ExprEntry* entry)
+{
+    if (entry)
+        entry->declOrder = declOrderCounter_++;
+}
+
+void CommonSubexprEliminator::CollectExpr(ExprPtr& expr)
+{
+    ExprEntry* newEntry = nullptr;
+
+    if (!expr || !CollectExprEntry(expr, newEntry))
+        return;
+
+    /* Collect all sub expressions that are evaluated unconditionally */
+    switch (expr->Type())
+    {
+        case AST::Types::SequenceExpr:
+        {
+            for (auto& subExpr : static_cast<SequenceExpr*>(expr.get())->exprs)
+                CollectExpr(subExpr);
+        }
+        break;
+
+        case AST::Types::TernaryExpr:
+        {
+            CollectExpr(static_cast<TernaryExpr*>(expr.get())->condExpr);
+        }
+        break;
+
+        case AST::Types::BinaryExpr:
+        {
+            /* Collect chain of left-hand-side binary expressions iteratively to avoid deep recursion (e.g. for sums of thousands of terms) */
+            std::vector<std::pair<BinaryExpr*, ExprEntry*>> lhsChain;
+
+            for (auto binaryExpr = static_cast<BinaryExpr*>(expr.get()); binaryExpr != nullptr;)
+            {
+                lhsChain.push_back({ binaryExpr, newEntry });
+
+                auto lhsBinaryExpr = binaryExpr->lhsExpr->As<BinaryExpr>();
+                if (!lhsBinaryExpr)
+                {
+                    CollectExpr(binaryExpr->lhsExpr);
+                    break;
+                }
+
+                if (!CollectExprEntry(binaryExpr->lhsExpr, newEntry))
+                    break;
+
+                binaryExpr = lhsBinaryExpr;
+            }
+
+            for (auto it = lhsChain.rbegin(); it != lhsChain.rend(); ++it)
+            {
+                if (!IsLogicalOp(it->first->op))
+                    CollectExpr(it->first->rhsExpr);
+                FinishExprEntry(it->second);
+            }
+
+            return;
+        }
+        break;
+
+        case AST::Types::UnaryExpr:
+        {
+            CollectExpr(static_cast<UnaryExpr*>(expr.get())->expr);
+        }
+        break;
+
+        case AST::Types::CallExpr:
+        {
+            for (auto& arg : static_cast<CallExpr*>(expr.get())->arguments)
+                CollectExpr(arg);
+        }
+        break;
+
+        case AST::Types::BracketExpr:
+        {
+            CollectExpr(static_cast<BracketExpr*>(expr.get())->expr);
+        }
+        break;
+
+        case AST::Types::ObjectExpr:
+        {
+            CollectExpr(static_cast<ObjectExpr*>(expr.get())->prefixExpr);
+        }
+        break;
+
+        case AST::Types::ArrayExpr:
+        {
+            auto arrayExpr = static_cast<ArrayExpr*>(expr.get());
+            CollectExpr(arrayExpr->prefixExpr);
+            for (auto& arrayIndex : arrayExpr->arrayIndices)
+                CollectExpr(arrayIndex);
+        }
+        break;
+
+        case AST::Types::CastExpr:
+        {
+            CollectExpr(static_cast<CastExpr*>(expr.get())->expr);
+        }
+        break;
+
+        case AST::Types::InitializerExpr:
+        {
+            for (auto& subExpr : static_cast<InitializerExpr*>(expr.get())->exprs)
+                CollectExpr(subExpr);
+        }
+        break;
+
+        default:
+        break;
+    }
+
+    FinishExprEntry(newEntry);
+}
+
+/* --- Invalidation --- */
+
+void CommonSubexprEliminator::InvalidateWrites(AST* ast)
+{
+    InvalidateWrites(GatherWrites(ast));
+}
+
+void CommonSubexprEliminator::InvalidateWrites(const WriteSet& writeSet)
+{
+    if (writeSet.writesAll)
+    {
+        writeAllTime_ = ++writeCounter_;
+        availableExprs_.clear();
+    }
+    else if (!writeSet.decls.empty())
+    {
+        ++writeCounter_;
+        for (auto decl : writeSet.decls)
+            writeTimes_[decl] = writeCounter_;
+
+        /* Remove all available expressions that read from any of the written objects */
+        for (auto it = availableExprs_.begin(); it != availableExprs_.end();)
+        {
+            const auto& readDecls = it->second->readDecls;
+
+            auto isWritten = std::any_of(
+                readDecls.begin(), readDecls.end(),
+                [&writeSet](const Decl* decl)
+                {
+                    return (writeSet.decls.find(decl) != writeSet.decls.end());
+                }
+            );
+
+            if (isWritten)
+                it = availableExprs_.erase(it);
+            else
+                ++it;
+        }
+    }
+}
+
+bool CommonSubexprEliminator::IsWrittenSince(const std::set<const Decl*>& decls, std::size_t writeTime) const
+{
+    if (writeAllTime_ > writeTime)
+        return true;
+
+    for (auto decl : decls)
+    {
+        auto it = writeTimes_.find(decl);
+        if (it != writeTimes_.end() && it->second > writeTime)
+            return true;
+    }
+
+    return false;
+}
+
+CommonSubexprEliminator::WriteSet CommonSubexprEliminator::GatherWrites(AST* ast)
+{
+    writeSet_ = WriteSet();
+    Visit(ast);
+    return std::move(writeSet_);
+}
+
+bool CommonSubexprEliminator::HasSideEffects(Expr* expr)
+{
+    auto writeSet = GatherWrites(expr);
+    return (writeSet.writesAll || !writeSet.decls.empty());
+}
+
+// Returns the declaration object of the specified l-value expression (e.g. "x" for "x.y[1]"), or null if the expression has no declaration object.
+static const Decl* FetchLValueDecl(const Expr* expr)
+{
+    if (expr)
+    {
+        if (auto objectExpr = expr->As<ObjectExpr>())
+        {
+            if (objectExpr->prefixExpr)
+                return FetchLValueDecl(objectExpr->prefixExpr.get());
+            else
+                return objectExpr->symbolRef;
+        }
+        else if (auto arrayExpr = expr->As<ArrayExpr>())
+            return FetchLValueDecl(arrayExpr->prefixExpr.get());
+        else if (auto bracketExpr = expr->As<BracketExpr>())
+            return FetchLValueDecl(bracketExpr->expr.get());
+    }
+    return nullptr;
+}
+
+// Adds the object of the specified l-value expression to the write set, or marks all objects as written if the object is unknown.
+static void AddLValueWrite(const Expr* expr, bool& writesAll, std::set<const Decl*>& decls)
+{
+    if (auto decl = FetchLValueDecl(expr))
+        decls.insert(decl);
+    else
+        writesAll = true;
+}
+
+/* --- Expression keys --- */
+
+bool CommonSubexprEliminator::IsCandidateExpr(Expr& expr) const
+{
+    if (auto callExpr = expr.As<CallExpr>())
+    {
+        /* Only intrinsics without side effects, but no type constructors or user defined functions */
+        if (callExpr->intrinsic == Intrinsic::Undefined || HasIntrinsicSideEffects(callExpr->intrinsic))
+            return false;
+        if (!IntrinsicAdept::Get().GetIntrinsicOutputParameterIndices(callExpr->intrinsic).empty())
+            return false;
+    }
+    else if (auto binaryExpr = expr.As<BinaryExpr>())
+    {
+        /* Logical operators are evaluated with short circuit */
+        if (IsLogicalOp(binaryExpr->op))
+            return false;
+    }
+    else
+        return false;
+
+    /* Only expressions of base types can be stored in temporary variables */
+    if (auto baseTypeDen = expr.GetTypeDenoter()->GetAliased().As<BaseTypeDenoter>())
+    {
+        const auto dataType = baseTypeDen->dataType;
+        return (IsScalarType(dataType) || IsVectorType(dataType) || IsMatrixType(dataType));
+    }
+
+    return false;
+}
+
+static std::string PtrToString(const void* ptr)
+{
+    return std::to_string(reinterpret_cast<std::uintptr_t>(ptr));
+}
+
+bool CommonSubexprEliminator::MakeExprKey(const Expr* expr, std::string& key, std::set<const Decl*>& readDecls, std::size_t& numNodes) const
+{
+    if (!expr || ++numNodes > g_maxExprNodes)
+        return false;
+
+    switch (expr->Type())
+    {
+        case AST::Types::LiteralExpr:
+        {
+            auto literalExpr = static_cast<const LiteralExpr*>(expr);
+            key += "L" + std::to_string(static_cast<int>(literalExpr->dataType)) + ":" + literalExpr->value + ";";
+        }
+        return true;
+
+        case AST::Types::ObjectExpr:
+        {
+            auto objectExpr = static_cast<const ObjectExpr*>(expr);
+
+            if (objectExpr->prefixExpr && !MakeExprKey(objectExpr->prefixExpr.get(), key, readDecls, numNodes))
+                return false;
+
+            key += "O" + objectExpr->ident + "@" + PtrToString(objectExpr->symbolRef) + ";";
+
+            if (objectExpr->symbolRef)
+                readDecls.insert(objectExpr->symbolRef);
+        }
+        return true;
+
+        case AST::Types::BinaryExpr:
+        {
+            auto binaryExpr = static_cast<const BinaryExpr*>(expr);
+
+            key += "B" + BinaryOpToString(binaryExpr->op) + "(";
+            if (!MakeExprKey(binaryExpr->lhsExpr.get(), key, readDecls, numNodes))
+                return false;
+            key += ",";
+            if (!MakeExprKey(binaryExpr->rhsExpr.get(), key, readDecls, numNodes))
+                return false;
+            key += ")";
+        }
+        return true;
+
+        case AST::Types::UnaryExpr:
+        {
+            auto unaryExpr = static_cast<const UnaryExpr*>(expr);
+
+            if (IsLValueOp(unaryExpr->op))
+                return false;
+
+            key += "U" + UnaryOpToString(unaryExpr->op) + "(";
+            if (!MakeExprKey(unaryExpr->expr.get(), key, readDecls, numNodes))
+                return false;
+            key += ")";
+        }
+        return true;
+
+        case AST::Types::CallExpr:
+        {
+            auto callExpr = static_cast<const CallExpr*>(expr);
+
+            /* User defined functions might have side effects */
+            if (callExpr->intrinsic == Intrinsic::Undefined && !callExpr->typeDenoter)
+                return false;
+
+            if (callExpr->prefixExpr && !MakeExprKey(callExpr->prefixExpr.get(), key, readDecls, numNodes))
+                return false;
+
+            key += "C" + callExpr->ident + "#" + std::to_string(static_cast<int>(callExpr->intrinsic));
+            if (callExpr->typeDenoter)
+                key += ":" + callExpr->typeDenoter->ToString();
+
+            key += "(";
+            for (const auto& arg : callExpr->arguments)
+            {
+                if (!MakeExprKey(arg.get(), key, readDecls, numNodes))
+                    return false;
+                key += ",";
+            }
+            key += ")";
+        }
+        return true;
+
+        case AST::Types::BracketExpr:
+        {
+            return MakeExprKey(static_cast<const BracketExpr*>(expr)->expr.get(), key, readDecls, numNodes);
+        }
+
+        case AST::Types::ArrayExpr:
+        {
+            auto arrayExpr = static_cast<const ArrayExpr*>(expr);
+
+            if (!MakeExprKey(arrayExpr->prefixExpr.get(), key, readDecls, numNodes))
+                return false;
+
+            for (const auto& arrayIndex : arrayExpr->arrayIndices)
+            {
+                key += "[";
+                if (!MakeExprKey(arrayIndex.get(), key, readDecls, numNodes))
+                    return false;
+                key += "]";
+            }
+        }
+        return true;
+
+        case AST::Types::CastExpr:
+        {
+            auto castExpr = static_cast<const CastExpr*>(expr);
+
+            key += "T" + castExpr->typeSpecifier->typeDenoter->ToString() + "(";
+            if (!MakeExprKey(castExpr->expr.get(), key, readDecls, numNodes))
+                return false;
+            key += ")";
+        }
+        return true;
+
+        default:
+        break;
+    }
+
+    return false;
+}
+
+void CommonSubexprEliminator::HoistExprEntries()
+{
+    /* Gather all expressions with multiple occurrences, and name their temporaries in order of their first occurrence */
+    std::vector<ExprEntry*> entries;
+
+    for (const auto& entry : exprEntries_)
+    {
+        if (entry->exprSlots.size() >= 2)
+        {
+            entry->tempIdent = nameMangling_->temporaryPrefix + "cse" + std::to_string(tempVarCounter_++);
+            entries.push_back(entry.get());
+        }
+    }
+
+    /*
+    Insert temporaries in reverse order of their statement index, so the indices of the following entries remain valid.
+    Entries of the same statement are inserted in reverse declaration order (each one before the previously inserted ones),
+    so temporaries of inner expressions are declared before the temporaries of their outer expressions.
+    */
+    std::sort(
+        entries.begin(), entries.end(),
+        [](const ExprEntry* lhs, const ExprEntry* rhs)
+        {
+            if (lhs->stmntIndex != rhs->stmntIndex)
+                return (lhs->stmntIndex > rhs->stmntIndex);
+            return (lhs->declOrder > rhs->declOrder);
+        }
+    );
+
+    for (auto entry : entries)
+    {
+        auto& firstExpr = *(entry->exprSlots.front());
+
+        /* Make temporary variable with the first occurrence as initializer */
+        auto typeSpecifier  = ASTFactory::MakeTypeSpecifier(firstExpr->GetTypeDenoter());
+        auto varDeclStmnt   = ASTFactory::MakeVarDeclStmnt(typeSpecifier, entry->tempIdent, firstExpr);
+        auto varDecl        = varDeclStmnt->varDecls.front().get();
+
+        /* Replace all occurrences by the temporary variable */
+        for (auto exprSlot : entry->exprSlots)
+            *exprSlot = ASTFactory::MakeObjectExpr(varDecl);
+
+        entry->stmnts->insert(entry->stmnts->begin() + entry->stmntIndex, varDeclStmnt);
+    }
+}
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void CommonSubexprEliminator::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+/* --- Declarations --- */
+
+IMPLEMENT_VISIT_PROC(FunctionDecl)
+{
+    if (ast->codeBlock && !ast->IsForwardDecl())
+        ProcessFunctionBody(ast);
+}
+
+/* --- Expressions --- */
+
+IMPLEMENT_VISIT_PROC(UnaryExpr)
+{
+    if (IsLValueOp(ast->op))
+        AddLValueWrite(ast->expr.get(), writeSet_.writesAll, writeSet_.decls);
+    VISIT_DEFAULT(UnaryExpr);
+}
+
+IMPLEMENT_VISIT_PROC(PostUnaryExpr)
+{
+    AddLValueWrite(ast->expr.get(), writeSet_.writesAll, writeSet_.decls);
+    VISIT_DEFAULT(PostUnaryExpr);
+}
+
+IMPLEMENT_VISIT_PROC(CallExpr)
+{
+    if (ast->intrinsic != Intrinsic::Undefined)
+    {
+        /* Intrinsics can only write to their output arguments, unless they have global side effects */
+        if (HasIntrinsicSideEffects(ast->intrinsic))
+            writeSet_.writesAll = true;
+        else
+        {
+            ast->ForEachOutputArgument(
+                [this](ExprPtr& argExpr, VarDecl* /*param*/)
+                {
+                    AddLValueWrite(argExpr.get(), writeSet_.writesAll, writeSet_.decls);
+                }
+            );
+        }
+    }
+    else if (!ast->typeDenoter || !ast->ident.empty())
+    {
+        /* User defined functions can write to arbitrary objects */
+        writeSet_.writesAll = true;
+    }
+
+    VISIT_DEFAULT(CallExpr);
+}
+
+IMPLEMENT_VISIT_PROC(AssignExpr)
+{
+    AddLValueWrite(ast->lvalueExpr.get(), writeSet_.writesAll, writeSet_.decls);
+    VISIT_DEFAULT(AssignExpr);
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
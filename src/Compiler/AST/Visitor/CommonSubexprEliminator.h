@@ -0,0 +1,158 @@
+/*
+ * CommonSubexprEliminator.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_COMMON_SUBEXPR_ELIMINATOR_H
+#define XSC_COMMON_SUBEXPR_ELIMINATOR_H
+
+
+#include "Visitor.h"
+#include <Xsc/Xsc.h>
+#include <vector>
+#include <string>
+#include <memory>
+#include <map>
+#include <set>
+
+
+namespace Xsc
+{
+
+
+/*
+Common sub-expression eliminator AST visitor.
+This helper class for the optimizer searches each function body for structurally equal expressions without side effects
+(e.g. texture samples or arithmetic expressions with more than one operator), and moves them into temporary variables which are declared before their first occurrence.
+An expression is only reused as long as none of the variables it reads from is written to,
+and it is only reused within the scope of its temporary variable (i.e. the statement list of its first occurrence, including all nested statements).
+Temporaries of expressions within unconditional code blocks (e.g. inlined function bodies) are declared before the outermost of these blocks,
+so they are also reused in the following sibling blocks. This is not done once such a block might have been left early (e.g. by a "return" after a bounds check).
+*/
+class CommonSubexprEliminator : private Visitor
+{
+
+    public:
+
+        // Eliminates common sub-expressions in all functions of the specified program. Temporary variables are named with the 'temporaryPrefix'.
+        void EliminateCommonSubexprs(Program& program, const NameMangling& nameMangling);
+
+    private:
+
+        // Occurrences of a structurally equal expression.
+        struct ExprEntry
+        {
+            std::vector<ExprPtr*>       exprSlots;      // References to all expression occurrences.
+            std::set<const Decl*>       readDecls;      // Declaration objects the expression reads from.
+            std::vector<StmntPtr>*      stmnts;         // Statement list of the first occurrence.
+            std::size_t                 stmntIndex;     // Index of the statement with the first occurrence.
+            std::size_t                 declOrder;      // Order of the temporary variable declarations, so nested expressions are declared first.
+            std::string                 tempIdent;      // Identifier of the temporary variable.
+        };
+
+        using ExprEntryPtr = std::unique_ptr<ExprEntry>;
+
+        // Set of declaration objects that are written to.
+        struct WriteSet
+        {
+            bool                        writesAll = false;  // Specifies whether arbitrary objects can be written to (e.g. by function calls).
+            std::set<const Decl*>       decls;
+        };
+
+        // Statement before which the temporaries of the current unconditional code blocks are declared.
+        struct AnchorStmnt
+        {
+            std::vector<StmntPtr>*      stmnts      = nullptr;  // Statement list of the outermost unconditional code block, or null if there is none.
+            std::size_t                 stmntIndex  = 0;        // Index of the outermost unconditional code block statement.
+            std::size_t                 writeTime   = 0;        // Write counter at the anchor statement.
+        };
+
+        /* --- Statement processing --- */
+
+        void ProcessFunctionBody(FunctionDecl* funcDecl);
+        void ProcessStmntList(std::vector<StmntPtr>& stmnts, bool allowNewEntries);
+        void ProcessStmnt(Stmnt* stmnt);
+        void ProcessNestedStmnt(Stmnt* stmnt);
+        void ProcessCodeBlockStmnt(CodeBlockStmnt* codeBlockStmnt);
+
+        // Processes the specified expression if it has no side effects, otherwise invalidates all expressions it writes to.
+        void ProcessExprOrInvalidate(ExprPtr& expr);
+
+        // Adds the specified expression and its sub expressions to the expression entries, or to an existing entry if there is a structurally equal one.
+        void CollectExpr(ExprPtr& expr);
+
+        // Adds only the specified expression to the expression entries (see CollectExpr), and returns false if its sub expressions must be ignored.
+        bool CollectExprEntry(ExprPtr& expr, ExprEntry*& newEntry);
+
+        // Sets the declaration order of the specified new entry, after all its sub expressions have been collected.
+        void FinishExprEntry(ExprEntry* entry);
+
+        /* --- Invalidation --- */
+
+        // Invalidates all available expressions that read from the objects that are written to by the specified AST node.
+        void InvalidateWrites(AST* ast);
+        void InvalidateWrites(const WriteSet& writeSet);
+
+        // Returns true if any of the specified objects has been written to since the specified write counter.
+        bool IsWrittenSince(const std::set<const Decl*>& decls, std::size_t writeTime) const;
+
+        // Returns the set of all objects that are written to by the specified AST node.
+        WriteSet GatherWrites(AST* ast);
+
+        // Returns true if the specified expression has any side effects.
+        bool HasSideEffects(Expr* expr);
+
+        /* --- Expression keys --- */
+
+        // Returns true if the specified expression is worth being stored in a temporary variable.
+        bool IsCandidateExpr(Expr& expr) const;
+
+        // Makes a unique key of the specified expression for structural equality, and returns false if the expression is not supported or too large.
+        bool MakeExprKey(const Expr* expr, std::string& key, std::set<const Decl*>& readDecls, std::size_t& numNodes) const;
+
+        // Moves all expressions with at least two occurrences into temporary variables.
+        void HoistExprEntries();
+
+        /* ----- Visitor implementation ----- */
+
+        DECL_VISIT_PROC( FunctionDecl  );
+
+        DECL_VISIT_PROC( UnaryExpr     );
+        DECL_VISIT_PROC( PostUnaryExpr );
+        DECL_VISIT_PROC( CallExpr      );
+        DECL_VISIT_PROC( AssignExpr    );
+
+        /* === Members === */
+
+        const NameMangling*                     nameMangling_       = nullptr;
+        std::size_t                             tempVarCounter_     = 0;
+
+        std::vector<ExprEntryPtr>               exprEntries_;       // All expression entries of the current function (in order of their first occurrence).
+        std::map<std::string, ExprEntry*>       availableExprs_;    // Expression entries that can be reused, by their key.
+
+        std::size_t                             declOrderCounter_   = 0;
+
+        std::vector<StmntPtr>*                  activeStmnts_       = nullptr;
+        std::size_t                             activeStmntIndex_   = 0;
+        bool                                    allowNewEntries_    = false;
+        AnchorStmnt                             anchorStmnt_;
+
+        std::map<const Decl*, std::size_t>      writeTimes_;        // Write counter of the last write to each object.
+        std::size_t                             writeCounter_       = 0;
+        std::size_t                             writeAllTime_       = 0;    // Write counter of the last write to arbitrary objects.
+
+        WriteSet                                writeSet_;          // Output of the write gathering visitor functions.
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
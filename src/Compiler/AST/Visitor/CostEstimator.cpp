@@ -0,0 +1,364 @@
+/*
+ * CostEstimator.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CostEstimator.h"
+#include "VaryingLinker.h"
+#include "IntrinsicAdept.h"
+#include "ReportIdents.h"
+#include "AST.h"
+
+
+namespace Xsc
+{
+
+
+void CostEstimator::EstimateCost(Program& program, const ShaderTarget shaderTarget, Reflection::CostEstimate& cost)
+{
+    cost    = Reflection::CostEstimate();
+    cost_   = (&cost);
+
+    if (auto entryPoint = program.entryPointRef)
+    {
+        /* Visit all statements that are reachable from the entry point */
+        callStack_.insert(entryPoint);
+        Visit(entryPoint->codeBlock);
+        callStack_.clear();
+
+        CountInterpolators(program, shaderTarget);
+    }
+
+    /* Store identifiers of all used intrinsics (overloaded intrinsics share the same identifier) */
+    std::set<std::string> intrinsicIdents;
+
+    for (const auto& it : program.usedIntrinsics)
+    {
+        /* Ignore intrinsics that only exist in the output language (e.g. 'imageLoad') */
+        const auto& ident = IntrinsicAdept::Get().GetIntrinsicIdent(it.first);
+        if (ident != R_Undefined())
+            intrinsicIdents.insert(ident);
+    }
+
+    cost.intrinsics.assign(intrinsicIdents.begin(), intrinsicIdents.end());
+
+    cost_ = nullptr;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+// Returns the number of scalar components of the specified expression (e.g. 3 for "float3", 16 for "float4x4").
+static unsigned int NumComponents(Expr* expr)
+{
+    if (auto baseTypeDen = expr->GetTypeDenoter()->GetAliased().As<BaseTypeDenoter>())
+    {
+        const auto dataType = baseTypeDen->dataType;
+        if (IsMatrixType(dataType))
+        {
+            const auto matrixDim = MatrixTypeDim(dataType);
+            return static_cast<unsigned int>(matrixDim.first * matrixDim.second);
+        }
+        if (IsVectorType(dataType))
+            return static_cast<unsigned int>(VectorTypeDim(dataType));
+    }
+    return 1;
+}
+
+// Returns true if the specified intrinsic is a transcendental function, which is usually executed by a special function unit.
+static bool IsTranscendentalIntrinsic(const Intrinsic t)
+{
+    switch (t)
+    {
+        case Intrinsic::ACos:
+        case Intrinsic::ASin:
+        case Intrinsic::ATan:
+        case Intrinsic::ATan2:
+        case Intrinsic::Cos:
+        case Intrinsic::CosH:
+        case Intrinsic::Exp:
+        case Intrinsic::Exp2:
+        case Intrinsic::Log:
+        case Intrinsic::Log10:
+        case Intrinsic::Log2:
+        case Intrinsic::Pow:
+        case Intrinsic::Rcp:
+        case Intrinsic::RSqrt:
+        case Intrinsic::Sin:
+        case Intrinsic::SinCos:
+        case Intrinsic::SinH:
+        case Intrinsic::Sqrt:
+        case Intrinsic::Tan:
+        case Intrinsic::TanH:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void CostEstimator::CountBinaryOp(const BinaryOp op, unsigned int numOps)
+{
+    if (IsBitwiseOp(op))
+        cost_->bitwiseOps += numOps;
+    else if (IsBooleanOp(op))
+        cost_->comparisonOps += numOps;
+    else if (op == BinaryOp::Div || op == BinaryOp::Mod)
+        cost_->divisionOps += numOps;
+    else
+        cost_->arithmeticOps += numOps;
+}
+
+void CostEstimator::CountIntrinsic(const Intrinsic intrinsic, unsigned int numOps)
+{
+    if (IsTextureSampleIntrinsic(intrinsic) || IsTextureGatherIntrisic(intrinsic) || (intrinsic >= Intrinsic::Tex1D_2 && intrinsic <= Intrinsic::TexCubeProj))
+        cost_->textureSamples++;
+    else if (IsTextureLoadIntrinsic(intrinsic) || intrinsic == Intrinsic::Image_Load)
+        cost_->textureFetches++;
+    else if (IsTranscendentalIntrinsic(intrinsic))
+        cost_->transcendentalOps += numOps;
+    else
+        cost_->intrinsicCalls++;
+}
+
+bool CostEstimator::IsDynamicExpr(const Expr* expr) const
+{
+    auto dynamicExpr = expr->Find(
+        [this](const Expr& expr) -> bool
+        {
+            if (auto objectExpr = expr.As<ObjectExpr>())
+            {
+                /* Variables are dynamic unless they are constant or the counter of a static loop */
+                if (auto varDecl = objectExpr->FetchVarDecl())
+                    return !(varDecl->HasStaticConstInitializer() || varDecl->IsSpecConstant() || staticVarDecls_.count(varDecl) != 0);
+            }
+            else if (auto callExpr = expr.As<CallExpr>())
+            {
+                /* Function calls can read any global variable */
+                if (callExpr->GetFunctionImpl() != nullptr)
+                    return true;
+
+                /* Arguments are not included in the search of call expressions */
+                for (const auto& arg : callExpr->arguments)
+                {
+                    if (IsDynamicExpr(arg.get()))
+                        return true;
+                }
+            }
+            else if (auto arrayExpr = expr.As<ArrayExpr>())
+            {
+                /* Array indices are not included in the search of array expressions */
+                for (const auto& index : arrayExpr->arrayIndices)
+                {
+                    if (IsDynamicExpr(index.get()))
+                        return true;
+                }
+            }
+            return false;
+        }
+    );
+    return (dynamicExpr != nullptr);
+}
+
+void CostEstimator::CountInterpolators(Program& program, const ShaderTarget shaderTarget)
+{
+    if (shaderTarget == ShaderTarget::ComputeShader)
+        return;
+
+    VaryingLinker::ShaderInterface shaderInterface;
+    VaryingLinker varyingLinker;
+    varyingLinker.CollectVaryings(program, shaderTarget, shaderInterface);
+
+    /* Fragment shaders consume the interpolators, all other stages produce them */
+    const auto& varyings = (shaderTarget == ShaderTarget::FragmentShader ? shaderInterface.inputs : shaderInterface.outputs);
+
+    for (const auto& varying : varyings)
+        cost_->interpolators += static_cast<unsigned int>(varying.locations);
+}
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void CostEstimator::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+IMPLEMENT_VISIT_PROC(ForLoopStmnt)
+{
+    cost_->loops++;
+
+    /* Loop is static if its condition only depends on constants and the counter variables of its initializer */
+    std::vector<const VarDecl*> counterVarDecls;
+
+    if (auto varDeclStmnt = ast->initStmnt->As<VarDeclStmnt>())
+    {
+        for (const auto& varDecl : varDeclStmnt->varDecls)
+        {
+            if (!varDecl->initializer || !IsDynamicExpr(varDecl->initializer.get()))
+                counterVarDecls.push_back(varDecl.get());
+        }
+    }
+
+    staticVarDecls_.insert(counterVarDecls.begin(), counterVarDecls.end());
+
+    if (!ast->condition || IsDynamicExpr(ast->condition.get()))
+    {
+        cost_->dynamicLoops++;
+        for (auto varDecl : counterVarDecls)
+            staticVarDecls_.erase(varDecl);
+        counterVarDecls.clear();
+    }
+
+    VISIT_DEFAULT(ForLoopStmnt);
+
+    for (auto varDecl : counterVarDecls)
+        staticVarDecls_.erase(varDecl);
+}
+
+IMPLEMENT_VISIT_PROC(WhileLoopStmnt)
+{
+    /* Only 'for'-loops with counter variables are static */
+    cost_->loops++;
+    cost_->dynamicLoops++;
+    VISIT_DEFAULT(WhileLoopStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(DoWhileLoopStmnt)
+{
+    cost_->loops++;
+    cost_->dynamicLoops++;
+    VISIT_DEFAULT(DoWhileLoopStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(IfStmnt)
+{
+    cost_->branches++;
+    if (IsDynamicExpr(ast->condition.get()))
+        cost_->dynamicBranches++;
+    VISIT_DEFAULT(IfStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(SwitchStmnt)
+{
+    cost_->branches++;
+    if (IsDynamicExpr(ast->selector.get()))
+        cost_->dynamicBranches++;
+    VISIT_DEFAULT(SwitchStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(BinaryExpr)
+{
+    /* Collect chain of left-hand-side binary expressions to avoid deep recursion (e.g. for sums of thousands of terms) */
+    std::vector<BinaryExpr*> lhsChain;
+
+    for (auto binaryExpr = ast; binaryExpr != nullptr; binaryExpr = binaryExpr->lhsExpr->As<BinaryExpr>())
+        lhsChain.push_back(binaryExpr);
+
+    Visit(lhsChain.back()->lhsExpr);
+
+    for (auto it = lhsChain.rbegin(); it != lhsChain.rend(); ++it)
+    {
+        Visit((*it)->rhsExpr);
+        CountBinaryOp((*it)->op, NumComponents(*it));
+    }
+}
+
+IMPLEMENT_VISIT_PROC(UnaryExpr)
+{
+    VISIT_DEFAULT(UnaryExpr);
+
+    switch (ast->op)
+    {
+        case UnaryOp::LogicalNot:
+            cost_->comparisonOps += NumComponents(ast);
+            break;
+        case UnaryOp::Not:
+            cost_->bitwiseOps += NumComponents(ast);
+            break;
+        case UnaryOp::Negate:
+        case UnaryOp::Inc:
+        case UnaryOp::Dec:
+            cost_->arithmeticOps += NumComponents(ast);
+            break;
+        default:
+            break;
+    }
+}
+
+IMPLEMENT_VISIT_PROC(PostUnaryExpr)
+{
+    VISIT_DEFAULT(PostUnaryExpr);
+    cost_->arithmeticOps += NumComponents(ast);
+}
+
+IMPLEMENT_VISIT_PROC(CallExpr)
+{
+    VISIT_DEFAULT(CallExpr);
+
+    if (ast->intrinsic != Intrinsic::Undefined)
+        CountIntrinsic(ast->intrinsic, NumComponents(ast));
+    else if (auto funcDecl = ast->GetFunctionImpl())
+    {
+        /* Visit the called function once per call site (like an inlined function) */
+        if (callStack_.insert(funcDecl).second)
+        {
+            Visit(funcDecl->codeBlock);
+            callStack_.erase(funcDecl);
+        }
+    }
+}
+
+IMPLEMENT_VISIT_PROC(AssignExpr)
+{
+    /* Only plain assignments do not read the l-value (e.g. buffer stores are no fetches) */
+    const auto binaryOp = AssignOpToBinaryOp(ast->op);
+
+    isLValueExpr_ = (binaryOp == BinaryOp::Undefined);
+    {
+        Visit(ast->lvalueExpr);
+    }
+    isLValueExpr_ = false;
+
+    Visit(ast->rvalueExpr);
+
+    if (binaryOp != BinaryOp::Undefined)
+        CountBinaryOp(binaryOp, NumComponents(ast->lvalueExpr.get()));
+}
+
+IMPLEMENT_VISIT_PROC(ArrayExpr)
+{
+    if (!isLValueExpr_)
+    {
+        /* Subscripts of buffers and textures (also within arrays of buffers) are fetches */
+        const auto* typeDen = &(ast->prefixExpr->GetTypeDenoter()->GetAliased());
+
+        if (auto arrayTypeDen = typeDen->As<ArrayTypeDenoter>())
+        {
+            if (ast->NumIndices() > arrayTypeDen->arrayDims.size())
+                typeDen = &(arrayTypeDen->subTypeDenoter->GetAliased());
+        }
+
+        if (typeDen->As<BufferTypeDenoter>())
+            cost_->textureFetches++;
+    }
+
+    Visit(ast->prefixExpr);
+
+    /* Array indices are always read */
+    const auto isLValueExpr = isLValueExpr_;
+    isLValueExpr_ = false;
+    {
+        Visit(ast->arrayIndices);
+    }
+    isLValueExpr_ = isLValueExpr;
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
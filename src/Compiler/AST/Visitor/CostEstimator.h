@@ -0,0 +1,87 @@
+/*
+ * CostEstimator.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_COST_ESTIMATOR_H
+#define XSC_COST_ESTIMATOR_H
+
+
+#include <Xsc/Reflection.h>
+#include <Xsc/Targets.h>
+#include "Visitor.h"
+#include "ASTEnums.h"
+#include <set>
+
+
+namespace Xsc
+{
+
+
+/*
+Static cost estimator AST visitor.
+This helper class estimates the GPU cost of the entry point for the code reflection (see Reflection::CostEstimate).
+All statements that are reachable from the entry point are visited, and each called function is visited once per call site.
+Must be used after the reference analyzer, since the used intrinsics are taken from 'Program::usedIntrinsics'.
+*/
+class CostEstimator : private Visitor
+{
+
+    public:
+
+        // Estimates the cost of the entry point of the specified program.
+        void EstimateCost(Program& program, const ShaderTarget shaderTarget, Reflection::CostEstimate& cost);
+
+    private:
+
+        /* === Functions === */
+
+        // Adds the specified number of operations for the binary operator to the respective category.
+        void CountBinaryOp(const BinaryOp op, unsigned int numOps);
+
+        // Adds the cost of the specified intrinsic call.
+        void CountIntrinsic(const Intrinsic intrinsic, unsigned int numOps);
+
+        // Returns true if the specified expression refers to any variable that is neither constant nor a static loop counter.
+        bool IsDynamicExpr(const Expr* expr) const;
+
+        // Counts the number of interpolators of the entry point.
+        void CountInterpolators(Program& program, const ShaderTarget shaderTarget);
+
+        /* --- Visitor implementation --- */
+
+        DECL_VISIT_PROC( ForLoopStmnt     );
+        DECL_VISIT_PROC( WhileLoopStmnt   );
+        DECL_VISIT_PROC( DoWhileLoopStmnt );
+        DECL_VISIT_PROC( IfStmnt          );
+        DECL_VISIT_PROC( SwitchStmnt      );
+
+        DECL_VISIT_PROC( BinaryExpr       );
+        DECL_VISIT_PROC( UnaryExpr        );
+        DECL_VISIT_PROC( PostUnaryExpr    );
+        DECL_VISIT_PROC( CallExpr         );
+        DECL_VISIT_PROC( AssignExpr       );
+        DECL_VISIT_PROC( ArrayExpr        );
+
+        /* === Members === */
+
+        Reflection::CostEstimate*   cost_           = nullptr;
+
+        std::set<FunctionDecl*>     callStack_;                 // Functions that are currently visited (to avoid endless recursion).
+        std::set<const VarDecl*>    staticVarDecls_;            // Counter variables of the enclosing static loops.
+
+        bool                        isLValueExpr_   = false;    // The current expression is written to (e.g. buffer store).
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,363 @@
+/*
+ * DeadCodeEliminator.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "DeadCodeEliminator.h"
+#include "IntrinsicAdept.h"
+#include "AST.h"
+#include <algorithm>
+
+
+namespace Xsc
+{
+
+
+void DeadCodeEliminator::EliminateDeadCode(Program& program)
+{
+    /* Repeat elimination, since removed assignments can make further variables unused */
+    do
+    {
+        localVars_.clear();
+        removableStores_.clear();
+        stmntLists_.clear();
+
+        Visit(&program);
+    }
+    while (RemoveDeadStmnts());
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void DeadCodeEliminator::RegisterLocalVars(Stmnt* stmnt)
+{
+    if (auto varDeclStmnt = stmnt->As<VarDeclStmnt>())
+    {
+        /* Ignore static variables and variables with an inner structure declaration */
+        const auto& typeSpecifier = varDeclStmnt->typeSpecifier;
+        if (typeSpecifier->structDecl || typeSpecifier->HasAnyStorageClassOf({ StorageClass::Static }))
+            return;
+
+        for (auto& varDecl : varDeclStmnt->varDecls)
+        {
+            /* Ignore variables that are used as shader input or output */
+            if ( !varDecl->flags(VarDecl::isShaderInput)        &&
+                 !varDecl->flags(VarDecl::isShaderOutput)       &&
+                 !varDecl->flags(VarDecl::isSystemValue)        &&
+                 !varDecl->flags(VarDecl::isEntryPointOutput)   &&
+                 !varDecl->flags(VarDecl::isEntryPointLocal) )
+            {
+                localVars_[varDecl.get()] = LocalVarInfo();
+            }
+        }
+    }
+}
+
+void DeadCodeEliminator::VisitStmntList(std::vector<StmntPtr>& stmnts)
+{
+    stmntLists_.push_back(&stmnts);
+
+    bool hasJumpStmnt = false;
+
+    for (auto& stmnt : stmnts)
+    {
+        /* Mark all statements after 'break', 'continue', or 'discard' as dead code (statements after a return path are marked by the ControlPathAnalyzer) */
+        if (hasJumpStmnt)
+            stmnt->flags << AST::isDeadCode;
+
+        if (!stmnt->flags(AST::isDeadCode))
+        {
+            RegisterLocalVars(stmnt.get());
+            Visit(stmnt);
+
+            if (stmnt->Type() == AST::Types::CtrlTransferStmnt)
+                hasJumpStmnt = true;
+        }
+    }
+}
+
+void DeadCodeEliminator::VisitLValueSubExprs(Expr* expr)
+{
+    if (expr)
+    {
+        if (auto objectExpr = expr->As<ObjectExpr>())
+            VisitLValueSubExprs(objectExpr->prefixExpr.get());
+        else if (auto arrayExpr = expr->As<ArrayExpr>())
+        {
+            VisitLValueSubExprs(arrayExpr->prefixExpr.get());
+            Visit(arrayExpr->arrayIndices);
+        }
+        else if (auto bracketExpr = expr->As<BracketExpr>())
+            VisitLValueSubExprs(bracketExpr->expr.get());
+    }
+}
+
+// Returns the variable of the specified l-value expression (e.g. "x" for "x.y[1]"), or null if the expression is not a variable.
+static VarDecl* FetchLValueVarDecl(const Expr* expr)
+{
+    if (expr)
+    {
+        if (auto objectExpr = expr->As<ObjectExpr>())
+        {
+            if (objectExpr->prefixExpr)
+                return FetchLValueVarDecl(objectExpr->prefixExpr.get());
+            else if (objectExpr->symbolRef)
+                return objectExpr->symbolRef->As<VarDecl>();
+        }
+        else if (auto arrayExpr = expr->As<ArrayExpr>())
+            return FetchLValueVarDecl(arrayExpr->prefixExpr.get());
+        else if (auto bracketExpr = expr->As<BracketExpr>())
+            return FetchLValueVarDecl(bracketExpr->expr.get());
+    }
+    return nullptr;
+}
+
+VarDecl* DeadCodeEliminator::FetchStoreTarget(const ExprStmnt* ast) const
+{
+    VarDecl* varDecl = nullptr;
+
+    if (auto assignExpr = ast->expr->As<AssignExpr>())
+        varDecl = FetchLValueVarDecl(assignExpr->lvalueExpr.get());
+    else if (auto unaryExpr = ast->expr->As<UnaryExpr>())
+    {
+        if (IsLValueOp(unaryExpr->op))
+            varDecl = FetchLValueVarDecl(unaryExpr->expr.get());
+    }
+    else if (auto postUnaryExpr = ast->expr->As<PostUnaryExpr>())
+        varDecl = FetchLValueVarDecl(postUnaryExpr->expr.get());
+
+    /* Only return variables that have been registered as local variables */
+    if (varDecl && localVars_.find(varDecl) != localVars_.end())
+        return varDecl;
+
+    return nullptr;
+}
+
+bool DeadCodeEliminator::IsUnusedLocalVar(VarDecl* varDecl) const
+{
+    auto it = localVars_.find(varDecl);
+    if (it != localVars_.end())
+    {
+        const auto& info = it->second;
+        return (info.numReads == 0 && info.numStores == 0 && !info.hasInitializerEffects);
+    }
+    return false;
+}
+
+// Returns true if the specified statement is a code block without any statements.
+static bool IsEmptyCodeBlockStmnt(const Stmnt* stmnt)
+{
+    if (auto codeBlockStmnt = stmnt->As<CodeBlockStmnt>())
+        return codeBlockStmnt->codeBlock->stmnts.empty();
+    return false;
+}
+
+bool DeadCodeEliminator::RemoveDeadStmnts()
+{
+    bool hasRemovedStmnts = false;
+
+    /* Process nested statement lists first, since removing a statement also destroys all of its nested statement lists */
+    for (auto listIt = stmntLists_.rbegin(); listIt != stmntLists_.rend(); ++listIt)
+    {
+        auto stmnts = *listIt;
+
+        for (auto it = stmnts->begin(); it != stmnts->end();)
+        {
+            auto stmnt = it->get();
+
+            if (stmnt->flags(AST::isDeadCode))
+            {
+                /* Remove unreachable statement (after return path or jump statement) */
+                it = stmnts->erase(it);
+                hasRemovedStmnts = true;
+                continue;
+            }
+
+            if (stmnt->Type() == AST::Types::NullStmnt || IsEmptyCodeBlockStmnt(stmnt))
+            {
+                /* Remove empty statement (e.g. remaining scope of an inlined function) */
+                it = stmnts->erase(it);
+                hasRemovedStmnts = true;
+                continue;
+            }
+
+            auto storeIt = removableStores_.find(stmnt);
+            if (storeIt != removableStores_.end())
+            {
+                /* Remove assignment to a variable that is never read */
+                auto& info = localVars_[storeIt->second];
+                if (info.numReads == 0)
+                {
+                    --info.numStores;
+                    it = stmnts->erase(it);
+                    hasRemovedStmnts = true;
+                    continue;
+                }
+            }
+
+            if (auto varDeclStmnt = stmnt->As<VarDeclStmnt>())
+            {
+                /* Remove unused local variables */
+                auto& varDecls = varDeclStmnt->varDecls;
+                auto numVarDecls = varDecls.size();
+
+                varDecls.erase(
+                    std::remove_if(
+                        varDecls.begin(), varDecls.end(),
+                        [this](const VarDeclPtr& varDecl)
+                        {
+                            return IsUnusedLocalVar(varDecl.get());
+                        }
+                    ),
+                    varDecls.end()
+                );
+
+                if (varDecls.size() < numVarDecls)
+                {
+                    hasRemovedStmnts = true;
+                    if (varDecls.empty())
+                    {
+                        it = stmnts->erase(it);
+                        continue;
+                    }
+                }
+            }
+
+            ++it;
+        }
+    }
+
+    return hasRemovedStmnts;
+}
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void DeadCodeEliminator::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+IMPLEMENT_VISIT_PROC(CodeBlock)
+{
+    VisitStmntList(ast->stmnts);
+}
+
+IMPLEMENT_VISIT_PROC(SwitchCase)
+{
+    Visit(ast->expr);
+    VisitStmntList(ast->stmnts);
+}
+
+/* --- Declarations --- */
+
+IMPLEMENT_VISIT_PROC(VarDecl)
+{
+    hasSideEffects_ = false;
+
+    VISIT_DEFAULT(VarDecl);
+
+    /* Store whether the initializer has side effects */
+    auto it = localVars_.find(ast);
+    if (it != localVars_.end())
+        it->second.hasInitializerEffects = hasSideEffects_;
+}
+
+/* --- Statements --- */
+
+IMPLEMENT_VISIT_PROC(ExprStmnt)
+{
+    if (auto varDecl = FetchStoreTarget(ast))
+    {
+        hasSideEffects_ = false;
+        storeTarget_    = varDecl;
+        numSelfReads_   = 0;
+
+        /* Visit all sub expressions of the assignment, except the variable that is written to */
+        if (auto assignExpr = ast->expr->As<AssignExpr>())
+        {
+            VisitLValueSubExprs(assignExpr->lvalueExpr.get());
+            Visit(assignExpr->rvalueExpr);
+        }
+        else if (auto unaryExpr = ast->expr->As<UnaryExpr>())
+            VisitLValueSubExprs(unaryExpr->expr.get());
+        else if (auto postUnaryExpr = ast->expr->As<PostUnaryExpr>())
+            VisitLValueSubExprs(postUnaryExpr->expr.get());
+
+        storeTarget_ = nullptr;
+
+        /* Only assignments without further side effects can be removed (e.g. "x = x * 2;" but not "x = f(x);") */
+        auto& info = localVars_[varDecl];
+        info.numStores++;
+
+        if (hasSideEffects_)
+            info.numReads += numSelfReads_;
+        else
+            removableStores_[ast] = varDecl;
+    }
+    else
+        VISIT_DEFAULT(ExprStmnt);
+}
+
+/* --- Expressions --- */
+
+IMPLEMENT_VISIT_PROC(UnaryExpr)
+{
+    if (IsLValueOp(ast->op))
+        hasSideEffects_ = true;
+    VISIT_DEFAULT(UnaryExpr);
+}
+
+IMPLEMENT_VISIT_PROC(PostUnaryExpr)
+{
+    hasSideEffects_ = true;
+    VISIT_DEFAULT(PostUnaryExpr);
+}
+
+IMPLEMENT_VISIT_PROC(CallExpr)
+{
+    /* Type constructors and intrinsics without output parameters have no side effects */
+    if (ast->intrinsic != Intrinsic::Undefined)
+    {
+        if (HasIntrinsicSideEffects(ast->intrinsic) || !IntrinsicAdept::Get().GetIntrinsicOutputParameterIndices(ast->intrinsic).empty())
+            hasSideEffects_ = true;
+    }
+    else if (!ast->typeDenoter || !ast->ident.empty())
+        hasSideEffects_ = true;
+
+    VISIT_DEFAULT(CallExpr);
+}
+
+IMPLEMENT_VISIT_PROC(ObjectExpr)
+{
+    /* Count read access to local variable */
+    if (auto varDecl = ast->FetchVarDecl())
+    {
+        if (varDecl == storeTarget_)
+            numSelfReads_++;
+        else
+        {
+            auto it = localVars_.find(varDecl);
+            if (it != localVars_.end())
+                it->second.numReads++;
+        }
+    }
+    VISIT_DEFAULT(ObjectExpr);
+}
+
+IMPLEMENT_VISIT_PROC(AssignExpr)
+{
+    hasSideEffects_ = true;
+    VISIT_DEFAULT(AssignExpr);
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
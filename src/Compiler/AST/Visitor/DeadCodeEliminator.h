@@ -0,0 +1,99 @@
+/*
+ * DeadCodeEliminator.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_DEAD_CODE_ELIMINATOR_H
+#define XSC_DEAD_CODE_ELIMINATOR_H
+
+
+#include "Visitor.h"
+#include <vector>
+#include <map>
+
+
+namespace Xsc
+{
+
+
+/*
+Dead code eliminator AST visitor.
+This helper class for the optimizer removes all statements that are marked as dead code by the ControlPathAnalyzer,
+statements after a jump statement (i.e. 'break', 'continue', or 'discard'), assignments to local variables that are never read, local variables that are not used at all, and empty statements.
+Statements and initializers with side effects (e.g. function calls with output parameters) are never removed.
+*/
+class DeadCodeEliminator : private Visitor
+{
+
+    public:
+
+        // Removes dead code from all functions of the specified program.
+        void EliminateDeadCode(Program& program);
+
+    private:
+
+        // Usage information of a local variable.
+        struct LocalVarInfo
+        {
+            std::size_t numReads                = 0;        // Number of expressions that read the variable.
+            std::size_t numStores               = 0;        // Number of assignment statements to the variable.
+            bool        hasInitializerEffects   = false;    // Specifies whether the initializer has side effects.
+        };
+
+        // Registers all variables of the specified statement as local variables (if they can be removed).
+        void RegisterLocalVars(Stmnt* stmnt);
+
+        // Visits the specified statement list (except dead code) and stores it for the elimination pass.
+        void VisitStmntList(std::vector<StmntPtr>& stmnts);
+
+        // Visits all sub expressions of the specified l-value expression, except the variable that is written to.
+        void VisitLValueSubExprs(Expr* expr);
+
+        // Returns the local variable an assignment expression statement (e.g. "x = y;" or "x++;") writes to, or null.
+        VarDecl* FetchStoreTarget(const ExprStmnt* ast) const;
+
+        // Returns true if the specified local variable and all of its assignments can be removed.
+        bool IsUnusedLocalVar(VarDecl* varDecl) const;
+
+        // Removes dead statements and unused variables from all visited statement lists, and returns true if anything was removed.
+        bool RemoveDeadStmnts();
+
+        /* ----- Visitor implementation ----- */
+
+        DECL_VISIT_PROC( CodeBlock     );
+        DECL_VISIT_PROC( SwitchCase    );
+
+        DECL_VISIT_PROC( VarDecl       );
+
+        DECL_VISIT_PROC( ExprStmnt     );
+
+        DECL_VISIT_PROC( UnaryExpr     );
+        DECL_VISIT_PROC( PostUnaryExpr );
+        DECL_VISIT_PROC( CallExpr      );
+        DECL_VISIT_PROC( ObjectExpr    );
+        DECL_VISIT_PROC( AssignExpr    );
+
+        /* === Members === */
+
+        std::map<VarDecl*, LocalVarInfo>        localVars_;
+        std::map<const Stmnt*, VarDecl*>        removableStores_;   // Assignment statements without side effects, and the variable they write to.
+        std::vector<std::vector<StmntPtr>*>     stmntLists_;
+
+        VarDecl*                                storeTarget_        = nullptr;  // Variable that is written to by the current assignment statement.
+        std::size_t                             numSelfReads_       = 0;        // Number of read accesses to 'storeTarget_' within its own assignment.
+
+        bool                                    hasSideEffects_     = false;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
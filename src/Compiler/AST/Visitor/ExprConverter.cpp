@@ -319,37 +319,31 @@ IMPLEMENT_VISIT_PROC(TernaryExpr)
 // Convert right-hand-side expression (if cast required)
 IMPLEMENT_VISIT_PROC(BinaryExpr)
 {
-    ConvertExpr(ast->lhsExpr, AllPreVisit);
-    ConvertExpr(ast->rhsExpr, AllPreVisit);
+    /* Collect chain of left-hand-side binary expressions to avoid deep recursion (e.g. for sums of thousands of terms) */
+    std::vector<BinaryExpr*> chain;
+
+    for (auto binaryExpr = ast; binaryExpr != nullptr; binaryExpr = binaryExpr->lhsExpr->As<BinaryExpr>())
     {
-        VISIT_DEFAULT(BinaryExpr);
+        ConvertExpr(binaryExpr->lhsExpr, AllPreVisit);
+        ConvertExpr(binaryExpr->rhsExpr, AllPreVisit);
+        chain.push_back(binaryExpr);
     }
-    ConvertExpr(ast->lhsExpr, AllPostVisit);
-    ConvertExpr(ast->rhsExpr, AllPostVisit);
-
-    /* Convert sub expressions if cast required, then reset type denoter */
-    auto lhsTypeDen = ast->lhsExpr->GetTypeDenoter()->GetSub();
-    auto rhsTypeDen = ast->rhsExpr->GetTypeDenoter()->GetSub();
 
-    auto commonTypeDen = TypeDenoter::FindCommonTypeDenoter(lhsTypeDen, rhsTypeDen);
+    /* Visit inner most left-hand-side expression */
+    Visit(chain.back()->lhsExpr);
 
-    /* Ensure type sizes are cast only if necessary */
-    bool matchTypeSize = true;
-    if (ast->op == BinaryOp::Div)
-    {
-        if (rhsTypeDen->IsScalar())
-            matchTypeSize = false;
-    }
-    else if (ast->op == BinaryOp::Mul)
+    /* Visit remaining sub expressions from inner most to outer most binary expression */
+    for (auto it = chain.rbegin(); it != chain.rend(); ++it)
     {
-        if (lhsTypeDen->IsScalar() || rhsTypeDen->IsScalar())
-            matchTypeSize = false;
-    }
+        auto binaryExpr = *it;
 
-    ConvertExprTargetType(ast->lhsExpr, *commonTypeDen, matchTypeSize);
-    ConvertExprTargetType(ast->rhsExpr, *commonTypeDen, matchTypeSize);
+        Visit(binaryExpr->rhsExpr);
 
-    ast->ResetTypeDenoter();
+        ConvertExpr(binaryExpr->lhsExpr, AllPostVisit);
+        ConvertExpr(binaryExpr->rhsExpr, AllPostVisit);
+
+        ConvertBinaryExprSubTypes(binaryExpr);
+    }
 }
 
 // Wrap unary expression if the next sub expression is again an unary expression
@@ -923,6 +917,33 @@ void ExprConverter::ConvertExprTargetType(ExprPtr& expr, const TypeDenoter& targ
     }
 }
 
+void ExprConverter::ConvertBinaryExprSubTypes(BinaryExpr* ast)
+{
+    /* Convert sub expressions if cast required, then reset type denoter */
+    auto lhsTypeDen = ast->lhsExpr->GetTypeDenoter()->GetSub();
+    auto rhsTypeDen = ast->rhsExpr->GetTypeDenoter()->GetSub();
+
+    auto commonTypeDen = TypeDenoter::FindCommonTypeDenoter(lhsTypeDen, rhsTypeDen);
+
+    /* Ensure type sizes are cast only if necessary */
+    bool matchTypeSize = true;
+    if (ast->op == BinaryOp::Div)
+    {
+        if (rhsTypeDen->IsScalar())
+            matchTypeSize = false;
+    }
+    else if (ast->op == BinaryOp::Mul)
+    {
+        if (lhsTypeDen->IsScalar() || rhsTypeDen->IsScalar())
+            matchTypeSize = false;
+    }
+
+    ConvertExprTargetType(ast->lhsExpr, *commonTypeDen, matchTypeSize);
+    ConvertExprTargetType(ast->rhsExpr, *commonTypeDen, matchTypeSize);
+
+    ast->ResetTypeDenoter();
+}
+
 void ExprConverter::ConvertExprTargetTypeInitializer(ExprPtr& expr, InitializerExpr* initExpr, const TypeDenoter& targetTypeDen)
 {
     /* Convert initializer expression into type constructor */
@@ -154,6 +154,9 @@ class ExprConverter : public VisitorTracker
         // Converts the expression to the specified target type and according to the specified flags (if enabled in the current conversion).
         void ConvertExprTargetType(ExprPtr& expr, const TypeDenoter& targetTypeDen, bool matchTypeSize = true);
 
+        // Converts the sub expressions of the binary expression to their common type (if cast required).
+        void ConvertBinaryExprSubTypes(BinaryExpr* ast);
+
         // Converts the expression from an initializer list to a type constructor.
         void ConvertExprTargetTypeInitializer(ExprPtr& expr, InitializerExpr* initExpr, const TypeDenoter& targetTypeDen);
 
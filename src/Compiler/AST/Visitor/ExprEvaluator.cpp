@@ -12,6 +12,7 @@
 #include "ReportIdents.h"
 #include <sstream>
 #include <string>
+#include <vector>
 
 
 namespace Xsc
@@ -119,6 +120,11 @@ void ExprEvaluator::SetObjectExprCallback(const OnObjectExprCallback& callback)
     }
 }
 
+bool ExprEvaluator::IsReducedBinaryExpr(const BinaryExpr* ast) const
+{
+    return (flags_(EvaluateReducedBinaryExpr) && (ast->op == BinaryOp::LogicalAnd || ast->op == BinaryOp::LogicalOr));
+}
+
 Variant ExprEvaluator::EvaluateBinaryOp(const BinaryExpr* ast, Variant lhs, Variant rhs)
 {
     switch (ast->op)
@@ -325,7 +331,7 @@ IMPLEMENT_VISIT_PROC(TernaryExpr)
 // EXPR OP EXPR
 IMPLEMENT_VISIT_PROC(BinaryExpr)
 {
-    if (flags_(EvaluateReducedBinaryExpr) && (ast->op == BinaryOp::LogicalAnd || ast->op == BinaryOp::LogicalOr))
+    if (IsReducedBinaryExpr(ast))
     {
         if (ast->op == BinaryOp::LogicalAnd)
         {
@@ -380,20 +386,31 @@ IMPLEMENT_VISIT_PROC(BinaryExpr)
     }
     else
     {
-        /* Visit left hand side expression */
-        Visit(ast->lhsExpr);
-        if (auto lhs = Pop())
+        /* Collect chain of left hand side binary expressions to avoid deep recursion (e.g. for sums of thousands of terms) */
+        std::vector<BinaryExpr*> chain;
+
+        for (auto binaryExpr = ast; binaryExpr != nullptr && !IsReducedBinaryExpr(binaryExpr); binaryExpr = binaryExpr->lhsExpr->As<BinaryExpr>())
+            chain.push_back(binaryExpr);
+
+        /* Visit inner most left hand side expression */
+        Visit(chain.back()->lhsExpr);
+        auto value = Pop();
+
+        /* Evaluate chain from inner most to outer most binary expression */
+        for (auto it = chain.rbegin(); it != chain.rend() && value; ++it)
         {
             /* Visit right hand side expression */
-            Visit(ast->rhsExpr);
+            Visit((*it)->rhsExpr);
             if (auto rhs = Pop())
-            {
-                if (auto result = EvaluateBinaryOp(ast, lhs, rhs))
-                {
-                    Push(result);
-                    return;
-                }
-            }
+                value = EvaluateBinaryOp(*it, value, rhs);
+            else
+                value = {};
+        }
+
+        if (value)
+        {
+            Push(value);
+            return;
         }
     }
 
@@ -55,6 +55,9 @@ class ExprEvaluator : private Visitor
 
         void SetObjectExprCallback(const OnObjectExprCallback& callback);
 
+        // Returns true if the specified binary expression is a logical expression that is evaluated with short-circuit evaluation.
+        bool IsReducedBinaryExpr(const BinaryExpr* ast) const;
+
         Variant EvaluateBinaryOp(const BinaryExpr* ast, Variant lhs, Variant rhs);
         Variant EvaluateUnaryOp(const UnaryExpr* ast, Variant rhs);
 
@@ -0,0 +1,1012 @@
+/*
+ * FunctionInliner.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "FunctionInliner.h"
+#include "ASTCopier.h"
+#include "ASTFactory.h"
+#include "IntrinsicAdept.h"
+#include "AST.h"
+
+
+namespace Xsc
+{
+
+
+/* Maximal number of statements of a function that is inlined at more than one call site */
+static const std::size_t g_maxNumInlinedStmnts = 8;
+
+void FunctionInliner::InlineFunctions(Program& program, const NameMangling& nameMangling)
+{
+    nameMangling_ = (&nameMangling);
+
+    /* Count call sites of all functions first */
+    pass_ = Pass::CountCallSites;
+    Visit(&program);
+
+    /* Inline function calls into their callers */
+    pass_ = Pass::InlineCalls;
+    Visit(&program);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void FunctionInliner::InlineStmntList(std::vector<StmntPtr>& stmnts)
+{
+    for (std::size_t i = 0; i < stmnts.size();)
+    {
+        if (!stmnts[i]->flags(AST::isDeadCode))
+        {
+            /* Inline function calls in nested statements and expressions first */
+            Visit(stmnts[i]);
+
+            bool isResultUsed = true;
+            if (auto exprRef = FindInlineableCallExpr(stmnts[i].get(), isResultUsed))
+            {
+                std::vector<StmntPtr> inlinedStmnts;
+                InlineCallExpr(*exprRef, inlinedStmnts);
+
+                /* Remove expression statements whose result is not used */
+                if (!isResultUsed)
+                    stmnts.erase(stmnts.begin() + i);
+
+                /* Insert inlined statements before the statement of the call site */
+                stmnts.insert(stmnts.begin() + i, inlinedStmnts.begin(), inlinedStmnts.end());
+                i += inlinedStmnts.size();
+
+                if (!isResultUsed)
+                    continue;
+            }
+        }
+        ++i;
+    }
+}
+
+ExprPtr* FunctionInliner::FindInlineableCallExpr(Stmnt* stmnt, bool& isResultUsed)
+{
+    ExprPtr* exprRef = nullptr;
+    isResultUsed = true;
+
+    /* Only consider function calls at the top-level of a statement, so the evaluation order remains unchanged */
+    if (auto exprStmnt = stmnt->As<ExprStmnt>())
+    {
+        if (auto assignExpr = exprStmnt->expr->As<AssignExpr>())
+            exprRef = &(assignExpr->rvalueExpr);
+        else
+        {
+            exprRef = &(exprStmnt->expr);
+            isResultUsed = false;
+        }
+    }
+    else if (auto varDeclStmnt = stmnt->As<VarDeclStmnt>())
+    {
+        if (varDeclStmnt->varDecls.size() == 1)
+            exprRef = &(varDeclStmnt->varDecls.front()->initializer);
+    }
+    else if (auto returnStmnt = stmnt->As<ReturnStmnt>())
+        exprRef = &(returnStmnt->expr);
+
+    if (exprRef && *exprRef)
+    {
+        if (auto callExpr = (*exprRef)->As<CallExpr>())
+        {
+            if (CanInlineCallExpr(callExpr))
+                return exprRef;
+        }
+    }
+
+    return nullptr;
+}
+
+// Returns true if the specified parameter is copied into a local variable (otherwise, it is replaced by its argument, e.g. for textures and samplers).
+static bool IsCopiedParameter(const VarDeclStmnt* param)
+{
+    const auto& typeDen = param->typeSpecifier->typeDenoter->GetAliased();
+    return (typeDen.IsBase() || typeDen.IsStruct());
+}
+
+// Returns true if the specified expression is a variable that can not be written by any called function (i.e. a local variable of the caller, a uniform, or a shader input).
+static bool IsCallerOwnedVarExpr(const Expr* expr)
+{
+    if (auto objectExpr = expr->As<ObjectExpr>())
+    {
+        if (objectExpr->prefixExpr)
+            return IsCallerOwnedVarExpr(objectExpr->prefixExpr.get());
+
+        if (auto varDecl = objectExpr->FetchVarDecl())
+        {
+            if (varDecl->flags(VarDecl::isShaderInput))
+                return true;
+            if (auto declStmnt = varDecl->declStmntRef)
+                return (!declStmnt->flags(VarDeclStmnt::isGlobal) || !varDecl->IsStatic());
+        }
+    }
+    return false;
+}
+
+// Returns true if the specified expression has no side effects, i.e. it can be evaluated any number of times and in any order.
+static bool IsPureExpr(const Expr* expr)
+{
+    if (!expr)
+        return true;
+
+    switch (expr->Type())
+    {
+        case AST::Types::LiteralExpr:
+            return true;
+
+        case AST::Types::ObjectExpr:
+            return IsPureExpr(static_cast<const ObjectExpr*>(expr)->prefixExpr.get());
+
+        case AST::Types::ArrayExpr:
+        {
+            auto arrayExpr = static_cast<const ArrayExpr*>(expr);
+            for (const auto& index : arrayExpr->arrayIndices)
+            {
+                if (!IsPureExpr(index.get()))
+                    return false;
+            }
+            return IsPureExpr(arrayExpr->prefixExpr.get());
+        }
+
+        case AST::Types::BracketExpr:
+            return IsPureExpr(static_cast<const BracketExpr*>(expr)->expr.get());
+
+        case AST::Types::CastExpr:
+            return IsPureExpr(static_cast<const CastExpr*>(expr)->expr.get());
+
+        case AST::Types::UnaryExpr:
+        {
+            auto unaryExpr = static_cast<const UnaryExpr*>(expr);
+            return (!IsLValueOp(unaryExpr->op) && IsPureExpr(unaryExpr->expr.get()));
+        }
+
+        case AST::Types::BinaryExpr:
+        {
+            auto binaryExpr = static_cast<const BinaryExpr*>(expr);
+            return (IsPureExpr(binaryExpr->lhsExpr.get()) && IsPureExpr(binaryExpr->rhsExpr.get()));
+        }
+
+        case AST::Types::TernaryExpr:
+        {
+            auto ternaryExpr = static_cast<const TernaryExpr*>(expr);
+            return (IsPureExpr(ternaryExpr->condExpr.get()) && IsPureExpr(ternaryExpr->thenExpr.get()) && IsPureExpr(ternaryExpr->elseExpr.get()));
+        }
+
+        case AST::Types::CallExpr:
+        {
+            auto callExpr = static_cast<const CallExpr*>(expr);
+
+            if (!IsPureExpr(callExpr->prefixExpr.get()))
+                return false;
+
+            if (callExpr->intrinsic != Intrinsic::Undefined)
+            {
+                /* Only intrinsics without side effects and output parameters */
+                if (HasIntrinsicSideEffects(callExpr->intrinsic))
+                    return false;
+                if (!IntrinsicAdept::Get().GetIntrinsicOutputParameterIndices(callExpr->intrinsic).empty())
+                    return false;
+            }
+            else if (!callExpr->typeDenoter || !callExpr->ident.empty())
+            {
+                /* User defined functions can have arbitrary side effects */
+                return false;
+            }
+
+            for (const auto& arg : callExpr->arguments)
+            {
+                if (!IsPureExpr(arg.get()))
+                    return false;
+            }
+
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+// Returns true if the specified expression is cheap enough to be evaluated multiple times (e.g. "a.x + 1").
+static bool IsCheapExpr(const Expr* expr)
+{
+    if (!expr)
+        return true;
+
+    switch (expr->Type())
+    {
+        case AST::Types::LiteralExpr:
+            return true;
+
+        case AST::Types::ObjectExpr:
+            return IsCheapExpr(static_cast<const ObjectExpr*>(expr)->prefixExpr.get());
+
+        case AST::Types::BracketExpr:
+            return IsCheapExpr(static_cast<const BracketExpr*>(expr)->expr.get());
+
+        case AST::Types::CastExpr:
+            return IsCheapExpr(static_cast<const CastExpr*>(expr)->expr.get());
+
+        case AST::Types::UnaryExpr:
+            return IsCheapExpr(static_cast<const UnaryExpr*>(expr)->expr.get());
+
+        case AST::Types::BinaryExpr:
+        {
+            /* Only a single operator, so inlined expressions do not grow quadratically */
+            auto binaryExpr = static_cast<const BinaryExpr*>(expr);
+            return
+            (
+                !binaryExpr->lhsExpr->As<BinaryExpr>() && IsCheapExpr(binaryExpr->lhsExpr.get()) &&
+                !binaryExpr->rhsExpr->As<BinaryExpr>() && IsCheapExpr(binaryExpr->rhsExpr.get())
+            );
+        }
+
+        default:
+            return false;
+    }
+}
+
+void FunctionInliner::InlineCallExpr(ExprPtr& expr, std::vector<StmntPtr>& inlinedStmnts)
+{
+    auto callExpr = expr->As<CallExpr>();
+    auto funcDecl = callExpr->GetFunctionImpl();
+
+    const auto tempIdent = nameMangling_->temporaryPrefix + "inl" + std::to_string(tempVarCounter_++);
+
+    /* Rename all local variables of the inlined function, to avoid name collisions with the caller */
+    ASTCopier copier;
+    copier.SetVarIdentPrefix(tempIdent + "_");
+
+    std::vector<StmntPtr> blockStmnts;
+    std::vector<StmntPtr> copyOutStmnts;
+
+    /* Declare temporary variable for the return value */
+    VarDeclStmntPtr resultStmnt;
+
+    if (!funcDecl->HasVoidReturnType())
+    {
+        resultStmnt = ASTFactory::MakeVarDeclStmnt(ASTFactory::MakeTypeSpecifier(funcDecl->returnType->typeDenoter), tempIdent);
+        inlinedStmnts.push_back(resultStmnt);
+    }
+
+    /* Copy arguments into local variables of the parameters (copy-in) */
+    for (std::size_t i = 0; i < funcDecl->parameters.size(); ++i)
+    {
+        auto param      = funcDecl->parameters[i].get();
+        auto paramVar   = param->varDecls.front().get();
+        auto& arg       = callExpr->arguments[i];
+
+        if (!IsCopiedParameter(param))
+        {
+            copier.ReplaceSymbol(paramVar, arg);
+            continue;
+        }
+
+        /* Skip parameters that are never used if their arguments have no side effects */
+        if (numVarDeclRefs_[paramVar] == 0 && IsPureExpr(arg.get()))
+            continue;
+
+        /* Replace read-only parameters by their arguments, if the argument variables can not change within the inlined function body */
+        if ( !param->IsOutput() && !IsParameterWritten(paramVar) && IsCallerOwnedVarExpr(arg.get()) &&
+             arg->GetTypeDenoter()->Equals(*param->typeSpecifier->typeDenoter) )
+        {
+            copier.ReplaceSymbol(paramVar, arg);
+            continue;
+        }
+
+        auto localStmnt = std::static_pointer_cast<VarDeclStmnt>(copier.CopyStmnt(param));
+        {
+            localStmnt->flags.Remove(VarDeclStmnt::isParameter);
+            localStmnt->typeSpecifier->isInput  = false;
+            localStmnt->typeSpecifier->isOutput = false;
+
+            /* Constant parameters become non-constant, since their initializers are not constant expressions */
+            localStmnt->typeSpecifier->typeModifiers.erase(TypeModifier::Const);
+        }
+        auto localVar = localStmnt->varDecls.front();
+        {
+            localVar->semantic          = Semantic::Undefined;
+            localVar->initializer       = nullptr;
+            localVar->initializerValue  = Variant();
+        }
+
+        /* Copy value of output parameter back to its argument (copy-out), unless it is never written */
+        if (param->IsOutput() && IsParameterWritten(paramVar))
+            copyOutStmnts.push_back(ASTFactory::MakeAssignStmnt(copier.CopyExpr(arg.get()), ASTFactory::MakeObjectExpr(localVar.get())));
+
+        if (param->IsInput())
+            localVar->initializer = arg;
+
+        blockStmnts.push_back(localStmnt);
+    }
+
+    /* Copy function body, and replace the trailing return statement by an assignment to the temporary variable */
+    for (const auto& stmnt : funcDecl->codeBlock->stmnts)
+    {
+        if (auto returnStmnt = stmnt->As<ReturnStmnt>())
+        {
+            if (resultStmnt && returnStmnt->expr)
+            {
+                blockStmnts.push_back(
+                    ASTFactory::MakeAssignStmnt(
+                        ASTFactory::MakeObjectExpr(resultStmnt->varDecls.front().get()),
+                        copier.CopyExpr(returnStmnt->expr.get())
+                    )
+                );
+            }
+        }
+        else
+            blockStmnts.push_back(copier.CopyStmnt(stmnt.get()));
+    }
+
+    blockStmnts.insert(blockStmnts.end(), copyOutStmnts.begin(), copyOutStmnts.end());
+
+    /* Wrap inlined statements into their own scope */
+    if (!blockStmnts.empty())
+    {
+        auto codeBlockStmnt = ASTFactory::MakeCodeBlockStmnt(blockStmnts.front());
+        codeBlockStmnt->codeBlock->stmnts = std::move(blockStmnts);
+        inlinedStmnts.push_back(codeBlockStmnt);
+    }
+
+    /* Replace function call by the temporary variable */
+    if (resultStmnt)
+        expr = ASTFactory::MakeObjectExpr(resultStmnt->varDecls.front().get());
+}
+
+// Returns true if the specified expression does not need to be enclosed in brackets when it is used as operand.
+static bool IsPrimaryExpr(const Expr* expr)
+{
+    switch (expr->Type())
+    {
+        case AST::Types::ObjectExpr:
+        case AST::Types::ArrayExpr:
+        case AST::Types::CallExpr:
+        case AST::Types::BracketExpr:
+        case AST::Types::CastExpr:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void FunctionInliner::InlineExpr(ExprPtr& expr, bool isOperand)
+{
+    if (expr)
+    {
+        /* Inline function calls in sub expressions first */
+        Visit(expr);
+
+        if (auto callExpr = expr->As<CallExpr>())
+        {
+            if (CanInlineCallExprAsExpr(callExpr))
+            {
+                expr = MakeInlinedExpr(callExpr);
+                if (isOperand && !IsPrimaryExpr(expr.get()))
+                    expr = ASTFactory::MakeBracketExpr(expr);
+            }
+        }
+    }
+}
+
+// Returns the specified expression converted to the specified type, if the types are different.
+static ExprPtr MakeConvertedExpr(const ExprPtr& expr, const TypeDenoterPtr& typeDenoter)
+{
+    if (!expr->GetTypeDenoter()->Equals(*typeDenoter))
+        return ASTFactory::MakeCastExpr(typeDenoter, expr);
+    else
+        return expr;
+}
+
+ExprPtr FunctionInliner::MakeInlinedExpr(const CallExpr* callExpr)
+{
+    auto funcDecl = callExpr->GetFunctionImpl();
+
+    /* Replace all parameters by their arguments */
+    ASTCopier copier;
+
+    for (std::size_t i = 0; i < funcDecl->parameters.size(); ++i)
+    {
+        auto param      = funcDecl->parameters[i].get();
+        auto paramVar   = param->varDecls.front().get();
+        const auto& arg = callExpr->arguments[i];
+
+        if (IsCopiedParameter(param))
+        {
+            /* Arguments can be operands in the inlined expression */
+            auto argExpr = MakeConvertedExpr(arg, param->typeSpecifier->typeDenoter);
+            if (!IsPrimaryExpr(argExpr.get()) && argExpr->Type() != AST::Types::LiteralExpr)
+                argExpr = ASTFactory::MakeBracketExpr(argExpr);
+            copier.ReplaceSymbol(paramVar, argExpr);
+        }
+        else
+            copier.ReplaceSymbol(paramVar, arg);
+    }
+
+    /* Copy expression of the only return statement */
+    auto returnStmnt = funcDecl->codeBlock->stmnts.front()->As<ReturnStmnt>();
+
+    return MakeConvertedExpr(copier.CopyExpr(returnStmnt->expr.get()), funcDecl->returnType->typeDenoter);
+}
+
+// Returns true if the specified expression is an l-value that can be evaluated twice without side effects (e.g. "a.b[1]").
+static bool IsSimpleLValueExpr(const Expr* expr)
+{
+    if (auto objectExpr = expr->As<ObjectExpr>())
+        return (!objectExpr->prefixExpr || IsSimpleLValueExpr(objectExpr->prefixExpr.get()));
+
+    if (auto arrayExpr = expr->As<ArrayExpr>())
+    {
+        for (const auto& index : arrayExpr->arrayIndices)
+        {
+            if (index->Type() != AST::Types::LiteralExpr && !(index->Type() == AST::Types::ObjectExpr && IsSimpleLValueExpr(index.get())))
+                return false;
+        }
+        return IsSimpleLValueExpr(arrayExpr->prefixExpr.get());
+    }
+
+    if (auto bracketExpr = expr->As<BracketExpr>())
+        return IsSimpleLValueExpr(bracketExpr->expr.get());
+
+    return false;
+}
+
+bool FunctionInliner::CanInlineCallExpr(const CallExpr* callExpr)
+{
+    /* Intrinsics and member functions can not be inlined */
+    if (callExpr->prefixExpr || callExpr->intrinsic != Intrinsic::Undefined)
+        return false;
+
+    auto funcDecl = callExpr->GetFunctionImpl();
+    if (!funcDecl || callExpr->arguments.size() != funcDecl->parameters.size())
+        return false;
+
+    if (!CanInlineFunction(funcDecl))
+        return false;
+
+    for (std::size_t i = 0; i < funcDecl->parameters.size(); ++i)
+    {
+        auto param  = funcDecl->parameters[i].get();
+        auto arg    = callExpr->arguments[i].get();
+
+        if (!IsCopiedParameter(param))
+        {
+            /* Arguments of replaced parameters must be plain objects (e.g. textures and samplers) */
+            if (arg->Type() != AST::Types::ObjectExpr)
+                return false;
+        }
+        else if (param->IsOutput())
+        {
+            /* Arguments of output parameters are evaluated twice (copy-in and copy-out) */
+            if (!IsSimpleLValueExpr(arg))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+bool FunctionInliner::CanInlineCallExprAsExpr(const CallExpr* callExpr)
+{
+    if (!CanInlineCallExpr(callExpr))
+        return false;
+
+    /* Function body must only consist of a return statement without side effects */
+    auto funcDecl = callExpr->GetFunctionImpl();
+
+    const auto& stmnts = funcDecl->codeBlock->stmnts;
+    if (stmnts.size() != 1)
+        return false;
+
+    auto returnStmnt = stmnts.front()->As<ReturnStmnt>();
+    if (!returnStmnt || !returnStmnt->expr || !IsPureExpr(returnStmnt->expr.get()))
+        return false;
+
+    /* Arguments replace their parameters, so they must have no side effects and must be cheap if they are used multiple times */
+    for (std::size_t i = 0; i < funcDecl->parameters.size(); ++i)
+    {
+        auto param  = funcDecl->parameters[i].get();
+        auto arg    = callExpr->arguments[i].get();
+
+        if (param->IsOutput() || !IsPureExpr(arg))
+            return false;
+
+        if (numVarDeclRefs_[param->varDecls.front().get()] > 1 && !IsCheapExpr(arg))
+            return false;
+    }
+
+    return true;
+}
+
+// Returns true if the specified type is a structure that is used as shader input or output (see StructParameterAnalyzer).
+static bool IsShaderIOStructType(const TypeDenoter& typeDen)
+{
+    if (auto structTypeDen = typeDen.GetAliased().As<StructTypeDenoter>())
+    {
+        if (auto structDecl = structTypeDen->structDeclRef)
+            return structDecl->flags(StructDecl::isShaderInput | StructDecl::isShaderOutput);
+    }
+    return false;
+}
+
+// Returns true if the parameters and the return type of the specified function can be inlined.
+static bool CanInlineFunctionSignature(const FunctionDecl* funcDecl)
+{
+    /* Check return type (entry point structures are resolved into global input/output variables) */
+    if (!funcDecl->HasVoidReturnType())
+    {
+        const auto& returnTypeDen = *(funcDecl->returnType->typeDenoter);
+        if (returnTypeDen.GetAliased().IsArray() || IsShaderIOStructType(returnTypeDen))
+            return false;
+    }
+
+    /* Check parameter types */
+    for (const auto& param : funcDecl->parameters)
+    {
+        if (param->varDecls.size() != 1 || !param->varDecls.front()->arrayDims.empty() || param->IsUniform())
+            return false;
+
+        const auto& paramTypeDen = *(param->typeSpecifier->typeDenoter);
+        if (paramTypeDen.GetAliased().IsArray() || IsShaderIOStructType(paramTypeDen))
+            return false;
+
+        /* Parameters that are replaced by their arguments must not be written to */
+        if (!IsCopiedParameter(param.get()) && param->IsOutput())
+            return false;
+    }
+
+    return true;
+}
+
+bool FunctionInliner::CanInlineFunction(FunctionDecl* funcDecl)
+{
+    auto it = inlineableFuncs_.find(funcDecl);
+    if (it != inlineableFuncs_.end())
+        return it->second;
+
+    bool canInline = false;
+
+    if ( !funcDecl->IsForwardDecl() &&
+         !funcDecl->IsMemberFunction() &&
+         !funcDecl->flags(FunctionDecl::isEntryPoint | FunctionDecl::isSecondaryEntryPoint) )
+    {
+        canInline = (CanInlineFunctionSignature(funcDecl) && AnalyzeFunctionBody(funcDecl));
+    }
+
+    inlineableFuncs_[funcDecl] = canInline;
+
+    return canInline;
+}
+
+bool FunctionInliner::AnalyzeFunctionBody(FunctionDecl* funcDecl)
+{
+    auto prevPass = pass_;
+
+    pass_               = Pass::AnalyzeFunction;
+    canInlineBody_      = true;
+    writesUnknownVar_   = false;
+    numBodyStmnts_      = 0;
+    numReturnStmnts_    = 0;
+
+    Visit(funcDecl->codeBlock);
+
+    pass_ = prevPass;
+
+    /* Assume all parameters to be written, if an unknown variable is written */
+    if (writesUnknownVar_)
+    {
+        for (const auto& param : funcDecl->parameters)
+        {
+            for (const auto& varDecl : param->varDecls)
+                writtenVarDecls_.insert(varDecl.get());
+        }
+    }
+
+    if (!canInlineBody_)
+        return false;
+
+    /* The only return statement must be the last statement of the function body */
+    const auto& stmnts = funcDecl->codeBlock->stmnts;
+
+    if (numReturnStmnts_ > 0)
+    {
+        if (numReturnStmnts_ > 1 || stmnts.empty() || stmnts.back()->Type() != AST::Types::ReturnStmnt)
+            return false;
+    }
+    else if (!funcDecl->HasVoidReturnType())
+        return false;
+
+    /* Inline small functions, and functions with only a single call site */
+    return (numBodyStmnts_ <= g_maxNumInlinedStmnts || numCallSites_[funcDecl] == 1);
+}
+
+// Returns the variable of the specified l-value expression (e.g. "x" for "x.y[1]"), or null if the expression has no variable.
+static const VarDecl* FetchLValueVarDecl(const Expr* expr)
+{
+    if (auto objectExpr = expr->As<ObjectExpr>())
+    {
+        if (objectExpr->prefixExpr)
+            return FetchLValueVarDecl(objectExpr->prefixExpr.get());
+        else if (objectExpr->symbolRef)
+            return objectExpr->symbolRef->As<VarDecl>();
+    }
+    else if (auto arrayExpr = expr->As<ArrayExpr>())
+        return FetchLValueVarDecl(arrayExpr->prefixExpr.get());
+    else if (auto bracketExpr = expr->As<BracketExpr>())
+        return FetchLValueVarDecl(bracketExpr->expr.get());
+    return nullptr;
+}
+
+void FunctionInliner::MarkLValueWritten(const Expr* expr)
+{
+    if (auto varDecl = FetchLValueVarDecl(expr))
+        writtenVarDecls_.insert(varDecl);
+    else
+        writesUnknownVar_ = true;
+}
+
+bool FunctionInliner::IsParameterWritten(const VarDecl* paramVar) const
+{
+    return (writtenVarDecls_.find(paramVar) != writtenVarDecls_.end());
+}
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void FunctionInliner::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+IMPLEMENT_VISIT_PROC(CodeBlock)
+{
+    if (pass_ == Pass::InlineCalls)
+        InlineStmntList(ast->stmnts);
+    else
+        VISIT_DEFAULT(CodeBlock);
+}
+
+IMPLEMENT_VISIT_PROC(SwitchCase)
+{
+    if (pass_ == Pass::InlineCalls)
+    {
+        Visit(ast->expr);
+        InlineStmntList(ast->stmnts);
+    }
+    else
+        VISIT_DEFAULT(SwitchCase);
+}
+
+/* --- Declarations --- */
+
+IMPLEMENT_VISIT_PROC(VarDecl)
+{
+    if (pass_ == Pass::InlineCalls)
+        InlineExpr(ast->initializer);
+    else
+        VISIT_DEFAULT(VarDecl);
+}
+
+IMPLEMENT_VISIT_PROC(FunctionDecl)
+{
+    /* Skip forward declarations */
+    if (ast->codeBlock)
+        VISIT_DEFAULT(FunctionDecl);
+}
+
+/* --- Declaration statements --- */
+
+IMPLEMENT_VISIT_PROC(BufferDeclStmnt)
+{
+    if (pass_ == Pass::AnalyzeFunction)
+        canInlineBody_ = false;
+    VISIT_DEFAULT(BufferDeclStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(SamplerDeclStmnt)
+{
+    if (pass_ == Pass::AnalyzeFunction)
+        canInlineBody_ = false;
+    VISIT_DEFAULT(SamplerDeclStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(VarDeclStmnt)
+{
+    if (pass_ == Pass::AnalyzeFunction)
+    {
+        /* Local structures and static variables can not be inlined */
+        if (ast->typeSpecifier->structDecl || ast->typeSpecifier->HasAnyStorageClassOf({ StorageClass::Static }))
+            canInlineBody_ = false;
+        numBodyStmnts_++;
+    }
+    VISIT_DEFAULT(VarDeclStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(AliasDeclStmnt)
+{
+    if (pass_ == Pass::AnalyzeFunction)
+        canInlineBody_ = false;
+    VISIT_DEFAULT(AliasDeclStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(BasicDeclStmnt)
+{
+    if (pass_ == Pass::AnalyzeFunction)
+        canInlineBody_ = false;
+    VISIT_DEFAULT(BasicDeclStmnt);
+}
+
+/* --- Statements --- */
+
+IMPLEMENT_VISIT_PROC(ForLoopStmnt)
+{
+    numBodyStmnts_++;
+    if (pass_ == Pass::InlineCalls)
+    {
+        Visit(ast->initStmnt);
+        InlineExpr(ast->condition);
+        InlineExpr(ast->iteration);
+        Visit(ast->bodyStmnt);
+    }
+    else
+        VISIT_DEFAULT(ForLoopStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(WhileLoopStmnt)
+{
+    numBodyStmnts_++;
+    if (pass_ == Pass::InlineCalls)
+    {
+        InlineExpr(ast->condition);
+        Visit(ast->bodyStmnt);
+    }
+    else
+        VISIT_DEFAULT(WhileLoopStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(DoWhileLoopStmnt)
+{
+    numBodyStmnts_++;
+    if (pass_ == Pass::InlineCalls)
+    {
+        Visit(ast->bodyStmnt);
+        InlineExpr(ast->condition);
+    }
+    else
+        VISIT_DEFAULT(DoWhileLoopStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(IfStmnt)
+{
+    numBodyStmnts_++;
+    if (pass_ == Pass::InlineCalls)
+    {
+        InlineExpr(ast->condition);
+        Visit(ast->bodyStmnt);
+        Visit(ast->elseStmnt);
+    }
+    else
+        VISIT_DEFAULT(IfStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(SwitchStmnt)
+{
+    numBodyStmnts_++;
+    if (pass_ == Pass::InlineCalls)
+    {
+        InlineExpr(ast->selector);
+        Visit(ast->cases);
+    }
+    else
+        VISIT_DEFAULT(SwitchStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(ExprStmnt)
+{
+    numBodyStmnts_++;
+    if (pass_ == Pass::InlineCalls)
+        InlineExpr(ast->expr);
+    else
+        VISIT_DEFAULT(ExprStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(ReturnStmnt)
+{
+    numBodyStmnts_++;
+    numReturnStmnts_++;
+    if (pass_ == Pass::InlineCalls)
+        InlineExpr(ast->expr);
+    else
+        VISIT_DEFAULT(ReturnStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(CtrlTransferStmnt)
+{
+    numBodyStmnts_++;
+    VISIT_DEFAULT(CtrlTransferStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(LayoutStmnt)
+{
+    if (pass_ == Pass::AnalyzeFunction)
+        canInlineBody_ = false;
+    VISIT_DEFAULT(LayoutStmnt);
+}
+
+/* --- Expressions --- */
+
+IMPLEMENT_VISIT_PROC(SequenceExpr)
+{
+    if (pass_ == Pass::InlineCalls)
+    {
+        for (auto& subExpr : ast->exprs)
+            InlineExpr(subExpr);
+    }
+    else
+        VISIT_DEFAULT(SequenceExpr);
+}
+
+IMPLEMENT_VISIT_PROC(TypeSpecifierExpr)
+{
+    if (pass_ == Pass::AnalyzeFunction)
+        canInlineBody_ = false;
+    VISIT_DEFAULT(TypeSpecifierExpr);
+}
+
+IMPLEMENT_VISIT_PROC(TernaryExpr)
+{
+    if (pass_ == Pass::InlineCalls)
+    {
+        InlineExpr(ast->condExpr, true);
+        InlineExpr(ast->thenExpr, true);
+        InlineExpr(ast->elseExpr, true);
+    }
+    else
+        VISIT_DEFAULT(TernaryExpr);
+}
+
+IMPLEMENT_VISIT_PROC(BinaryExpr)
+{
+    if (pass_ == Pass::InlineCalls)
+    {
+        /* Collect chain of left-hand-side binary expressions to avoid deep recursion (e.g. for sums of thousands of terms) */
+        std::vector<BinaryExpr*> lhsChain;
+
+        for (auto binaryExpr = ast; binaryExpr != nullptr; binaryExpr = binaryExpr->lhsExpr->As<BinaryExpr>())
+            lhsChain.push_back(binaryExpr);
+
+        InlineExpr(lhsChain.back()->lhsExpr, true);
+
+        for (auto it = lhsChain.rbegin(); it != lhsChain.rend(); ++it)
+            InlineExpr((*it)->rhsExpr, true);
+    }
+    else
+        VISIT_DEFAULT(BinaryExpr);
+}
+
+IMPLEMENT_VISIT_PROC(UnaryExpr)
+{
+    if (pass_ == Pass::AnalyzeFunction && IsLValueOp(ast->op))
+        MarkLValueWritten(ast->expr.get());
+
+    /* Don't replace l-values of increment and decrement operators */
+    if (pass_ == Pass::InlineCalls && !IsLValueOp(ast->op))
+        InlineExpr(ast->expr, true);
+    else
+        VISIT_DEFAULT(UnaryExpr);
+}
+
+IMPLEMENT_VISIT_PROC(PostUnaryExpr)
+{
+    if (pass_ == Pass::AnalyzeFunction)
+        MarkLValueWritten(ast->expr.get());
+    VISIT_DEFAULT(PostUnaryExpr);
+}
+
+IMPLEMENT_VISIT_PROC(CallExpr)
+{
+    if (pass_ == Pass::CountCallSites)
+    {
+        if (auto funcDecl = ast->GetFunctionImpl())
+            numCallSites_[funcDecl]++;
+    }
+    else if (pass_ == Pass::AnalyzeFunction)
+    {
+        /* Output arguments are written by the called function */
+        ast->ForEachOutputArgument(
+            [this](ExprPtr& argExpr, VarDecl* /*param*/)
+            {
+                MarkLValueWritten(argExpr.get());
+            }
+        );
+    }
+
+    if (pass_ == Pass::InlineCalls)
+    {
+        Visit(ast->prefixExpr);
+        for (auto& arg : ast->arguments)
+            InlineExpr(arg);
+    }
+    else
+        VISIT_DEFAULT(CallExpr);
+}
+
+IMPLEMENT_VISIT_PROC(BracketExpr)
+{
+    if (pass_ == Pass::InlineCalls)
+        InlineExpr(ast->expr);
+    else
+        VISIT_DEFAULT(BracketExpr);
+}
+
+IMPLEMENT_VISIT_PROC(ObjectExpr)
+{
+    if (pass_ == Pass::AnalyzeFunction && !ast->prefixExpr)
+    {
+        if (auto varDecl = ast->FetchVarDecl())
+            numVarDeclRefs_[varDecl]++;
+    }
+
+    if (pass_ == Pass::InlineCalls)
+        InlineExpr(ast->prefixExpr, true);
+    else
+        VISIT_DEFAULT(ObjectExpr);
+}
+
+IMPLEMENT_VISIT_PROC(AssignExpr)
+{
+    if (pass_ == Pass::AnalyzeFunction)
+        MarkLValueWritten(ast->lvalueExpr.get());
+
+    if (pass_ == Pass::InlineCalls)
+    {
+        Visit(ast->lvalueExpr);
+        InlineExpr(ast->rvalueExpr);
+    }
+    else
+        VISIT_DEFAULT(AssignExpr);
+}
+
+IMPLEMENT_VISIT_PROC(ArrayExpr)
+{
+    if (pass_ == Pass::InlineCalls)
+    {
+        InlineExpr(ast->prefixExpr, true);
+        for (auto& index : ast->arrayIndices)
+            InlineExpr(index);
+    }
+    else
+        VISIT_DEFAULT(ArrayExpr);
+}
+
+IMPLEMENT_VISIT_PROC(CastExpr)
+{
+    if (pass_ == Pass::InlineCalls)
+        InlineExpr(ast->expr, true);
+    else
+        VISIT_DEFAULT(CastExpr);
+}
+
+IMPLEMENT_VISIT_PROC(InitializerExpr)
+{
+    if (pass_ == Pass::InlineCalls)
+    {
+        for (auto& subExpr : ast->exprs)
+            InlineExpr(subExpr);
+    }
+    else
+        VISIT_DEFAULT(InitializerExpr);
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
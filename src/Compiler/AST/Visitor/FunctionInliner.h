@@ -0,0 +1,149 @@
+/*
+ * FunctionInliner.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_FUNCTION_INLINER_H
+#define XSC_FUNCTION_INLINER_H
+
+
+#include "Visitor.h"
+#include <Xsc/Xsc.h>
+#include <vector>
+#include <string>
+#include <map>
+#include <set>
+
+
+namespace Xsc
+{
+
+
+/*
+Function inliner AST visitor.
+This helper class for the optimizer inlines all calls to small user functions, and to user functions with only a single call site, into their callers.
+Functions that only consist of a single return statement without side effects are inlined as expressions (also within other expressions),
+where the parameters are replaced by their arguments, if all arguments are free of side effects.
+Other calls are only inlined if they are the top-level expression of an expression statement, an assignment, a variable initializer, or a return statement,
+so the evaluation order of the caller remains unchanged. The arguments are copied into local variables before the inlined function body
+(except for read-only parameters whose arguments are variables that the function body can not write to, e.g. local variables of the caller),
+and the written output parameters are copied back to their arguments afterwards (i.e. the copy-in/copy-out semantics of HLSL).
+Functions with multiple return statements, local structures, or parameters of shader input/output structures are never inlined.
+*/
+class FunctionInliner : private Visitor
+{
+
+    public:
+
+        // Inlines all function calls that are worth being inlined in the specified program. Inlined variables are named with the 'temporaryPrefix'.
+        void InlineFunctions(Program& program, const NameMangling& nameMangling);
+
+    private:
+
+        enum class Pass
+        {
+            CountCallSites,     // Counts the call sites of all functions.
+            AnalyzeFunction,    // Analyzes the body of a function that is about to be inlined.
+            InlineCalls,        // Inlines the function calls into their callers.
+        };
+
+        void InlineStmntList(std::vector<StmntPtr>& stmnts);
+
+        // Returns the reference to the call expression of the specified statement that can be inlined, or null if there is none.
+        ExprPtr* FindInlineableCallExpr(Stmnt* stmnt, bool& isResultUsed);
+
+        // Inlines the specified function call into the output statement list, and replaces the call by its temporary result variable.
+        void InlineCallExpr(ExprPtr& expr, std::vector<StmntPtr>& inlinedStmnts);
+
+        // Inlines all function calls within the specified expression that can be inlined as expressions. Inlined operands are enclosed in brackets.
+        void InlineExpr(ExprPtr& expr, bool isOperand = false);
+
+        // Returns the expression of the specified function call with the parameters being replaced by their arguments.
+        ExprPtr MakeInlinedExpr(const CallExpr* callExpr);
+
+        // Returns true if the specified function call can be inlined.
+        bool CanInlineCallExpr(const CallExpr* callExpr);
+
+        // Returns true if the specified function call can be inlined as expression (see MakeInlinedExpr).
+        bool CanInlineCallExprAsExpr(const CallExpr* callExpr);
+
+        // Returns true if the specified function can be inlined (the result is cached).
+        bool CanInlineFunction(FunctionDecl* funcDecl);
+
+        // Returns true if the body of the specified function can be inlined.
+        bool AnalyzeFunctionBody(FunctionDecl* funcDecl);
+
+        // Marks the variable of the specified l-value expression as written (in the analyzed function body).
+        void MarkLValueWritten(const Expr* expr);
+
+        // Returns true if the specified parameter is written in the body of its function.
+        bool IsParameterWritten(const VarDecl* paramVar) const;
+
+        /* ----- Visitor implementation ----- */
+
+        DECL_VISIT_PROC( CodeBlock         );
+        DECL_VISIT_PROC( SwitchCase        );
+
+        DECL_VISIT_PROC( VarDecl           );
+        DECL_VISIT_PROC( FunctionDecl      );
+
+        DECL_VISIT_PROC( BufferDeclStmnt   );
+        DECL_VISIT_PROC( SamplerDeclStmnt  );
+        DECL_VISIT_PROC( VarDeclStmnt      );
+        DECL_VISIT_PROC( AliasDeclStmnt    );
+        DECL_VISIT_PROC( BasicDeclStmnt    );
+
+        DECL_VISIT_PROC( ForLoopStmnt      );
+        DECL_VISIT_PROC( WhileLoopStmnt    );
+        DECL_VISIT_PROC( DoWhileLoopStmnt  );
+        DECL_VISIT_PROC( IfStmnt           );
+        DECL_VISIT_PROC( SwitchStmnt       );
+        DECL_VISIT_PROC( ExprStmnt         );
+        DECL_VISIT_PROC( ReturnStmnt       );
+        DECL_VISIT_PROC( CtrlTransferStmnt );
+        DECL_VISIT_PROC( LayoutStmnt       );
+
+        DECL_VISIT_PROC( SequenceExpr      );
+        DECL_VISIT_PROC( TypeSpecifierExpr );
+        DECL_VISIT_PROC( TernaryExpr       );
+        DECL_VISIT_PROC( BinaryExpr        );
+        DECL_VISIT_PROC( UnaryExpr         );
+        DECL_VISIT_PROC( PostUnaryExpr     );
+        DECL_VISIT_PROC( CallExpr          );
+        DECL_VISIT_PROC( BracketExpr       );
+        DECL_VISIT_PROC( ObjectExpr        );
+        DECL_VISIT_PROC( AssignExpr        );
+        DECL_VISIT_PROC( ArrayExpr         );
+        DECL_VISIT_PROC( CastExpr          );
+        DECL_VISIT_PROC( InitializerExpr   );
+
+        /* === Members === */
+
+        const NameMangling*                     nameMangling_       = nullptr;
+        std::size_t                             tempVarCounter_     = 0;
+        Pass                                    pass_               = Pass::CountCallSites;
+
+        std::map<const FunctionDecl*, int>      numCallSites_;      // Number of call sites for each function implementation.
+        std::map<const FunctionDecl*, bool>     inlineableFuncs_;   // Cached results of 'CanInlineFunction'.
+
+        std::map<const VarDecl*, int>           numVarDeclRefs_;    // Number of references to each variable in the analyzed function bodies.
+        std::set<const VarDecl*>                writtenVarDecls_;   // Variables that are written in the analyzed function bodies.
+
+        bool                                    canInlineBody_      = false;    // Specifies whether the analyzed function body can be inlined.
+        bool                                    writesUnknownVar_   = false;    // Specifies whether the analyzed function body writes to an unknown variable.
+        std::size_t                             numBodyStmnts_      = 0;
+        std::size_t                             numReturnStmnts_    = 0;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,613 @@
+/*
+ * LivenessAnalyzer.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "LivenessAnalyzer.h"
+#include "AST.h"
+#include <algorithm>
+
+
+namespace Xsc
+{
+
+
+// Returns the number of 32-bit scalar components of the specified type (64-bit components count twice, and resource types have no components).
+static unsigned int NumScalarComponents(const TypeDenoter& typeDen)
+{
+    const auto& aliasedTypeDen = typeDen.GetAliased();
+
+    if (auto baseTypeDen = aliasedTypeDen.As<BaseTypeDenoter>())
+    {
+        const auto dataType = baseTypeDen->dataType;
+        if (dataType == DataType::Undefined || dataType == DataType::String)
+            return 0;
+
+        unsigned int components = 1;
+        if (IsMatrixType(dataType))
+        {
+            const auto matrixDim = MatrixTypeDim(dataType);
+            components = static_cast<unsigned int>(matrixDim.first * matrixDim.second);
+        }
+        else
+            components = static_cast<unsigned int>(VectorTypeDim(dataType));
+
+        return (IsDoubleRealType(dataType) ? components * 2 : components);
+    }
+
+    if (auto arrayTypeDen = aliasedTypeDen.As<ArrayTypeDenoter>())
+    {
+        const auto numElements = arrayTypeDen->NumArrayElements();
+        return (numElements > 0 ? static_cast<unsigned int>(numElements) * NumScalarComponents(*arrayTypeDen->subTypeDenoter) : 0);
+    }
+
+    if (auto structTypeDen = aliasedTypeDen.As<StructTypeDenoter>())
+    {
+        unsigned int components = 0;
+
+        for (auto structDecl = structTypeDen->structDeclRef; structDecl != nullptr; structDecl = structDecl->baseStructRef)
+        {
+            for (const auto& member : structDecl->varMembers)
+            {
+                for (const auto& varDecl : member->varDecls)
+                {
+                    if (!varDecl->IsStatic())
+                        components += NumScalarComponents(*varDecl->GetTypeDenoter());
+                }
+            }
+        }
+
+        return components;
+    }
+
+    return 0;
+}
+
+static unsigned int NumScalarComponents(Expr* expr)
+{
+    return NumScalarComponents(*expr->GetTypeDenoter());
+}
+
+void LivenessAnalyzer::AnalyzeLiveness(Program& program, Reflection::RegisterPressure& registerPressure)
+{
+    registerPressure = Reflection::RegisterPressure();
+
+    /* Global variables never count as local variables */
+    for (const auto& stmnt : program.globalStmnts)
+    {
+        if (auto varDeclStmnt = stmnt->As<VarDeclStmnt>())
+            globalVarDeclStmnts_.insert(varDeclStmnt);
+    }
+
+    if (auto entryPoint = program.entryPointRef)
+    {
+        if (auto peak = AnalyzeFunction(entryPoint))
+        {
+            registerPressure.maxLiveComponents  = peak->components;
+            registerPressure.temporaries        = peak->temporaries;
+
+            if (peak->funcDecl)
+                registerPressure.function = peak->funcDecl->ident.Original();
+
+            if (peak->ast)
+            {
+                const auto& pos = peak->ast->area.Pos();
+                registerPressure.line   = (pos.GetOrigin() ? pos.Row() + pos.GetOrigin()->lineOffset : pos.Row());
+                registerPressure.column = pos.Column();
+            }
+
+            /* Store live variables at the peak with the most scalar components first */
+            for (auto varDecl : peak->liveVarDecls)
+            {
+                if (auto components = NumScalarComponents(*varDecl->GetTypeDenoter()))
+                {
+                    Reflection::LiveVariable liveVar;
+                    {
+                        liveVar.name        = varDecl->ident.Original();
+                        liveVar.components  = components;
+                    }
+                    registerPressure.liveVariables.push_back(liveVar);
+                }
+            }
+
+            std::stable_sort(
+                registerPressure.liveVariables.begin(),
+                registerPressure.liveVariables.end(),
+                [](const Reflection::LiveVariable& lhs, const Reflection::LiveVariable& rhs)
+                {
+                    if (lhs.components != rhs.components)
+                        return (lhs.components > rhs.components);
+                    return (lhs.name < rhs.name);
+                }
+            );
+        }
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+const LivenessAnalyzer::Peak* LivenessAnalyzer::AnalyzeFunction(FunctionDecl* funcDecl)
+{
+    /* Return previous result, or ignore recursive calls */
+    auto it = funcPeaks_.find(funcDecl);
+    if (it != funcPeaks_.end())
+        return &(it->second);
+
+    if (!funcDecl->codeBlock || !callStack_.insert(funcDecl).second)
+        return nullptr;
+
+    /* Store state of the calling function */
+    auto prevPeak       = peak_;
+    auto prevFuncDecl   = funcDecl_;
+
+    VarDeclSet prevLive;
+    std::vector<VarDeclSet> prevBreakLiveVarDecls, prevContinueLiveVarDecls;
+
+    prevLive.swap(live_);
+    prevBreakLiveVarDecls.swap(breakLiveVarDecls_);
+    prevContinueLiveVarDecls.swap(continueLiveVarDecls_);
+
+    /* Analyze function body backwards (no local variable is live at the end of a function) */
+    Peak peak;
+    {
+        peak.funcDecl = funcDecl;
+        peak.ast      = funcDecl;
+    }
+    peak_       = (&peak);
+    funcDecl_   = funcDecl;
+
+    Visit(funcDecl->codeBlock);
+
+    /* Restore state of the calling function */
+    peak_       = prevPeak;
+    funcDecl_   = prevFuncDecl;
+
+    live_.swap(prevLive);
+    breakLiveVarDecls_.swap(prevBreakLiveVarDecls);
+    continueLiveVarDecls_.swap(prevContinueLiveVarDecls);
+
+    callStack_.erase(funcDecl);
+
+    return &(funcPeaks_[funcDecl] = std::move(peak));
+}
+
+void LivenessAnalyzer::AnalyzeStmnts(const std::vector<StmntPtr>& stmnts)
+{
+    for (auto it = stmnts.rbegin(); it != stmnts.rend(); ++it)
+        Visit(*it);
+}
+
+void LivenessAnalyzer::AnalyzeExprPoint(const AST* ast, Expr* expr, VarDecl* defVarDecl)
+{
+    ExprUsage usage;
+    unsigned int temporaries = 0;
+
+    if (defVarDecl && IsLocalVarDecl(defVarDecl))
+        usage.defs.insert(defVarDecl);
+
+    if (expr)
+    {
+        unsigned int resultComponents = 0;
+        temporaries = AnalyzeExpr(expr, usage, resultComponents);
+    }
+
+    /* All variables that are live after this point, read, or written by the expression are live at this point */
+    auto liveVarDecls = live_;
+    liveVarDecls.insert(usage.uses.begin(), usage.uses.end());
+    liveVarDecls.insert(usage.defs.begin(), usage.defs.end());
+
+    RecordPressure(ast, liveVarDecls, temporaries, usage.calleePeak);
+
+    /* Written variables are not live before this point, unless they are also read */
+    for (auto varDecl : usage.defs)
+        live_.erase(varDecl);
+
+    live_.insert(usage.uses.begin(), usage.uses.end());
+}
+
+unsigned int LivenessAnalyzer::AnalyzeExpr(Expr* expr, ExprUsage& usage, unsigned int& resultComponents)
+{
+    resultComponents = 0;
+
+    if (auto objectExpr = expr->As<ObjectExpr>())
+    {
+        if (!objectExpr->prefixExpr)
+        {
+            /* Values of variables are read directly from their registers */
+            if (auto varDecl = objectExpr->FetchVarDecl())
+            {
+                if (IsLocalVarDecl(varDecl))
+                    usage.uses.insert(varDecl);
+            }
+            return 0;
+        }
+        else
+        {
+            /* Member access and vector subscript only need a temporary if its prefix is a temporary */
+            unsigned int prefixComponents = 0;
+            auto temporaries = AnalyzeExpr(objectExpr->prefixExpr.get(), usage, prefixComponents);
+            if (prefixComponents > 0)
+                resultComponents = NumScalarComponents(expr);
+            return std::max(temporaries, prefixComponents);
+        }
+    }
+
+    if (auto arrayExpr = expr->As<ArrayExpr>())
+    {
+        unsigned int prefixComponents = 0;
+        auto temporaries = AnalyzeExpr(arrayExpr->prefixExpr.get(), usage, prefixComponents);
+
+        std::vector<Expr*> indices;
+        for (const auto& index : arrayExpr->arrayIndices)
+            indices.push_back(index.get());
+
+        temporaries = std::max(temporaries, prefixComponents + AnalyzeSubExprs(indices, usage));
+
+        /* Buffer and texture fetches return a temporary */
+        if (prefixComponents > 0 || arrayExpr->prefixExpr->GetTypeDenoter()->GetAliased().As<BufferTypeDenoter>())
+            resultComponents = NumScalarComponents(expr);
+
+        return temporaries;
+    }
+
+    if (auto assignExpr = expr->As<AssignExpr>())
+    {
+        if (assignExpr->op == AssignOp::Set)
+        {
+            if (auto objectExpr = assignExpr->lvalueExpr->As<ObjectExpr>())
+            {
+                if (!objectExpr->prefixExpr)
+                {
+                    /* Assignment to an entire variable does not read the variable */
+                    auto varDecl = objectExpr->FetchVarDecl();
+                    if (varDecl && IsLocalVarDecl(varDecl))
+                        usage.defs.insert(varDecl);
+                    return AnalyzeSubExprs({ assignExpr->rvalueExpr.get() }, usage);
+                }
+            }
+        }
+
+        /* Partial and compound assignments also read the l-value */
+        return AnalyzeSubExprs({ assignExpr->lvalueExpr.get(), assignExpr->rvalueExpr.get() }, usage);
+    }
+
+    std::vector<Expr*> subExprs;
+
+    if (auto callExpr = expr->As<CallExpr>())
+    {
+        if (callExpr->prefixExpr)
+            subExprs.push_back(callExpr->prefixExpr.get());
+        for (const auto& arg : callExpr->arguments)
+            subExprs.push_back(arg.get());
+
+        /* Store the highest peak of all called functions */
+        if (callExpr->intrinsic == Intrinsic::Undefined)
+        {
+            if (auto funcDecl = callExpr->GetFunctionImpl())
+            {
+                if (auto calleePeak = AnalyzeFunction(funcDecl))
+                {
+                    if (!usage.calleePeak || calleePeak->components > usage.calleePeak->components)
+                        usage.calleePeak = calleePeak;
+                }
+            }
+        }
+    }
+    else if (auto binaryExpr = expr->As<BinaryExpr>())
+    {
+        /* Analyze chain of left-hand-side binary expressions iteratively to avoid deep recursion (e.g. for sums of thousands of terms) */
+        std::vector<BinaryExpr*> lhsChain;
+
+        for (auto subExpr = binaryExpr; subExpr != nullptr; subExpr = subExpr->lhsExpr->As<BinaryExpr>())
+            lhsChain.push_back(subExpr);
+
+        auto temporaries = AnalyzeExpr(lhsChain.back()->lhsExpr.get(), usage, resultComponents);
+
+        /* The result of the left-hand-side is held while the right-hand-side is evaluated (see AnalyzeSubExprs) */
+        for (auto it = lhsChain.rbegin(); it != lhsChain.rend(); ++it)
+        {
+            unsigned int rhsComponents = 0;
+            auto rhsTemporaries = AnalyzeExpr((*it)->rhsExpr.get(), usage, rhsComponents);
+            temporaries         = std::max(temporaries, resultComponents + std::max(rhsTemporaries, rhsComponents));
+            resultComponents    = NumScalarComponents(*it);
+        }
+
+        return temporaries;
+    }
+    else if (auto unaryExpr = expr->As<UnaryExpr>())
+        subExprs = { unaryExpr->expr.get() };
+    else if (auto postUnaryExpr = expr->As<PostUnaryExpr>())
+        subExprs = { postUnaryExpr->expr.get() };
+    else if (auto ternaryExpr = expr->As<TernaryExpr>())
+        subExprs = { ternaryExpr->condExpr.get(), ternaryExpr->thenExpr.get(), ternaryExpr->elseExpr.get() };
+    else if (auto bracketExpr = expr->As<BracketExpr>())
+        return AnalyzeExpr(bracketExpr->expr.get(), usage, resultComponents);
+    else if (auto castExpr = expr->As<CastExpr>())
+        subExprs = { castExpr->expr.get() };
+    else if (auto sequenceExpr = expr->As<SequenceExpr>())
+    {
+        for (const auto& subExpr : sequenceExpr->exprs)
+            subExprs.push_back(subExpr.get());
+    }
+    else if (auto initializerExpr = expr->As<InitializerExpr>())
+    {
+        for (const auto& subExpr : initializerExpr->exprs)
+            subExprs.push_back(subExpr.get());
+    }
+    else
+    {
+        /* Literals and type specifiers need no registers */
+        return 0;
+    }
+
+    resultComponents = NumScalarComponents(expr);
+
+    return AnalyzeSubExprs(subExprs, usage);
+}
+
+unsigned int LivenessAnalyzer::AnalyzeSubExprs(const std::vector<Expr*>& exprs, ExprUsage& usage)
+{
+    /* The results of all previous sub expressions are held while the next sub expression is evaluated */
+    unsigned int temporaries = 0, heldComponents = 0;
+
+    for (auto expr : exprs)
+    {
+        if (expr)
+        {
+            unsigned int resultComponents = 0;
+            temporaries = std::max(temporaries, heldComponents + AnalyzeExpr(expr, usage, resultComponents));
+            heldComponents += resultComponents;
+        }
+    }
+
+    return std::max(temporaries, heldComponents);
+}
+
+void LivenessAnalyzer::RecordPressure(const AST* ast, const VarDeclSet& liveVarDecls, unsigned int temporaries, const Peak* calleePeak)
+{
+    unsigned int liveComponents = 0;
+    for (auto varDecl : liveVarDecls)
+        liveComponents += NumScalarComponents(*varDecl->GetTypeDenoter());
+
+    if (liveComponents + temporaries > peak_->components)
+    {
+        peak_->components   = liveComponents + temporaries;
+        peak_->temporaries  = temporaries;
+        peak_->funcDecl     = funcDecl_;
+        peak_->ast          = ast;
+        peak_->liveVarDecls = liveVarDecls;
+    }
+
+    /* Variables that are live across a function call add to the peak of the called function */
+    if (calleePeak && liveComponents + calleePeak->components > peak_->components)
+    {
+        peak_->components   = liveComponents + calleePeak->components;
+        peak_->temporaries  = calleePeak->temporaries;
+        peak_->funcDecl     = calleePeak->funcDecl;
+        peak_->ast          = calleePeak->ast;
+        peak_->liveVarDecls = liveVarDecls;
+        peak_->liveVarDecls.insert(calleePeak->liveVarDecls.begin(), calleePeak->liveVarDecls.end());
+    }
+}
+
+bool LivenessAnalyzer::IsLocalVarDecl(const VarDecl* varDecl) const
+{
+    /*
+    Only variables that are declared inside a function body are local variables
+    (uniforms can be moved out of the global scope into a uniform buffer, e.g. by the uniform packer)
+    */
+    return
+    (
+        varDecl->declStmntRef != nullptr &&
+        !varDecl->declStmntRef->flags(VarDeclStmnt::isGlobal) &&
+        globalVarDeclStmnts_.find(varDecl->declStmntRef) == globalVarDeclStmnts_.end() &&
+        varDecl->structDeclRef == nullptr &&
+        varDecl->bufferDeclRef == nullptr &&
+        !varDecl->IsStatic() &&
+        !varDecl->HasStaticConstInitializer()
+    );
+}
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void LivenessAnalyzer::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+IMPLEMENT_VISIT_PROC(CodeBlock)
+{
+    AnalyzeStmnts(ast->stmnts);
+}
+
+IMPLEMENT_VISIT_PROC(BasicDeclStmnt)
+{
+    // do nothing (local structure declarations have no program points)
+}
+
+IMPLEMENT_VISIT_PROC(VarDeclStmnt)
+{
+    for (auto it = ast->varDecls.rbegin(); it != ast->varDecls.rend(); ++it)
+    {
+        auto varDecl = it->get();
+        if (varDecl->initializer)
+            AnalyzeExprPoint(varDecl, varDecl->initializer.get(), varDecl);
+        else
+            live_.erase(varDecl);
+    }
+}
+
+IMPLEMENT_VISIT_PROC(ForLoopStmnt)
+{
+    const auto liveExit = live_;
+    VarDeclSet liveHeader;
+
+    breakLiveVarDecls_.push_back(liveExit);
+
+    /* Repeat until the live variables at the loop condition do not change anymore */
+    while (true)
+    {
+        live_ = liveHeader;
+        AnalyzeExprPoint(ast->iteration.get(), ast->iteration.get());
+
+        continueLiveVarDecls_.push_back(live_);
+        {
+            Visit(ast->bodyStmnt);
+        }
+        continueLiveVarDecls_.pop_back();
+
+        live_.insert(liveExit.begin(), liveExit.end());
+        AnalyzeExprPoint(ast->condition.get(), ast->condition.get());
+
+        if (live_ == liveHeader)
+            break;
+
+        liveHeader = live_;
+    }
+
+    breakLiveVarDecls_.pop_back();
+
+    Visit(ast->initStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(WhileLoopStmnt)
+{
+    const auto liveExit = live_;
+    VarDeclSet liveHeader;
+
+    breakLiveVarDecls_.push_back(liveExit);
+
+    while (true)
+    {
+        live_ = liveHeader;
+
+        continueLiveVarDecls_.push_back(liveHeader);
+        {
+            Visit(ast->bodyStmnt);
+        }
+        continueLiveVarDecls_.pop_back();
+
+        live_.insert(liveExit.begin(), liveExit.end());
+        AnalyzeExprPoint(ast->condition.get(), ast->condition.get());
+
+        if (live_ == liveHeader)
+            break;
+
+        liveHeader = live_;
+    }
+
+    breakLiveVarDecls_.pop_back();
+}
+
+IMPLEMENT_VISIT_PROC(DoWhileLoopStmnt)
+{
+    const auto liveExit = live_;
+    VarDeclSet liveBody;
+
+    breakLiveVarDecls_.push_back(liveExit);
+
+    while (true)
+    {
+        live_ = liveExit;
+        live_.insert(liveBody.begin(), liveBody.end());
+        AnalyzeExprPoint(ast->condition.get(), ast->condition.get());
+
+        continueLiveVarDecls_.push_back(live_);
+        {
+            Visit(ast->bodyStmnt);
+        }
+        continueLiveVarDecls_.pop_back();
+
+        if (live_ == liveBody)
+            break;
+
+        liveBody = live_;
+    }
+
+    breakLiveVarDecls_.pop_back();
+}
+
+IMPLEMENT_VISIT_PROC(IfStmnt)
+{
+    const auto liveExit = live_;
+
+    Visit(ast->bodyStmnt);
+    auto liveThen = live_;
+
+    live_ = liveExit;
+    Visit(ast->elseStmnt);
+
+    live_.insert(liveThen.begin(), liveThen.end());
+    AnalyzeExprPoint(ast->condition.get(), ast->condition.get());
+}
+
+IMPLEMENT_VISIT_PROC(SwitchStmnt)
+{
+    const auto liveExit = live_;
+
+    /* Visit cases in reverse order, since each case can fall through to the next case */
+    auto liveCases = liveExit;
+    VarDeclSet liveNextCase;
+
+    breakLiveVarDecls_.push_back(liveExit);
+
+    for (auto it = ast->cases.rbegin(); it != ast->cases.rend(); ++it)
+    {
+        live_ = liveExit;
+        live_.insert(liveNextCase.begin(), liveNextCase.end());
+
+        AnalyzeStmnts((*it)->stmnts);
+
+        liveNextCase = live_;
+        liveCases.insert(live_.begin(), live_.end());
+    }
+
+    breakLiveVarDecls_.pop_back();
+
+    live_ = liveCases;
+    AnalyzeExprPoint(ast->selector.get(), ast->selector.get());
+}
+
+IMPLEMENT_VISIT_PROC(ExprStmnt)
+{
+    AnalyzeExprPoint(ast, ast->expr.get());
+}
+
+IMPLEMENT_VISIT_PROC(ReturnStmnt)
+{
+    /* No local variable is live after a return statement */
+    live_.clear();
+    AnalyzeExprPoint(ast, ast->expr.get());
+}
+
+IMPLEMENT_VISIT_PROC(CtrlTransferStmnt)
+{
+    switch (ast->transfer)
+    {
+        case CtrlTransfer::Break:
+            if (!breakLiveVarDecls_.empty())
+                live_ = breakLiveVarDecls_.back();
+            break;
+        case CtrlTransfer::Continue:
+            if (!continueLiveVarDecls_.empty())
+                live_ = continueLiveVarDecls_.back();
+            break;
+        case CtrlTransfer::Discard:
+            live_.clear();
+            break;
+        default:
+            break;
+    }
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
@@ -0,0 +1,122 @@
+/*
+ * LivenessAnalyzer.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_LIVENESS_ANALYZER_H
+#define XSC_LIVENESS_ANALYZER_H
+
+
+#include <Xsc/Reflection.h>
+#include "Visitor.h"
+#include <set>
+#include <map>
+#include <vector>
+
+
+namespace Xsc
+{
+
+
+/*
+Liveness analyzer AST visitor.
+This helper class estimates the register pressure of the entry point for the code reflection (see Reflection::RegisterPressure).
+The statements of each function are visited in reverse order to determine the live local variables at each program point (backward data-flow analysis),
+and the scalar components of all live variables and expression temporaries are accumulated.
+Loops are visited repeatedly until their live variables do not change anymore, and each called function contributes its own peak at the call site.
+*/
+class LivenessAnalyzer : private Visitor
+{
+
+    public:
+
+        // Estimates the register pressure of the entry point of the specified program.
+        void AnalyzeLiveness(Program& program, Reflection::RegisterPressure& registerPressure);
+
+    private:
+
+        using VarDeclSet = std::set<VarDecl*>;
+
+        // Peak register pressure of a function.
+        struct Peak
+        {
+            unsigned int    components      = 0;        // Scalar components of all live variables and temporaries.
+            unsigned int    temporaries     = 0;        // Scalar components of expression temporaries.
+            FunctionDecl*   funcDecl        = nullptr;  // Function that contains the peak.
+            const AST*      ast             = nullptr;  // AST node of the program point at the peak.
+            VarDeclSet      liveVarDecls;               // Live variables at the peak.
+        };
+
+        // Local variables that are read and written by an expression.
+        struct ExprUsage
+        {
+            VarDeclSet      uses;
+            VarDeclSet      defs;
+            const Peak*     calleePeak      = nullptr;  // Highest peak of all functions that are called within the expression.
+        };
+
+        /* === Functions === */
+
+        // Analyzes the specified function (only once), and returns its peak, or null if the function is called recursively.
+        const Peak* AnalyzeFunction(FunctionDecl* funcDecl);
+
+        // Analyzes the statements in reverse order.
+        void AnalyzeStmnts(const std::vector<StmntPtr>& stmnts);
+
+        // Analyzes the program point of the specified expression and updates the live variables. The variable 'defVarDecl' is initialized by the expression.
+        void AnalyzeExprPoint(const AST* ast, Expr* expr, VarDecl* defVarDecl = nullptr);
+
+        // Collects the usage of the specified expression and returns the scalar components of the temporaries while it is evaluated (excluding its result).
+        unsigned int AnalyzeExpr(Expr* expr, ExprUsage& usage, unsigned int& resultComponents);
+
+        // Analyzes the specified sub expressions, which are evaluated one after another, and returns the scalar components of their temporaries.
+        unsigned int AnalyzeSubExprs(const std::vector<Expr*>& exprs, ExprUsage& usage);
+
+        // Updates the peak of the current function with the specified live variables at a program point.
+        void RecordPressure(const AST* ast, const VarDeclSet& liveVarDecls, unsigned int temporaries, const Peak* calleePeak);
+
+        // Returns true if the specified variable is a local variable or parameter that occupies registers.
+        bool IsLocalVarDecl(const VarDecl* varDecl) const;
+
+        /* --- Visitor implementation --- */
+
+        DECL_VISIT_PROC( CodeBlock         );
+
+        DECL_VISIT_PROC( BasicDeclStmnt    );
+        DECL_VISIT_PROC( VarDeclStmnt      );
+        DECL_VISIT_PROC( ForLoopStmnt      );
+        DECL_VISIT_PROC( WhileLoopStmnt    );
+        DECL_VISIT_PROC( DoWhileLoopStmnt  );
+        DECL_VISIT_PROC( IfStmnt           );
+        DECL_VISIT_PROC( SwitchStmnt       );
+        DECL_VISIT_PROC( ExprStmnt         );
+        DECL_VISIT_PROC( ReturnStmnt       );
+        DECL_VISIT_PROC( CtrlTransferStmnt );
+
+        /* === Members === */
+
+        std::set<const VarDeclStmnt*>       globalVarDeclStmnts_;
+
+        std::map<FunctionDecl*, Peak>       funcPeaks_;
+        std::set<FunctionDecl*>             callStack_;
+
+        Peak*                               peak_               = nullptr;  // Peak of the current function.
+        FunctionDecl*                       funcDecl_           = nullptr;  // Current function.
+        VarDeclSet                          live_;                          // Live variables at the current program point.
+
+        std::vector<VarDeclSet>             breakLiveVarDecls_;             // Live variables after the enclosing loops and switch statements.
+        std::vector<VarDeclSet>             continueLiveVarDecls_;          // Live variables at the continuation of the enclosing loops.
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
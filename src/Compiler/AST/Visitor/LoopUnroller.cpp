@@ -0,0 +1,481 @@
+/*
+ * LoopUnroller.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "LoopUnroller.h"
+#include "ExprEvaluator.h"
+#include "ASTCopier.h"
+#include "ASTFactory.h"
+#include "AST.h"
+#include <cstdint>
+#include <stdexcept>
+
+
+namespace Xsc
+{
+
+
+/* Maximal number of iterations for loops with the [unroll] attribute but without explicit iteration count */
+static const std::size_t g_maxNumUnrollIterations   = 256;
+
+/* Maximal number of statements of an unrolled loop */
+static const std::size_t g_maxNumUnrolledStmnts     = 4096;
+
+void LoopUnroller::UnrollLoops(Program& program)
+{
+    Visit(&program);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void LoopUnroller::UnrollStmntList(std::vector<StmntPtr>& stmnts)
+{
+    for (std::size_t i = 0; i < stmnts.size();)
+    {
+        /* Unroll inner loops first */
+        Visit(stmnts[i]);
+
+        if (auto forLoopStmnt = stmnts[i]->As<ForLoopStmnt>())
+        {
+            std::vector<StmntPtr> unrolledStmnts;
+            if (UnrollForLoop(forLoopStmnt, unrolledStmnts))
+            {
+                /* Replace loop by its unrolled statements */
+                stmnts.erase(stmnts.begin() + i);
+                stmnts.insert(stmnts.begin() + i, unrolledStmnts.begin(), unrolledStmnts.end());
+                i += unrolledStmnts.size();
+                continue;
+            }
+        }
+
+        ++i;
+    }
+}
+
+// Returns true if the specified statement list declares any variables (i.e. it must be unrolled within its own scope).
+static bool HasDeclStmnts(const std::vector<StmntPtr>& stmnts)
+{
+    for (const auto& stmnt : stmnts)
+    {
+        if (IsDeclStmntAST(stmnt->Type()))
+            return true;
+    }
+    return false;
+}
+
+bool LoopUnroller::UnrollForLoop(ForLoopStmnt* ast, std::vector<StmntPtr>& unrolledStmnts)
+{
+    /* Only unroll loops with constant iterations and a body that does not interfere with the iterations */
+    auto maxNumIterations = FetchMaxNumIterations(ast);
+    if (maxNumIterations == 0)
+        return false;
+
+    LoopIterations iterations;
+    if (!EvaluateLoopIterations(ast, maxNumIterations, iterations))
+        return false;
+
+    auto numBodyStmnts = AnalyzeLoopBody(ast->bodyStmnt.get(), iterations.inductionVar);
+    if (numBodyStmnts == 0 || numBodyStmnts * iterations.values.size() > g_maxNumUnrolledStmnts)
+        return false;
+
+    /* Only keep the braces of the loop body if it declares variables */
+    auto bodyStmnt      = ast->bodyStmnt.get();
+    auto codeBlockStmnt = bodyStmnt->As<CodeBlockStmnt>();
+
+    if (codeBlockStmnt && !HasDeclStmnts(codeBlockStmnt->codeBlock->stmnts))
+        bodyStmnt = nullptr;
+
+    try
+    {
+        for (const auto& value : iterations.values)
+        {
+            /* Replace the induction variable by its literal value for this iteration */
+            auto literalExpr = ASTFactory::MakeLiteralExprOrNull(value);
+            if (!literalExpr)
+                return false;
+
+            literalExpr->ConvertDataType(iterations.dataType);
+
+            ASTCopier copier;
+            copier.ReplaceSymbol(iterations.inductionVar, literalExpr);
+
+            if (bodyStmnt)
+                unrolledStmnts.push_back(copier.CopyStmnt(bodyStmnt));
+            else
+            {
+                for (const auto& stmnt : codeBlockStmnt->codeBlock->stmnts)
+                    unrolledStmnts.push_back(copier.CopyStmnt(stmnt.get()));
+            }
+        }
+    }
+    catch (const std::exception&)
+    {
+        /* Loop body contains statements that can not be copied (e.g. structure declarations) */
+        return false;
+    }
+
+    return true;
+}
+
+std::size_t LoopUnroller::FetchMaxNumIterations(const ForLoopStmnt* ast) const
+{
+    std::size_t maxNumIterations = 0;
+
+    for (const auto& attrib : ast->attribs)
+    {
+        if (attrib->attributeType == AttributeType::Loop)
+        {
+            /* [loop] attribute always keeps the loop rolled */
+            return 0;
+        }
+        else if (attrib->attributeType == AttributeType::Unroll)
+        {
+            maxNumIterations = g_maxNumUnrollIterations;
+
+            /* Get optional maximal iteration count from [unroll(N)] attribute */
+            if (!attrib->arguments.empty())
+            {
+                ExprEvaluator exprEvaluator;
+                if (auto value = exprEvaluator.EvaluateOrDefault(*attrib->arguments.front()))
+                {
+                    auto intValue = value.ToInt();
+                    if (intValue > 0)
+                        maxNumIterations = std::min(maxNumIterations, static_cast<std::size_t>(intValue));
+                }
+            }
+        }
+    }
+
+    return maxNumIterations;
+}
+
+// Returns the initializer value of the specified object if it refers to a constant variable (e.g. "static const int N = 4;"), but not a uniform or specialization constant.
+static Variant FetchConstVarValue(const ObjectExpr* objectExpr)
+{
+    if (!objectExpr->prefixExpr)
+    {
+        if (auto varDecl = objectExpr->FetchVarDecl())
+        {
+            if (varDecl->IsCompileTimeConst())
+                return varDecl->initializerValue;
+        }
+    }
+    return {};
+}
+
+// Returns the induction variable the specified expression writes to, or null if the expression is not a write access to a variable.
+static VarDecl* FetchIterationVarDecl(const Expr* expr)
+{
+    if (auto objectExpr = expr->As<ObjectExpr>())
+    {
+        if (!objectExpr->prefixExpr)
+            return objectExpr->FetchVarDecl();
+    }
+    return nullptr;
+}
+
+bool LoopUnroller::EvaluateLoopIterations(ForLoopStmnt* ast, std::size_t maxNumIterations, LoopIterations& iterations)
+{
+    if (!ast->condition || !ast->iteration)
+        return false;
+
+    /* Loop initializer must declare a single integral scalar variable with constant initializer */
+    auto varDeclStmnt = ast->initStmnt->As<VarDeclStmnt>();
+    if (!varDeclStmnt || varDeclStmnt->varDecls.size() != 1)
+        return false;
+
+    auto varDecl = varDeclStmnt->varDecls.front().get();
+    if (!varDecl->initializer || !varDecl->arrayDims.empty())
+        return false;
+
+    if (auto baseTypeDen = varDecl->GetTypeDenoter()->GetAliased().As<BaseTypeDenoter>())
+    {
+        if (baseTypeDen->dataType != DataType::Int && baseTypeDen->dataType != DataType::UInt)
+            return false;
+        iterations.dataType = baseTypeDen->dataType;
+    }
+    else
+        return false;
+
+    iterations.inductionVar = varDecl;
+
+    /* Evaluate expressions with the current value of the induction variable and constant propagation */
+    Variant value;
+
+    auto EvaluateExpr = [varDecl, &value](Expr& expr) -> Variant
+    {
+        ExprEvaluator exprEvaluator;
+        return exprEvaluator.EvaluateOrDefault(
+            expr, {},
+            [varDecl, &value](ObjectExpr* objectExpr) -> Variant
+            {
+                if (!objectExpr->prefixExpr && objectExpr->symbolRef == varDecl)
+                    return value;
+                else
+                    return FetchConstVarValue(objectExpr);
+            }
+        );
+    };
+
+    value = EvaluateExpr(*varDecl->initializer);
+
+    const auto minValue = static_cast<Variant::IntType>(iterations.dataType == DataType::UInt ? 0 : INT32_MIN);
+    const auto maxValue = static_cast<Variant::IntType>(iterations.dataType == DataType::UInt ? UINT32_MAX : INT32_MAX);
+
+    while (true)
+    {
+        if (!value.IsInt() || value.Int() < minValue || value.Int() > maxValue)
+            return false;
+
+        /* Evaluate loop condition */
+        auto condValue = EvaluateExpr(*ast->condition);
+        if (!condValue.IsValid())
+            return false;
+        if (!condValue.ToBool())
+            break;
+
+        if (iterations.values.size() == maxNumIterations)
+            return false;
+
+        iterations.values.push_back(value);
+
+        /* Evaluate loop iteration (e.g. "++i", "i += 2", or "i = i * 2") */
+        auto iterExpr = ast->iteration.get();
+
+        if (auto unaryExpr = iterExpr->As<UnaryExpr>())
+        {
+            if (FetchIterationVarDecl(unaryExpr->expr.get()) != varDecl)
+                return false;
+            if (unaryExpr->op == UnaryOp::Inc)
+                value = Variant(value.Int() + 1);
+            else if (unaryExpr->op == UnaryOp::Dec)
+                value = Variant(value.Int() - 1);
+            else
+                return false;
+        }
+        else if (auto postUnaryExpr = iterExpr->As<PostUnaryExpr>())
+        {
+            if (FetchIterationVarDecl(postUnaryExpr->expr.get()) != varDecl)
+                return false;
+            if (postUnaryExpr->op == UnaryOp::Inc)
+                value = Variant(value.Int() + 1);
+            else if (postUnaryExpr->op == UnaryOp::Dec)
+                value = Variant(value.Int() - 1);
+            else
+                return false;
+        }
+        else if (auto assignExpr = iterExpr->As<AssignExpr>())
+        {
+            if (FetchIterationVarDecl(assignExpr->lvalueExpr.get()) != varDecl)
+                return false;
+
+            auto rhsValue = EvaluateExpr(*assignExpr->rvalueExpr);
+            if (!rhsValue.IsInt())
+                return false;
+
+            switch (assignExpr->op)
+            {
+                case AssignOp::Set:
+                    value = rhsValue;
+                    break;
+                case AssignOp::Add:
+                    value = Variant(value.Int() + rhsValue.Int());
+                    break;
+                case AssignOp::Sub:
+                    value = Variant(value.Int() - rhsValue.Int());
+                    break;
+                case AssignOp::Mul:
+                    value = Variant(value.Int() * rhsValue.Int());
+                    break;
+                default:
+                    return false;
+            }
+        }
+        else
+            return false;
+    }
+
+    return true;
+}
+
+std::size_t LoopUnroller::AnalyzeLoopBody(Stmnt* bodyStmnt, VarDecl* inductionVar)
+{
+    isAnalyzingBody_        = true;
+    inductionVar_           = inductionVar;
+    isInductionVarWritten_  = false;
+    hasLoopJumps_           = false;
+    numBodyStmnts_          = 0;
+    loopDepth_              = 0;
+    switchDepth_            = 0;
+
+    Visit(bodyStmnt);
+
+    isAnalyzingBody_        = false;
+    inductionVar_           = nullptr;
+
+    if (isInductionVarWritten_ || hasLoopJumps_)
+        return 0;
+
+    return std::max(numBodyStmnts_, std::size_t(1));
+}
+
+void LoopUnroller::VisitLValueExpr(const Expr* expr)
+{
+    if (inductionVar_ && expr)
+    {
+        if (auto lvalueExpr = expr->FetchLValueExpr())
+        {
+            if (lvalueExpr->symbolRef == inductionVar_)
+                isInductionVarWritten_ = true;
+        }
+    }
+}
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void LoopUnroller::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+IMPLEMENT_VISIT_PROC(CodeBlock)
+{
+    if (isAnalyzingBody_)
+        VISIT_DEFAULT(CodeBlock);
+    else
+        UnrollStmntList(ast->stmnts);
+}
+
+IMPLEMENT_VISIT_PROC(SwitchCase)
+{
+    if (isAnalyzingBody_)
+        VISIT_DEFAULT(SwitchCase);
+    else
+        UnrollStmntList(ast->stmnts);
+}
+
+/* --- Statements --- */
+
+IMPLEMENT_VISIT_PROC(VarDeclStmnt)
+{
+    numBodyStmnts_++;
+    VISIT_DEFAULT(VarDeclStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(ForLoopStmnt)
+{
+    numBodyStmnts_++;
+    loopDepth_++;
+    {
+        VISIT_DEFAULT(ForLoopStmnt);
+    }
+    loopDepth_--;
+}
+
+IMPLEMENT_VISIT_PROC(WhileLoopStmnt)
+{
+    numBodyStmnts_++;
+    loopDepth_++;
+    {
+        VISIT_DEFAULT(WhileLoopStmnt);
+    }
+    loopDepth_--;
+}
+
+IMPLEMENT_VISIT_PROC(DoWhileLoopStmnt)
+{
+    numBodyStmnts_++;
+    loopDepth_++;
+    {
+        VISIT_DEFAULT(DoWhileLoopStmnt);
+    }
+    loopDepth_--;
+}
+
+IMPLEMENT_VISIT_PROC(IfStmnt)
+{
+    numBodyStmnts_++;
+    VISIT_DEFAULT(IfStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(SwitchStmnt)
+{
+    numBodyStmnts_++;
+    switchDepth_++;
+    {
+        VISIT_DEFAULT(SwitchStmnt);
+    }
+    switchDepth_--;
+}
+
+IMPLEMENT_VISIT_PROC(ExprStmnt)
+{
+    numBodyStmnts_++;
+    VISIT_DEFAULT(ExprStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(ReturnStmnt)
+{
+    numBodyStmnts_++;
+    VISIT_DEFAULT(ReturnStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(CtrlTransferStmnt)
+{
+    numBodyStmnts_++;
+
+    /* Only jump statements which refer to the analyzed loop prevent unrolling (i.e. not inside of nested loops or switch statements) */
+    if (loopDepth_ == 0)
+    {
+        if (ast->transfer == CtrlTransfer::Continue || (ast->transfer == CtrlTransfer::Break && switchDepth_ == 0))
+            hasLoopJumps_ = true;
+    }
+}
+
+/* --- Expressions --- */
+
+IMPLEMENT_VISIT_PROC(UnaryExpr)
+{
+    if (IsLValueOp(ast->op))
+        VisitLValueExpr(ast->expr.get());
+    VISIT_DEFAULT(UnaryExpr);
+}
+
+IMPLEMENT_VISIT_PROC(PostUnaryExpr)
+{
+    VisitLValueExpr(ast->expr.get());
+    VISIT_DEFAULT(PostUnaryExpr);
+}
+
+IMPLEMENT_VISIT_PROC(CallExpr)
+{
+    if (inductionVar_)
+    {
+        ast->ForEachOutputArgument(
+            [this](ExprPtr& argExpr, VarDecl* /*param*/)
+            {
+                VisitLValueExpr(argExpr.get());
+            }
+        );
+    }
+    VISIT_DEFAULT(CallExpr);
+}
+
+IMPLEMENT_VISIT_PROC(AssignExpr)
+{
+    VisitLValueExpr(ast->lvalueExpr.get());
+    VISIT_DEFAULT(AssignExpr);
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
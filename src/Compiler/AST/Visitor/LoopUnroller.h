@@ -0,0 +1,105 @@
+/*
+ * LoopUnroller.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_LOOP_UNROLLER_H
+#define XSC_LOOP_UNROLLER_H
+
+
+#include "Visitor.h"
+#include "ASTEnums.h"
+#include "Variant.h"
+#include <vector>
+
+
+namespace Xsc
+{
+
+
+/*
+Loop unroller AST visitor.
+This helper class for the optimizer unrolls all 'for'-loops with the [unroll] or [unroll(N)] attribute that have a constant iteration count,
+e.g. "[unroll] for (int i = 0; i < 4; ++i) { ... }". Loops with the [loop] attribute or without any attribute are never unrolled.
+A loop is only unrolled if its induction variable is not modified inside the loop body, if the body contains no 'break' or 'continue' statements,
+and if the unrolled code does not exceed the size limit.
+*/
+class LoopUnroller : private Visitor
+{
+
+    public:
+
+        // Unrolls all loops with the [unroll] attribute in the specified program.
+        void UnrollLoops(Program& program);
+
+    private:
+
+        // Induction variable and its values for each iteration of a loop with constant iteration count.
+        struct LoopIterations
+        {
+            VarDecl*                inductionVar    = nullptr;
+            DataType                dataType        = DataType::Undefined;
+            std::vector<Variant>    values;
+        };
+
+        void UnrollStmntList(std::vector<StmntPtr>& stmnts);
+
+        // Unrolls the specified loop into the output statement list, and returns false if the loop can not be unrolled.
+        bool UnrollForLoop(ForLoopStmnt* ast, std::vector<StmntPtr>& unrolledStmnts);
+
+        // Returns the maximal number of iterations from the loop attributes, or 0 if the loop must not be unrolled.
+        std::size_t FetchMaxNumIterations(const ForLoopStmnt* ast) const;
+
+        // Evaluates the constant iterations of the specified loop, and returns false if the iteration count is not constant or exceeds the limit.
+        bool EvaluateLoopIterations(ForLoopStmnt* ast, std::size_t maxNumIterations, LoopIterations& iterations);
+
+        // Analyzes the loop body and returns the number of statements, or 0 if the body can not be unrolled.
+        std::size_t AnalyzeLoopBody(Stmnt* bodyStmnt, VarDecl* inductionVar);
+
+        // Marks the induction variable as modified, if the specified l-value expression refers to it.
+        void VisitLValueExpr(const Expr* expr);
+
+        /* ----- Visitor implementation ----- */
+
+        DECL_VISIT_PROC( CodeBlock         );
+        DECL_VISIT_PROC( SwitchCase        );
+
+        DECL_VISIT_PROC( VarDeclStmnt      );
+        DECL_VISIT_PROC( ForLoopStmnt      );
+        DECL_VISIT_PROC( WhileLoopStmnt    );
+        DECL_VISIT_PROC( DoWhileLoopStmnt  );
+        DECL_VISIT_PROC( IfStmnt           );
+        DECL_VISIT_PROC( SwitchStmnt       );
+        DECL_VISIT_PROC( ExprStmnt         );
+        DECL_VISIT_PROC( ReturnStmnt       );
+        DECL_VISIT_PROC( CtrlTransferStmnt );
+
+        DECL_VISIT_PROC( UnaryExpr         );
+        DECL_VISIT_PROC( PostUnaryExpr     );
+        DECL_VISIT_PROC( CallExpr          );
+        DECL_VISIT_PROC( AssignExpr        );
+
+        /* === Members === */
+
+        bool            isAnalyzingBody_        = false;    // Specifies whether a loop body is analyzed (instead of being unrolled).
+
+        VarDecl*        inductionVar_           = nullptr;
+        bool            isInductionVarWritten_  = false;
+        bool            hasLoopJumps_           = false;    // Specifies whether the loop body has a 'break' or 'continue' statement for the analyzed loop.
+        std::size_t     numBodyStmnts_          = 0;
+        std::size_t     loopDepth_              = 0;        // Depth of nested loops inside the analyzed loop body.
+        std::size_t     switchDepth_            = 0;        // Depth of nested switch statements inside the analyzed loop body.
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -9,6 +9,9 @@
 #include "ExprEvaluator.h"
 #include "ASTFactory.h"
 #include "AST.h"
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
 
 
 namespace Xsc
@@ -25,11 +28,116 @@ void Optimizer::Optimize(Program& program)
  * ======= Private: =======
  */
 
+// Returns the variable the specified object expression refers to, if it is a constant with an initializer (e.g. "static const float PI = 3.14;").
+// Uniforms (also constant buffer members and non-static global constants) and specialization constants are excluded, since their value can still be changed by the application.
+static VarDecl* FetchConstVarDecl(const ObjectExpr* objectExpr)
+{
+    if (!objectExpr->prefixExpr)
+    {
+        if (auto varDecl = objectExpr->FetchVarDecl())
+        {
+            if (varDecl->IsCompileTimeConst())
+                return varDecl;
+        }
+    }
+    return nullptr;
+}
+
+// Returns the initializer value of a constant variable (only constants are propagated, uniforms with default values are not).
+static Variant FetchConstVarValue(ObjectExpr* objectExpr)
+{
+    if (auto varDecl = FetchConstVarDecl(objectExpr))
+        return varDecl->initializerValue;
+    else
+        return {};
+}
+
+// Evaluates the specified expression with constant propagation, or returns an invalid variant on failure.
+static Variant EvaluateConstExpr(Expr& expr)
+{
+    ExprEvaluator exprEvaluator;
+    return exprEvaluator.EvaluateOrDefault(expr, {}, FetchConstVarValue);
+}
+
+// Returns the type constructor call if the specified expression is a vector or matrix constructor with only literal arguments.
+static const CallExpr* GetConstCtorCallExpr(const Expr* expr)
+{
+    if (auto callExpr = expr->As<CallExpr>())
+    {
+        if (callExpr->ident.empty() && callExpr->typeDenoter && !callExpr->arguments.empty())
+        {
+            if (callExpr->typeDenoter->GetAliased().As<BaseTypeDenoter>())
+            {
+                for (const auto& arg : callExpr->arguments)
+                {
+                    if (!arg->As<LiteralExpr>())
+                        return nullptr;
+                }
+                return callExpr;
+            }
+        }
+    }
+    return nullptr;
+}
+
+// Returns true if the specified expression is a literal or a constant vector or matrix constructor.
+static bool IsConstExpr(const Expr* expr)
+{
+    return (expr != nullptr && (expr->As<LiteralExpr>() != nullptr || GetConstCtorCallExpr(expr) != nullptr));
+}
+
+// Returns the number of leaf expressions (i.e. literals and objects) of the specified expression, to compare its size before and after folding.
+static std::size_t NumLeafExprs(const Expr* expr)
+{
+    if (auto binaryExpr = expr->As<BinaryExpr>())
+        return NumLeafExprs(binaryExpr->lhsExpr.get()) + NumLeafExprs(binaryExpr->rhsExpr.get());
+    if (auto unaryExpr = expr->As<UnaryExpr>())
+        return NumLeafExprs(unaryExpr->expr.get());
+    if (auto castExpr = expr->As<CastExpr>())
+        return NumLeafExprs(castExpr->expr.get());
+    if (auto bracketExpr = expr->As<BracketExpr>())
+        return NumLeafExprs(bracketExpr->expr.get());
+    if (auto callExpr = expr->As<CallExpr>())
+    {
+        std::size_t n = 0;
+        for (const auto& arg : callExpr->arguments)
+            n += NumLeafExprs(arg.get());
+        return n;
+    }
+    return 1;
+}
+
+// Returns the number of scalar components of the specified vector or matrix type.
+static std::size_t NumComponents(const DataType dataType)
+{
+    if (IsMatrixType(dataType))
+    {
+        auto matrixDim = MatrixTypeDim(dataType);
+        return static_cast<std::size_t>(matrixDim.first * matrixDim.second);
+    }
+    return static_cast<std::size_t>(VectorTypeDim(dataType));
+}
+
+// Converts the specified value into the variant type that corresponds to the specified scalar data type.
+static Variant ConvertToBaseType(const Variant& value, const DataType dataType)
+{
+    if (IsBooleanType(dataType))
+        return value.ToBool();
+    if (IsIntegralType(dataType))
+        return value.ToInt();
+    if (IsRealType(dataType))
+        return value.ToReal();
+    return value;
+}
+
+/* ----- Statements ----- */
+
 void Optimizer::OptimizeStmntList(std::vector<StmntPtr>& stmnts)
 {
-    /* Remove null statements */
     for (auto it = stmnts.begin(); it != stmnts.end();)
     {
+        /* Optimize statement and remove null statements */
+        OptimizeStmnt(*it);
         if (CanRemoveStmnt(**it))
             it = stmnts.erase(it);
         else
@@ -37,19 +145,55 @@ void Optimizer::OptimizeStmntList(std::vector<StmntPtr>& stmnts)
     }
 }
 
-void Optimizer::OptimizeExpr(ExprPtr& expr)
+// Returns true if the specified expression is a literal and stores its boolean value in the output parameter.
+static bool EvaluateConstCondition(Expr* expr, bool& condition)
 {
-    if (expr)
+    if (expr != nullptr && expr->As<LiteralExpr>())
+    {
+        if (auto value = EvaluateConstExpr(*expr))
+        {
+            condition = value.ToBool();
+            return true;
+        }
+    }
+    return false;
+}
+
+void Optimizer::OptimizeStmnt(StmntPtr& stmnt)
+{
+    if (!stmnt)
+        return;
+
+    Visit(stmnt);
+
+    bool condition = false;
+
+    if (auto ifStmnt = stmnt->As<IfStmnt>())
     {
-        /* Try to evaluate expression */
-        ExprEvaluator exprEvaluator;
-        if (auto value = exprEvaluator.EvaluateOrDefault(*expr))
+        /* Replace if-statement by its active branch */
+        if (EvaluateConstCondition(ifStmnt->condition.get(), condition))
         {
-            /* Convert to literal expression */
-            if (auto literalExpr = ASTFactory::MakeLiteralExprOrNull(value))
-                expr = literalExpr;
+            StmntPtr activeStmnt;
+
+            if (condition)
+                activeStmnt = ifStmnt->bodyStmnt;
+            else if (ifStmnt->elseStmnt)
+                activeStmnt = ifStmnt->elseStmnt->bodyStmnt;
+
+            if (!activeStmnt)
+                stmnt = ASTFactory::MakeNullStmnt();
+            else if (activeStmnt->Type() == AST::Types::VarDeclStmnt)
+                stmnt = ASTFactory::MakeCodeBlockStmnt(activeStmnt);
+            else
+                stmnt = activeStmnt;
         }
     }
+    else if (auto whileLoopStmnt = stmnt->As<WhileLoopStmnt>())
+    {
+        /* Remove while-loop that is never executed */
+        if (EvaluateConstCondition(whileLoopStmnt->condition.get(), condition) && !condition)
+            stmnt = ASTFactory::MakeNullStmnt();
+    }
 }
 
 bool Optimizer::CanRemoveStmnt(const Stmnt& ast) const
@@ -70,6 +214,342 @@ bool Optimizer::CanRemoveStmnt(const Stmnt& ast) const
     return false;
 }
 
+/* ----- Expressions ----- */
+
+void Optimizer::OptimizeExpr(ExprPtr& expr)
+{
+    if (expr)
+    {
+        /* Optimize sub expressions first, then try to fold this expression */
+        Visit(expr);
+        FoldExpr(expr);
+    }
+}
+
+void Optimizer::FoldExpr(ExprPtr& expr)
+{
+    if (auto ternaryExpr = expr->As<TernaryExpr>())
+        FoldExprTernary(expr, ternaryExpr);
+    else if (IsFoldCandidate(*expr))
+    {
+        /* Fold expression depending on the dimension of its type */
+        const auto& typeDen = expr->GetTypeDenoter()->GetAliased();
+        if (auto baseTypeDen = typeDen.As<BaseTypeDenoter>())
+        {
+            const auto dataType = baseTypeDen->dataType;
+            if (IsScalarType(dataType))
+                FoldExprScalar(expr, dataType);
+            else if (IsVectorType(dataType) || IsMatrixType(dataType))
+                FoldExprVector(expr, dataType);
+        }
+    }
+    else if (auto binaryExpr = expr->As<BinaryExpr>())
+    {
+        if (IsLogicalOp(binaryExpr->op))
+            FoldExprLogical(expr, binaryExpr);
+    }
+}
+
+void Optimizer::FoldExprScalar(ExprPtr& expr, const DataType dataType)
+{
+    /* Try to evaluate expression */
+    if (auto value = EvaluateConstExpr(*expr))
+    {
+        /* Convert to literal expression */
+        if (auto literalExpr = MakeLiteralExpr(value, dataType))
+            expr = literalExpr;
+    }
+}
+
+void Optimizer::FoldExprVector(ExprPtr& expr, const DataType dataType)
+{
+    const auto numComponents = NumComponents(dataType);
+
+    std::vector<Variant> values;
+
+    if (auto binaryExpr = expr->As<BinaryExpr>())
+    {
+        /* Evaluate binary operation for each component */
+        auto lhsValues = FetchConstComponents(binaryExpr->lhsExpr.get(), numComponents);
+        auto rhsValues = FetchConstComponents(binaryExpr->rhsExpr.get(), numComponents);
+
+        if (lhsValues.empty() || rhsValues.empty())
+            return;
+
+        for (std::size_t i = 0; i < numComponents; ++i)
+        {
+            auto lhsExpr = ASTFactory::MakeLiteralExprOrNull(lhsValues[i]);
+            auto rhsExpr = ASTFactory::MakeLiteralExprOrNull(rhsValues[i]);
+            auto componentExpr = ASTFactory::MakeBinaryExpr(lhsExpr, binaryExpr->op, rhsExpr);
+            values.push_back(EvaluateConstExpr(*componentExpr));
+        }
+    }
+    else if (auto unaryExpr = expr->As<UnaryExpr>())
+    {
+        /* Evaluate unary operation for each component */
+        auto subValues = FetchConstComponents(unaryExpr->expr.get(), numComponents);
+
+        if (subValues.empty())
+            return;
+
+        for (const auto& subValue : subValues)
+        {
+            auto componentExpr = ASTFactory::MakeUnaryExpr(unaryExpr->op, ASTFactory::MakeLiteralExprOrNull(subValue));
+            values.push_back(EvaluateConstExpr(*componentExpr));
+        }
+    }
+    else if (auto castExpr = expr->As<CastExpr>())
+        values = FetchConstComponents(castExpr->expr.get(), numComponents);
+    else if (auto bracketExpr = expr->As<BracketExpr>())
+        values = FetchConstComponents(bracketExpr->expr.get(), numComponents);
+    else
+        values = FetchConstComponents(expr.get(), numComponents);
+
+    if (values.size() != numComponents)
+        return;
+
+    /* Use a single argument for vectors with equal components (e.g. "float3(0, 0, 0)" -> "float3(0)") */
+    if (IsVectorType(dataType))
+    {
+        auto isSplat = std::all_of(
+            values.begin(), values.end(),
+            [&values](const Variant& value)
+            {
+                return (value.Type() == values.front().Type() && value.CompareWith(values.front()) == 0);
+            }
+        );
+        if (isSplat)
+            values.resize(1);
+    }
+
+    /* Don't fold if the type constructor is larger than the expression (e.g. "(float4x4)0" would have 16 arguments) */
+    if (values.size() > NumLeafExprs(expr.get()))
+        return;
+
+    /* Make literal arguments for the type constructor */
+    const auto baseDataType = BaseDataType(dataType);
+
+    std::vector<ExprPtr> arguments;
+    arguments.reserve(values.size());
+
+    for (const auto& value : values)
+    {
+        if (auto literalExpr = (value ? MakeLiteralExpr(ConvertToBaseType(value, baseDataType), baseDataType) : nullptr))
+            arguments.push_back(literalExpr);
+        else
+            return;
+    }
+
+    /* Replace expression by type constructor */
+    expr = ASTFactory::MakeTypeCtorCallExpr(std::make_shared<BaseTypeDenoter>(dataType), arguments);
+}
+
+void Optimizer::FoldExprTernary(ExprPtr& expr, TernaryExpr* ternaryExpr)
+{
+    bool condition = false;
+    if (EvaluateConstCondition(ternaryExpr->condExpr.get(), condition))
+    {
+        auto activeExpr = (condition ? ternaryExpr->thenExpr : ternaryExpr->elseExpr);
+
+        /* Only replace ternary expression if no implicit type conversion is involved */
+        if (!activeExpr->GetTypeDenoter()->Equals(*ternaryExpr->GetTypeDenoter()))
+            return;
+
+        switch (activeExpr->Type())
+        {
+            case AST::Types::LiteralExpr:
+            case AST::Types::ObjectExpr:
+            case AST::Types::CallExpr:
+            case AST::Types::BracketExpr:
+                expr = activeExpr;
+                break;
+            default:
+                expr = ASTFactory::MakeBracketExpr(activeExpr);
+                break;
+        }
+    }
+}
+
+// Returns true if the specified expression can be removed without changing the semantics (i.e. it has no side effects).
+static bool IsSideEffectFreeExpr(const Expr* expr)
+{
+    if (auto objectExpr = expr->As<ObjectExpr>())
+        return (!objectExpr->prefixExpr || IsSideEffectFreeExpr(objectExpr->prefixExpr.get()));
+    if (auto bracketExpr = expr->As<BracketExpr>())
+        return IsSideEffectFreeExpr(bracketExpr->expr.get());
+    return (expr->As<LiteralExpr>() != nullptr);
+}
+
+void Optimizer::FoldExprLogical(ExprPtr& expr, BinaryExpr* binaryExpr)
+{
+    /* Only fold scalar expressions, since logical operators on vectors are component-wise in HLSL */
+    const auto& typeDen = *binaryExpr->GetTypeDenoter();
+    if (!typeDen.GetAliased().IsScalar())
+        return;
+
+    const bool isLogicalAnd = (binaryExpr->op == BinaryOp::LogicalAnd);
+    bool condition = false;
+    ExprPtr activeExpr;
+
+    if (EvaluateConstCondition(binaryExpr->lhsExpr.get(), condition))
+    {
+        /* Replace "true && x" and "false || x" by "x", and "false && x" and "true || x" by the literal */
+        activeExpr = (condition == isLogicalAnd ? binaryExpr->rhsExpr : binaryExpr->lhsExpr);
+    }
+    else if (EvaluateConstCondition(binaryExpr->rhsExpr.get(), condition))
+    {
+        /* Replace "x && true" and "x || false" by "x", and "x && false" and "x || true" by the literal if "x" has no side effects */
+        if (condition == isLogicalAnd)
+            activeExpr = binaryExpr->lhsExpr;
+        else if (IsSideEffectFreeExpr(binaryExpr->lhsExpr.get()))
+            activeExpr = binaryExpr->rhsExpr;
+    }
+
+    /* Only replace logical expression if no implicit type conversion is involved */
+    if (activeExpr && activeExpr->GetTypeDenoter()->Equals(typeDen))
+        expr = activeExpr;
+}
+
+bool Optimizer::IsFoldCandidate(const Expr& expr) const
+{
+    switch (expr.Type())
+    {
+        case AST::Types::BinaryExpr:
+        {
+            auto& binaryExpr = static_cast<const BinaryExpr&>(expr);
+            return (IsConstExpr(binaryExpr.lhsExpr.get()) && IsConstExpr(binaryExpr.rhsExpr.get()));
+        }
+
+        case AST::Types::UnaryExpr:
+        {
+            auto& unaryExpr = static_cast<const UnaryExpr&>(expr);
+            return (!IsLValueOp(unaryExpr.op) && IsConstExpr(unaryExpr.expr.get()));
+        }
+
+        case AST::Types::CastExpr:
+        {
+            auto& castExpr = static_cast<const CastExpr&>(expr);
+            return IsConstExpr(castExpr.expr.get());
+        }
+
+        case AST::Types::BracketExpr:
+        {
+            /* Keep brackets around negative literals (e.g. "x - (-1)") */
+            auto& bracketExpr = static_cast<const BracketExpr&>(expr);
+            if (auto literalExpr = bracketExpr.expr->As<LiteralExpr>())
+                return (literalExpr->value.empty() || literalExpr->value.front() != '-');
+            return IsConstExpr(bracketExpr.expr.get());
+        }
+
+        case AST::Types::ObjectExpr:
+        {
+            auto& objectExpr = static_cast<const ObjectExpr&>(expr);
+            if (auto varDecl = FetchConstVarDecl(&objectExpr))
+                return (varDecl->initializerValue.IsValid() || GetConstCtorCallExpr(varDecl->initializer.get()) != nullptr);
+            return false;
+        }
+
+        case AST::Types::ArrayExpr:
+        {
+            auto& arrayExpr = static_cast<const ArrayExpr&>(expr);
+            if (auto prefixExpr = arrayExpr.prefixExpr->As<ObjectExpr>())
+            {
+                if (!FetchConstVarDecl(prefixExpr))
+                    return false;
+                for (const auto& arrayIndex : arrayExpr.arrayIndices)
+                {
+                    if (!arrayIndex->As<LiteralExpr>())
+                        return false;
+                }
+                return true;
+            }
+            return false;
+        }
+
+        default:
+            return false;
+    }
+}
+
+std::vector<Variant> Optimizer::FetchConstComponents(const Expr* expr, std::size_t numComponents) const
+{
+    if (expr == nullptr)
+        return {};
+
+    if (auto literalExpr = expr->As<LiteralExpr>())
+    {
+        /* Splat scalar value to all components */
+        if (auto value = EvaluateConstExpr(*const_cast<LiteralExpr*>(literalExpr)))
+            return std::vector<Variant>(numComponents, value);
+    }
+    else if (auto callExpr = GetConstCtorCallExpr(expr))
+    {
+        const auto ctorDataType = callExpr->typeDenoter->GetAliased().As<BaseTypeDenoter>()->dataType;
+        const auto baseDataType = BaseDataType(ctorDataType);
+        const auto numArgs      = callExpr->arguments.size();
+
+        /* Only accept constructors with the same number of components, or a single scalar argument for vectors */
+        if ((IsVectorType(ctorDataType) || IsMatrixType(ctorDataType)) && NumComponents(ctorDataType) == numComponents)
+        {
+            if (numArgs == numComponents || (numArgs == 1 && IsVectorType(ctorDataType)))
+            {
+                std::vector<Variant> values;
+                values.reserve(numComponents);
+
+                for (std::size_t i = 0; i < numComponents; ++i)
+                {
+                    auto& arg = callExpr->arguments[numArgs == 1 ? 0 : i];
+                    if (auto value = EvaluateConstExpr(*arg))
+                        values.push_back(ConvertToBaseType(value, baseDataType));
+                    else
+                        return {};
+                }
+
+                return values;
+            }
+        }
+    }
+    else if (auto bracketExpr = expr->As<BracketExpr>())
+        return FetchConstComponents(bracketExpr->expr.get(), numComponents);
+    else if (auto objectExpr = expr->As<ObjectExpr>())
+    {
+        /* Propagate constant vector from variable initializer */
+        if (auto varDecl = FetchConstVarDecl(objectExpr))
+        {
+            if (GetConstCtorCallExpr(varDecl->initializer.get()))
+                return FetchConstComponents(varDecl->initializer.get(), numComponents);
+        }
+    }
+
+    return {};
+}
+
+LiteralExprPtr Optimizer::MakeLiteralExpr(const Variant& value, const DataType dataType) const
+{
+    /* Don't fold values that are not representable in the target type (e.g. integer overflow, or negative unsigned integers) */
+    if (value.Type() == Variant::Types::Int && IsIntegralType(dataType))
+    {
+        const auto intValue = value.Int();
+        if (IsUIntType(dataType))
+        {
+            if (intValue < 0 || intValue > static_cast<Variant::IntType>(UINT32_MAX))
+                return nullptr;
+        }
+        else if (intValue < static_cast<Variant::IntType>(INT32_MIN) || intValue > static_cast<Variant::IntType>(INT32_MAX))
+            return nullptr;
+    }
+    else if (value.Type() == Variant::Types::Real && !std::isfinite(value.Real()))
+        return nullptr;
+
+    if (auto literalExpr = ASTFactory::MakeLiteralExprOrNull(value))
+    {
+        literalExpr->ConvertDataType(dataType);
+        return literalExpr;
+    }
+
+    return nullptr;
+}
+
 /* ------- Visit functions ------- */
 
 #define IMPLEMENT_VISIT_PROC(AST_NAME) \
@@ -78,13 +558,12 @@ bool Optimizer::CanRemoveStmnt(const Stmnt& ast) const
 IMPLEMENT_VISIT_PROC(CodeBlock)
 {
     OptimizeStmntList(ast->stmnts);
-    VISIT_DEFAULT(CodeBlock);
 }
 
 IMPLEMENT_VISIT_PROC(SwitchCase)
 {
+    OptimizeExpr(ast->expr);
     OptimizeStmntList(ast->stmnts);
-    VISIT_DEFAULT(SwitchCase);
 }
 
 IMPLEMENT_VISIT_PROC(ArrayDimension)
@@ -102,31 +581,31 @@ IMPLEMENT_VISIT_PROC(ForLoopStmnt)
     Visit(ast->initStmnt);
     OptimizeExpr(ast->condition);
     OptimizeExpr(ast->iteration);
-    Visit(ast->bodyStmnt);
+    OptimizeStmnt(ast->bodyStmnt);
 }
 
 IMPLEMENT_VISIT_PROC(WhileLoopStmnt)
 {
     OptimizeExpr(ast->condition);
-    Visit(ast->bodyStmnt);
+    OptimizeStmnt(ast->bodyStmnt);
 }
 
 IMPLEMENT_VISIT_PROC(DoWhileLoopStmnt)
 {
+    OptimizeStmnt(ast->bodyStmnt);
     OptimizeExpr(ast->condition);
-    Visit(ast->bodyStmnt);
 }
 
 IMPLEMENT_VISIT_PROC(IfStmnt)
 {
     OptimizeExpr(ast->condition);
-    Visit(ast->bodyStmnt);
+    OptimizeStmnt(ast->bodyStmnt);
     Visit(ast->elseStmnt);
 }
 
 IMPLEMENT_VISIT_PROC(ElseStmnt)
 {
-    Visit(ast->bodyStmnt);
+    OptimizeStmnt(ast->bodyStmnt);
 }
 
 IMPLEMENT_VISIT_PROC(SwitchStmnt)
@@ -147,14 +626,12 @@ IMPLEMENT_VISIT_PROC(ReturnStmnt)
 
 IMPLEMENT_VISIT_PROC(SequenceExpr)
 {
-    VISIT_DEFAULT(SequenceExpr);
     for (auto& subExpr : ast->exprs)
         OptimizeExpr(subExpr);
 }
 
 IMPLEMENT_VISIT_PROC(TernaryExpr)
 {
-    VISIT_DEFAULT(TernaryExpr);
     OptimizeExpr(ast->condExpr);
     OptimizeExpr(ast->thenExpr);
     OptimizeExpr(ast->elseExpr);
@@ -162,63 +639,79 @@ IMPLEMENT_VISIT_PROC(TernaryExpr)
 
 IMPLEMENT_VISIT_PROC(BinaryExpr)
 {
-    VISIT_DEFAULT(BinaryExpr);
-    OptimizeExpr(ast->lhsExpr);
-    OptimizeExpr(ast->rhsExpr);
+    /* Collect chain of left-hand-side binary expressions to avoid deep recursion (e.g. for sums of thousands of terms) */
+    std::vector<BinaryExpr*> lhsChain;
+
+    for (auto binaryExpr = ast; binaryExpr != nullptr; binaryExpr = binaryExpr->lhsExpr->As<BinaryExpr>())
+        lhsChain.push_back(binaryExpr);
+
+    OptimizeExpr(lhsChain.back()->lhsExpr);
+
+    /* Optimize from inner most to outer most binary expression, and fold each one after its sub expressions (except this one) */
+    for (auto i = lhsChain.size(); i > 0; --i)
+    {
+        OptimizeExpr(lhsChain[i - 1]->rhsExpr);
+        if (i > 1)
+            FoldExpr(lhsChain[i - 2]->lhsExpr);
+    }
 }
 
 IMPLEMENT_VISIT_PROC(UnaryExpr)
 {
-    VISIT_DEFAULT(UnaryExpr);
-    OptimizeExpr(ast->expr);
+    /* Don't replace l-values of increment and decrement operators */
+    if (IsLValueOp(ast->op))
+        Visit(ast->expr);
+    else
+        OptimizeExpr(ast->expr);
 }
 
 IMPLEMENT_VISIT_PROC(PostUnaryExpr)
 {
-    VISIT_DEFAULT(PostUnaryExpr);
-    OptimizeExpr(ast->expr);
+    Visit(ast->expr);
+}
+
+IMPLEMENT_VISIT_PROC(CallExpr)
+{
+    Visit(ast->prefixExpr);
+    for (auto& arg : ast->arguments)
+        OptimizeExpr(arg);
 }
 
 IMPLEMENT_VISIT_PROC(BracketExpr)
 {
-    VISIT_DEFAULT(BracketExpr);
+    OptimizeExpr(ast->expr);
 
     /* Reduce inner brackets */
     if (auto subBracketExpr = ast->expr->As<BracketExpr>())
         ast->expr = subBracketExpr->expr;
-
-    OptimizeExpr(ast->expr);
 }
 
 IMPLEMENT_VISIT_PROC(ObjectExpr)
 {
-    VISIT_DEFAULT(ObjectExpr);
-    OptimizeExpr(ast->prefixExpr);
+    /* Only visit prefix, since literals can not be used as prefix (e.g. "1.0.x") */
+    Visit(ast->prefixExpr);
 }
 
 IMPLEMENT_VISIT_PROC(AssignExpr)
 {
-    VISIT_DEFAULT(AssignExpr);
-    OptimizeExpr(ast->lvalueExpr);
+    Visit(ast->lvalueExpr);
     OptimizeExpr(ast->rvalueExpr);
 }
 
 IMPLEMENT_VISIT_PROC(ArrayExpr)
 {
-    VISIT_DEFAULT(ArrayExpr);
+    Visit(ast->prefixExpr);
     for (auto& subExpr : ast->arrayIndices)
         OptimizeExpr(subExpr);
 }
 
 IMPLEMENT_VISIT_PROC(CastExpr)
 {
-    VISIT_DEFAULT(CastExpr);
     OptimizeExpr(ast->expr);
 }
 
 IMPLEMENT_VISIT_PROC(InitializerExpr)
 {
-    VISIT_DEFAULT(InitializerExpr);
     for (auto& subExpr : ast->exprs)
         OptimizeExpr(subExpr);
 }
@@ -230,4 +723,4 @@ IMPLEMENT_VISIT_PROC(InitializerExpr)
 
 
 
-// ================================================================================
\ No newline at end of file
+// ================================================================================
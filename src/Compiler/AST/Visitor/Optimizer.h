@@ -10,6 +10,8 @@
 
 
 #include "Visitor.h"
+#include "ASTEnums.h"
+#include "Variant.h"
 #include <vector>
 
 
@@ -19,7 +21,11 @@ namespace Xsc
 
 //TODO: replace this class by "ExprConverter".
 
-// This AST optimizer supports only little optimizations such as null-statement removal.
+/*
+AST optimizer which performs constant folding and propagation, and removes null-statements and branches with constant conditions.
+Scalar expressions are folded with the ExprEvaluator, and vector and matrix expressions are folded component-wise
+if all their components are literals (e.g. "float3(1, 2, 3) * 2" -> "float3(2, 4, 6)").
+*/
 class Optimizer : private Visitor
 {
 
@@ -30,12 +36,37 @@ class Optimizer : private Visitor
 
     private:
 
+        /* ----- Statements ----- */
+
         void OptimizeStmntList(std::vector<StmntPtr>& stmnts);
 
-        void OptimizeExpr(ExprPtr& expr);
+        // Optimizes the specified statement and replaces it by its active branch if its condition is constant.
+        void OptimizeStmnt(StmntPtr& stmnt);
 
         bool CanRemoveStmnt(const Stmnt& ast) const;
 
+        /* ----- Expressions ----- */
+
+        // Optimizes all sub expressions of the specified expression and replaces it by a constant expression if possible.
+        void OptimizeExpr(ExprPtr& expr);
+
+        void FoldExpr(ExprPtr& expr);
+        void FoldExprScalar(ExprPtr& expr, const DataType dataType);
+        void FoldExprVector(ExprPtr& expr, const DataType dataType);
+        void FoldExprTernary(ExprPtr& expr, TernaryExpr* ternaryExpr);
+
+        // Folds logical expressions with one constant operand (e.g. "x && false" -> "false").
+        void FoldExprLogical(ExprPtr& expr, BinaryExpr* binaryExpr);
+
+        // Returns true if all direct sub expressions of the specified expression are constant, i.e. if it is worth to try folding it.
+        bool IsFoldCandidate(const Expr& expr) const;
+
+        // Returns the components of the specified constant vector or matrix expression, or an empty list if the expression is not constant.
+        std::vector<Variant> FetchConstComponents(const Expr* expr, std::size_t numComponents) const;
+
+        // Returns the literal expression for the specified value with the specified data type, or null if the value is not representable.
+        LiteralExprPtr MakeLiteralExpr(const Variant& value, const DataType dataType) const;
+
         /* ----- Visitor implementation ----- */
 
         DECL_VISIT_PROC( CodeBlock         );
@@ -58,6 +89,7 @@ class Optimizer : private Visitor
         DECL_VISIT_PROC( BinaryExpr        );
         DECL_VISIT_PROC( UnaryExpr         );
         DECL_VISIT_PROC( PostUnaryExpr     );
+        DECL_VISIT_PROC( CallExpr          );
         DECL_VISIT_PROC( BracketExpr       );
         DECL_VISIT_PROC( ObjectExpr        );
         DECL_VISIT_PROC( AssignExpr        );
@@ -0,0 +1,110 @@
+/*
+ * ReachabilityAnalyzer.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ReachabilityAnalyzer.h"
+#include "AST.h"
+#include <algorithm>
+
+
+namespace Xsc
+{
+
+
+// Returns the global function declaration of the specified statement, or null if the statement is not a function declaration.
+static FunctionDecl* FetchFunctionDecl(Stmnt* stmnt)
+{
+    if (auto basicDeclStmnt = stmnt->As<BasicDeclStmnt>())
+        return basicDeclStmnt->declObject->As<FunctionDecl>();
+    return nullptr;
+}
+
+std::size_t ReachabilityAnalyzer::RemoveUnreachableFunctions(Program& program, const std::string& entryPoint, const std::string& secondaryEntryPoint)
+{
+    /* Gather all global function declarations, and visit all other global statements as roots of the call graph */
+    for (auto& stmnt : program.globalStmnts)
+    {
+        if (auto funcDecl = FetchFunctionDecl(stmnt.get()))
+            funcDeclStmnts_[funcDecl->ident].push_back(funcDecl->declStmntRef);
+        else
+            Visit(stmnt);
+    }
+
+    /* Mark entry points as reachable */
+    MarkIdentReachable(entryPoint);
+    if (!secondaryEntryPoint.empty())
+        MarkIdentReachable(secondaryEntryPoint);
+
+    /* Visit all reachable functions until no further identifiers are marked as reachable */
+    while (!identQueue_.empty())
+    {
+        auto ident = identQueue_.back();
+        identQueue_.pop_back();
+
+        auto it = funcDeclStmnts_.find(ident);
+        if (it != funcDeclStmnts_.end())
+        {
+            for (auto declStmnt : it->second)
+                Visit(declStmnt);
+        }
+    }
+
+    /* Remove all unreachable global function declarations */
+    auto IsUnreachable = [this](const StmntPtr& stmnt) -> bool
+    {
+        if (auto funcDecl = FetchFunctionDecl(stmnt.get()))
+            return (reachableIdents_.find(funcDecl->ident) == reachableIdents_.end());
+        return false;
+    };
+
+    auto numStmnts = program.globalStmnts.size();
+
+    program.globalStmnts.erase(
+        std::remove_if(program.globalStmnts.begin(), program.globalStmnts.end(), IsUnreachable),
+        program.globalStmnts.end()
+    );
+
+    return (numStmnts - program.globalStmnts.size());
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void ReachabilityAnalyzer::MarkIdentReachable(const std::string& ident)
+{
+    if (reachableIdents_.insert(ident).second)
+        identQueue_.push_back(ident);
+}
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void ReachabilityAnalyzer::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+IMPLEMENT_VISIT_PROC(CallExpr)
+{
+    if (!ast->ident.empty())
+        MarkIdentReachable(ast->ident);
+    VISIT_DEFAULT(CallExpr);
+}
+
+IMPLEMENT_VISIT_PROC(LiteralExpr)
+{
+    /* Function identifiers can also be referenced by string literals in attributes (e.g. "[patchconstantfunc("HSConst")]") */
+    if (ast->dataType == DataType::String)
+        MarkIdentReachable(ast->GetStringValue());
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
@@ -0,0 +1,65 @@
+/*
+ * ReachabilityAnalyzer.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_REACHABILITY_ANALYZER_H
+#define XSC_REACHABILITY_ANALYZER_H
+
+
+#include "Visitor.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+
+
+namespace Xsc
+{
+
+
+/*
+Function reachability analyzer.
+This helper class for the context analyzer builds a cheap, name-based call graph from the parse tree (before any decoration)
+and removes all global functions which can not be reached from the entry points, so they don't need to be analyzed at all.
+The analysis is conservative: every function with the identifier of any call expression within reachable code is considered to be reachable.
+*/
+class ReachabilityAnalyzer : private Visitor
+{
+
+    public:
+
+        // Removes all global function declarations from the program, that are not reachable from the specified entry points, and returns the number of removed functions.
+        std::size_t RemoveUnreachableFunctions(Program& program, const std::string& entryPoint, const std::string& secondaryEntryPoint);
+
+    private:
+
+        // Marks the specified identifier as reachable.
+        void MarkIdentReachable(const std::string& ident);
+
+        /* ----- Visitor implementation ----- */
+
+        DECL_VISIT_PROC( CallExpr    );
+        DECL_VISIT_PROC( LiteralExpr );
+
+        /* === Members === */
+
+        using FuncDeclStmntList = std::vector<BasicDeclStmnt*>;
+
+        std::map<std::string, FuncDeclStmntList>    funcDeclStmnts_;    // Global function declaration statements by identifier.
+        std::set<std::string>                       reachableIdents_;   // Identifiers of all reachable functions.
+        std::vector<std::string>                    identQueue_;        // Queue of reachable identifiers whose functions have not been visited yet.
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -53,6 +53,14 @@ int ReflectionAnalyzer::GetBindingPoint(const std::vector<RegisterPtr>& slotRegi
         return -1;
 }
 
+int ReflectionAnalyzer::GetBindingSet(const std::vector<RegisterPtr>& slotRegisters) const
+{
+    if (auto slotRegister = Register::GetForTarget(slotRegisters, shaderTarget_))
+        return slotRegister->space;
+    else
+        return 0;
+}
+
 int ReflectionAnalyzer::EvaluateConstExprInt(Expr& expr)
 {
     /* Evaluate expression and return as integer */
@@ -67,6 +75,21 @@ float ReflectionAnalyzer::EvaluateConstExprFloat(Expr& expr)
     return static_cast<float>(exprEvaluator.EvaluateOrDefault(expr, Variant::RealType(0.0)).ToReal());
 }
 
+static Reflection::FieldType ToFieldType(const DataType t)
+{
+    using T = Reflection::FieldType;
+    switch (BaseDataType(t))
+    {
+        case DataType::Bool:    return T::Bool;
+        case DataType::Int:     return T::Int;
+        case DataType::UInt:    return T::UInt;
+        case DataType::Half:    return T::Half;
+        case DataType::Float:   return T::Float;
+        case DataType::Double:  return T::Double;
+        default:                return T::Undefined;
+    }
+}
+
 /* ------- Visit functions ------- */
 
 #define IMPLEMENT_VISIT_PROC(AST_NAME) \
@@ -82,13 +105,21 @@ IMPLEMENT_VISIT_PROC(Program)
     {
         /* Reflect input attributes */
         for (auto varDecl : entryPoint->inputSemantics.varDeclRefs)
-            data_->inputAttributes.push_back({ varDecl->ident, varDecl->semantic.Index() });
+        {
+            /* Ignore inputs that are not passed from the previous shader stage */
+            if (!varDecl->flags(VarDecl::isUnlinkedVarying))
+                data_->inputAttributes.push_back({ varDecl->ident, varDecl->semantic.Index() });
+        }
         for (auto varDecl : entryPoint->inputSemantics.varDeclRefsSV)
             data_->inputAttributes.push_back({ varDecl->semantic.ToString(), varDecl->semantic.Index() });
 
         /* Reflect output attributes */
         for (auto varDecl : entryPoint->outputSemantics.varDeclRefs)
-            data_->outputAttributes.push_back({ varDecl->ident, varDecl->semantic.Index() });
+        {
+            /* Ignore outputs that are not passed to the next shader stage */
+            if (!varDecl->flags(VarDecl::isUnlinkedVarying))
+                data_->outputAttributes.push_back({ varDecl->ident, varDecl->semantic.Index() });
+        }
         for (auto varDecl : entryPoint->outputSemantics.varDeclRefsSV)
             data_->outputAttributes.push_back({ varDecl->semantic.ToString(), varDecl->semantic.Index() });
 
@@ -110,6 +141,7 @@ IMPLEMENT_VISIT_PROC(SamplerDecl)
             samplerState.type       = SamplerTypeToResourceType(ast->GetSamplerType());
             samplerState.name       = ast->ident;
             samplerState.slot       = GetBindingPoint(ast->slotRegisters);
+            samplerState.set        = GetBindingSet(ast->slotRegisters);
         }
         data_->samplerStates.push_back(samplerState);
     }
@@ -181,20 +213,50 @@ IMPLEMENT_VISIT_PROC(UniformBufferDecl)
         constantBuffer.type         = UniformBufferTypeToResourceType(ast->bufferType);
         constantBuffer.name         = ast->ident;
         constantBuffer.slot         = GetBindingPoint(ast->slotRegisters);
+        constantBuffer.set          = GetBindingSet(ast->slotRegisters);
+        constantBuffer.pushConstant = ast->flags(UniformBufferDecl::isPushConstant);
 
         /* Reflect constant buffer fields and size */
         constantBuffer.size     = 0;
         constantBuffer.padding  = 0;
 
-        for (const auto& member : ast->varMembers)
+        std::vector<std::size_t> memberFields;
+
+        for (std::size_t i = 0; i < ast->varMembers.size(); ++i)
         {
-            for (const auto& var : member->varDecls)
+            ast->AccumMergedBufferPadding(i, constantBuffer.size, constantBuffer.padding);
+            memberFields.push_back(constantBuffer.fields.size());
+
+            for (const auto& var : ast->varMembers[i]->varDecls)
             {
                 Reflection::Field field;
                 ReflectField(var.get(), field, constantBuffer.size, constantBuffer.padding);
                 constantBuffer.fields.push_back(field);
             }
         }
+
+        memberFields.push_back(constantBuffer.fields.size());
+
+        /* Reflect ranges of merged constant buffers (each range ends where the next range starts) */
+        for (const auto& mergedBuffer : ast->mergedBuffers)
+        {
+            Reflection::ConstantBufferRange range;
+            {
+                range.name          = mergedBuffer.ident;
+                range.slot          = GetBindingPoint(mergedBuffer.slotRegisters);
+                range.firstField    = memberFields[mergedBuffer.firstMember];
+                range.numFields     = memberFields[mergedBuffer.firstMember + mergedBuffer.numMembers] - range.firstField;
+                range.offset        = (range.numFields > 0 ? constantBuffer.fields[range.firstField].offset : 0);
+            }
+            constantBuffer.mergedBuffers.push_back(range);
+        }
+
+        auto& mergedBuffers = constantBuffer.mergedBuffers;
+        for (std::size_t i = 0; i < mergedBuffers.size(); ++i)
+        {
+            const auto end = (i + 1 < mergedBuffers.size() ? mergedBuffers[i + 1].offset : constantBuffer.size + RemainingVectorSize(constantBuffer.size));
+            mergedBuffers[i].size = end - mergedBuffers[i].offset;
+        }
     }
     data_->constantBuffers.push_back(constantBuffer);
 }
@@ -210,6 +272,7 @@ IMPLEMENT_VISIT_PROC(BufferDeclStmnt)
             resource.type       = BufferTypeToResourceType(ast->typeDenoter->bufferType);
             resource.name       = bufferDecl->ident;
             resource.slot       = GetBindingPoint(bufferDecl->slotRegisters);
+            resource.set        = GetBindingSet(bufferDecl->slotRegisters);
         };
         data_->resources.push_back(resource);
     }
@@ -231,6 +294,22 @@ IMPLEMENT_VISIT_PROC(VarDecl)
             data_->uniforms.push_back(attribute);
         }
     }
+
+    if (ast->IsSpecConstant())
+    {
+        /* Add variable as specialization constant */
+        Reflection::SpecConstant specConstant;
+        {
+            specConstant.referenced     = ast->flags(AST::isReachable);
+            specConstant.name           = ast->ident;
+            specConstant.constantID     = ast->specConstantID;
+            specConstant.defaultValue   = ast->initializerValue.ToReal();
+
+            if (auto baseTypeDen = ast->GetTypeDenoter()->GetAliased().As<BaseTypeDenoter>())
+                specConstant.type = ToFieldType(baseTypeDen->dataType);
+        }
+        data_->specConstants.push_back(specConstant);
+    }
 }
 
 #undef IMPLEMENT_VISIT_PROC
@@ -374,21 +453,6 @@ void ReflectionAnalyzer::ReflectAttributesNumThreads(Attribute* ast)
     }
 }
 
-static Reflection::FieldType ToFieldType(const DataType t)
-{
-    using T = Reflection::FieldType;
-    switch (BaseDataType(t))
-    {
-        case DataType::Bool:    return T::Bool;
-        case DataType::Int:     return T::Int;
-        case DataType::UInt:    return T::UInt;
-        case DataType::Half:    return T::Half;
-        case DataType::Float:   return T::Float;
-        case DataType::Double:  return T::Double;
-        default:                return T::Undefined;
-    }
-}
-
 static void ReflectFieldBaseType(const DataType dataType, Reflection::Field& field)
 {
     /* Determine base type */
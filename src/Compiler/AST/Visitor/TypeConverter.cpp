@@ -127,8 +127,19 @@ IMPLEMENT_VISIT_PROC(TernaryExpr)
 
 IMPLEMENT_VISIT_PROC(BinaryExpr)
 {
-    VISIT_DEFAULT(BinaryExpr);
-    ConvertExprType(ast);
+    /* Collect chain of left-hand-side binary expressions to avoid deep recursion (e.g. for sums of thousands of terms) */
+    std::vector<BinaryExpr*> lhsChain;
+
+    for (auto binaryExpr = ast; binaryExpr != nullptr; binaryExpr = binaryExpr->lhsExpr->As<BinaryExpr>())
+        lhsChain.push_back(binaryExpr);
+
+    Visit(lhsChain.back()->lhsExpr);
+
+    for (auto it = lhsChain.rbegin(); it != lhsChain.rend(); ++it)
+    {
+        Visit((*it)->rhsExpr);
+        ConvertExprType(*it);
+    }
 }
 
 IMPLEMENT_VISIT_PROC(UnaryExpr)
@@ -8,6 +8,9 @@
 #include "UniformPacker.h"
 #include "AST.h"
 #include "ASTFactory.h"
+#include <algorithm>
+#include <map>
+#include <set>
 
 
 namespace Xsc
@@ -112,6 +115,106 @@ void UniformPacker::Convert(Program& program, const CbufferAttributes& cbufferAt
     }
 }
 
+void UniformPacker::ReorderMembers(Program& program)
+{
+    for (auto& stmnt : program.globalStmnts)
+    {
+        if (auto basicDeclStmnt = stmnt->As<BasicDeclStmnt>())
+        {
+            if (auto uniformBufferDecl = basicDeclStmnt->declObject->As<UniformBufferDecl>())
+            {
+                if (uniformBufferDecl->flags(UniformBufferDecl::isReorderable))
+                    ReorderUniformBufferMembers(*uniformBufferDecl);
+            }
+        }
+    }
+}
+
+void UniformPacker::MergeBuffers(Program& program, unsigned int sizeThreshold, const std::string& bufferName)
+{
+    if (bufferName.empty())
+        return;
+
+    /* Group all reachable constant buffers by their update frequency (in the order of their first appearance) */
+    std::vector<std::string> groupNames;
+    std::map<std::string, std::vector<UniformBufferDecl*>> groups;
+
+    for (const auto& stmnt : program.globalStmnts)
+    {
+        if (auto basicDeclStmnt = stmnt->As<BasicDeclStmnt>())
+        {
+            if (auto uniformBufferDecl = basicDeclStmnt->declObject->As<UniformBufferDecl>())
+            {
+                if ( uniformBufferDecl->bufferType != UniformBufferType::ConstantBuffer ||
+                     !uniformBufferDecl->flags(AST::isReachable) ||
+                     uniformBufferDecl->flags(UniformBufferDecl::isPushConstant) ||
+                     uniformBufferDecl->varMembers.empty() )
+                {
+                    continue;
+                }
+
+                std::string groupName;
+
+                if (!uniformBufferDecl->updateFrequency.empty())
+                {
+                    /* Merge constant buffers with the same update frequency regardless of their size */
+                    groupName = bufferName + "_" + uniformBufferDecl->updateFrequency;
+                }
+                else
+                {
+                    /* Merge constant buffers whose size does not exceed the threshold */
+                    unsigned int size = 0, padding = 0;
+                    if (sizeThreshold == 0 || !uniformBufferDecl->AccumAlignedVectorSize(size, padding) || size > sizeThreshold)
+                        continue;
+                    groupName = bufferName;
+                }
+
+                auto& group = groups[groupName];
+                if (group.empty())
+                    groupNames.push_back(groupName);
+
+                group.push_back(uniformBufferDecl);
+            }
+        }
+    }
+
+    /* Replace each group of at least two constant buffers by a merged uniform buffer */
+    std::map<UniformBufferDecl*, BasicDeclStmntPtr> mergedDeclStmnts;
+    std::set<UniformBufferDecl*> removedBuffers;
+
+    for (const auto& groupName : groupNames)
+    {
+        const auto& group = groups[groupName];
+        if (group.size() >= 2)
+        {
+            /* Replace first constant buffer of this group and remove all others */
+            mergedDeclStmnts[group.front()] = MakeMergedUniformBuffer(group, groupName);
+            removedBuffers.insert(group.begin() + 1, group.end());
+        }
+    }
+
+    auto& globalStmnts = program.globalStmnts;
+
+    for (auto it = globalStmnts.begin(); it != globalStmnts.end();)
+    {
+        if (auto basicDeclStmnt = (*it)->As<BasicDeclStmnt>())
+        {
+            if (auto uniformBufferDecl = basicDeclStmnt->declObject->As<UniformBufferDecl>())
+            {
+                auto mergedIt = mergedDeclStmnts.find(uniformBufferDecl);
+                if (mergedIt != mergedDeclStmnts.end())
+                    *it = mergedIt->second;
+                else if (removedBuffers.find(uniformBufferDecl) != removedBuffers.end())
+                {
+                    it = globalStmnts.erase(it);
+                    continue;
+                }
+            }
+        }
+        ++it;
+    }
+}
+
 
 /*
  * ======= Private: =======
@@ -124,6 +227,9 @@ void UniformPacker::MakeUniformBuffer()
     {
         uniformBufferDecl_ = ASTFactory::MakeUniformBufferDecl(cbufferAttribs_.name, cbufferAttribs_.bindingSlot);
         uniformBufferDecl_->declStmntRef = declStmnt_.get();
+
+        /* Members of the packed uniform buffer have no user-defined order */
+        uniformBufferDecl_->flags << UniformBufferDecl::isReorderable;
     }
     declStmnt_->declObject = uniformBufferDecl_;
 }
@@ -142,6 +248,189 @@ void UniformPacker::AppendUniform(const VarDeclStmntPtr& varDeclStmnt)
         varDecl->initializer.reset();
 }
 
+// Returns the number of 32-bit components of the specified member, or 0 if it always starts and ends at a 16 byte boundary.
+static int GetMemberComponents(VarDecl* varDecl)
+{
+    const auto& typeDen = varDecl->GetTypeDenoter()->GetAliased();
+    if (auto baseTypeDen = typeDen.As<BaseTypeDenoter>())
+    {
+        const auto dataType = baseTypeDen->dataType;
+        if ((IsScalarType(dataType) || IsVectorType(dataType)) && !IsDoubleRealType(dataType))
+            return VectorTypeDim(dataType);
+    }
+    return 0;
+}
+
+// Returns the size (in bytes) of the uniform buffer with the specified members in the specified order with std140 layout, or 0 on failure.
+static unsigned int GetMembersSize(const std::vector<VarDecl*>& members)
+{
+    unsigned int size = 0;
+
+    for (auto varDecl : members)
+    {
+        if (auto components = static_cast<unsigned int>(GetMemberComponents(varDecl)))
+        {
+            /* Scalars and vectors are aligned to their size, but "float3" is aligned like "float4" */
+            size += RemainingVectorSize(size, (components == 3 ? 16u : components * 4u));
+            size += components * 4u;
+        }
+        else
+        {
+            /* All other members start and end at a 16 byte boundary */
+            unsigned int memberSize = 0, padding = 0;
+            if (!varDecl->AccumAlignedVectorSize(memberSize, padding))
+                return 0;
+            size += RemainingVectorSize(size);
+            size += memberSize + RemainingVectorSize(memberSize);
+        }
+    }
+
+    return (size + RemainingVectorSize(size));
+}
+
+void UniformPacker::ReorderUniformBufferMembers(UniformBufferDecl& uniformBufferDecl)
+{
+    /* Sort all members by their number of components (in their original order) */
+    std::vector<VarDecl*> members, largeMembers, componentMembers[5];
+
+    for (const auto& varDeclStmnt : uniformBufferDecl.varMembers)
+    {
+        for (const auto& varDecl : varDeclStmnt->varDecls)
+        {
+            members.push_back(varDecl.get());
+            componentMembers[GetMemberComponents(varDecl.get())].push_back(varDecl.get());
+        }
+    }
+
+    /*
+    Fill each 16 byte row with small members first, i.e. "float4", "float3" + "float", "float2" + "float2", and four "float" members.
+    Members that occupy entire rows (i.e. arrays, structures, and matrices) are moved to the end,
+    so the padding after an array element is not filled differently by the std140 and HLSL packing rules.
+    */
+    std::vector<VarDecl*> reorderedMembers;
+
+    auto& scalars = componentMembers[1];
+    auto scalarIt = scalars.begin();
+
+    auto AppendScalars = [&](std::size_t count)
+    {
+        for (; count > 0 && scalarIt != scalars.end(); --count)
+            reorderedMembers.push_back(*scalarIt++);
+    };
+
+    reorderedMembers = componentMembers[4];
+
+    for (auto varDecl : componentMembers[3])
+    {
+        reorderedMembers.push_back(varDecl);
+        AppendScalars(1);
+    }
+
+    for (auto varDecl : componentMembers[2])
+        reorderedMembers.push_back(varDecl);
+
+    if (componentMembers[2].size() % 2 == 1)
+        AppendScalars(2);
+
+    AppendScalars(scalars.size());
+
+    reorderedMembers.insert(reorderedMembers.end(), componentMembers[0].begin(), componentMembers[0].end());
+
+    /* Only reorder members if the size of the uniform buffer is reduced */
+    const auto size = GetMembersSize(members);
+    const auto reorderedSize = GetMembersSize(reorderedMembers);
+
+    if (size == 0 || reorderedSize == 0 || reorderedSize >= size)
+        return;
+
+    /* Split declaration statements with multiple variables, so that each member has its own statement */
+    std::map<VarDecl*, VarDeclStmntPtr> memberStmnts;
+
+    for (auto& varDeclStmnt : uniformBufferDecl.varMembers)
+    {
+        while (varDeclStmnt->varDecls.size() > 1)
+        {
+            auto splitStmnt = ASTFactory::MakeVarDeclStmntSplit(varDeclStmnt, 0);
+            auto varDecl = splitStmnt->varDecls.front().get();
+            varDecl->declStmntRef = splitStmnt.get();
+            memberStmnts[varDecl] = splitStmnt;
+        }
+        memberStmnts[varDeclStmnt->varDecls.front().get()] = varDeclStmnt;
+    }
+
+    /* Replace member statements in the new order, but keep all other local statements (e.g. structure declarations) */
+    uniformBufferDecl.varMembers.clear();
+
+    auto& localStmnts = uniformBufferDecl.localStmnts;
+    localStmnts.erase(
+        std::remove_if(
+            localStmnts.begin(), localStmnts.end(),
+            [](const StmntPtr& stmnt)
+            {
+                return (stmnt->Type() == AST::Types::VarDeclStmnt);
+            }
+        ),
+        localStmnts.end()
+    );
+
+    for (auto varDecl : reorderedMembers)
+    {
+        const auto& varDeclStmnt = memberStmnts[varDecl];
+        uniformBufferDecl.varMembers.push_back(varDeclStmnt);
+        localStmnts.push_back(varDeclStmnt);
+    }
+}
+
+BasicDeclStmntPtr UniformPacker::MakeMergedUniformBuffer(const std::vector<UniformBufferDecl*>& uniformBufferDecls, const std::string& ident)
+{
+    auto declStmnt = std::make_shared<BasicDeclStmnt>(SourcePosition::ignore);
+
+    auto mergedBufferDecl = std::make_shared<UniformBufferDecl>(SourcePosition::ignore);
+    {
+        /* Take binding slot of the first constant buffer */
+        mergedBufferDecl->ident         = ident;
+        mergedBufferDecl->bufferType    = UniformBufferType::ConstantBuffer;
+        mergedBufferDecl->slotRegisters = uniformBufferDecls.front()->slotRegisters;
+        mergedBufferDecl->declStmntRef  = declStmnt.get();
+        mergedBufferDecl->flags << AST::isReachable;
+
+        /* Append statements of all constant buffers, and keep track of their member ranges */
+        for (auto uniformBufferDecl : uniformBufferDecls)
+        {
+            UniformBufferDecl::MergedBuffer mergedBuffer;
+            {
+                mergedBuffer.ident          = uniformBufferDecl->ident;
+                mergedBuffer.slotRegisters  = uniformBufferDecl->slotRegisters;
+                mergedBuffer.firstMember    = mergedBufferDecl->varMembers.size();
+                mergedBuffer.numMembers     = uniformBufferDecl->varMembers.size();
+            }
+            mergedBufferDecl->mergedBuffers.push_back(mergedBuffer);
+
+            for (const auto& varDeclStmnt : uniformBufferDecl->varMembers)
+            {
+                for (auto& varDecl : varDeclStmnt->varDecls)
+                    varDecl->bufferDeclRef = mergedBufferDecl.get();
+            }
+
+            mergedBufferDecl->localStmnts.insert(
+                mergedBufferDecl->localStmnts.end(),
+                uniformBufferDecl->localStmnts.begin(),
+                uniformBufferDecl->localStmnts.end()
+            );
+            mergedBufferDecl->varMembers.insert(
+                mergedBufferDecl->varMembers.end(),
+                uniformBufferDecl->varMembers.begin(),
+                uniformBufferDecl->varMembers.end()
+            );
+        }
+    }
+
+    declStmnt->declObject = mergedBufferDecl;
+    declStmnt->flags << AST::isReachable;
+
+    return declStmnt;
+}
+
 bool UniformPacker::CanConvertUniformWithTypeDenoter(const TypeDenoter& typeDen) const
 {
     return !(typeDen.IsSampler() || typeDen.IsBuffer());
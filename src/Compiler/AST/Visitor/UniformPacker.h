@@ -21,6 +21,7 @@ namespace Xsc
 /*
 Uniform packer is not a visitor in the conventional sense.
 It only itertates over all global statements and moves all uniform declarations into a single uniform buffer.
+It also reorders the members of uniform buffers to minimize their size, and merges small constant buffers into a single uniform buffer.
 */
 class UniformPacker
 {
@@ -46,6 +47,15 @@ class UniformPacker
         // Converts the program by moving all global uniform declarations into a single uniform buffer.
         void Convert(Program& program, const CbufferAttributes& cbufferAttribs = {}, bool onlyReachableStmnts = true);
 
+        // Reorders the members of all uniform buffers with the 'isReorderable' flag to minimize their size with std140 layout.
+        void ReorderMembers(Program& program);
+
+        /*
+        Merges all reachable constant buffers with the same update frequency, and all reachable constant buffers without update frequency
+        whose size does not exceed the specified threshold, into a single uniform buffer per group. Push constant blocks are not merged.
+        */
+        void MergeBuffers(Program& program, unsigned int sizeThreshold, const std::string& bufferName);
+
     private:
 
         /* === Functions === */
@@ -53,6 +63,10 @@ class UniformPacker
         void MakeUniformBuffer();
         void AppendUniform(const VarDeclStmntPtr& varDeclStmnt);
 
+        void ReorderUniformBufferMembers(UniformBufferDecl& uniformBufferDecl);
+
+        BasicDeclStmntPtr MakeMergedUniformBuffer(const std::vector<UniformBufferDecl*>& uniformBufferDecls, const std::string& ident);
+
         bool CanConvertUniformWithTypeDenoter(const TypeDenoter& typeDen) const;
 
         /* === Members === */
@@ -0,0 +1,240 @@
+/*
+ * UniformSpecializer.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "UniformSpecializer.h"
+#include "AST.h"
+#include "ASTFactory.h"
+#include <cstdint>
+#include <cmath>
+
+
+namespace Xsc
+{
+
+
+std::vector<std::string> UniformSpecializer::Specialize(
+    Program& program, const std::map<std::string, UniformValue>& uniformValues, const NameMangling& nameMangling)
+{
+    uniformValues_  = (&uniformValues);
+    nameMangling_   = (&nameMangling);
+    appliedValues_.clear();
+
+    /* Specialize global uniforms and constant buffer members */
+    auto& globalStmnts = program.globalStmnts;
+
+    for (auto it = globalStmnts.begin(); it != globalStmnts.end();)
+    {
+        std::vector<StmntPtr> constStmnts;
+        bool removeStmnt = false;
+
+        if (auto varDeclStmnt = (*it)->As<VarDeclStmnt>())
+        {
+            if (varDeclStmnt->IsUniform())
+            {
+                SpecializeVarDeclStmnt(*varDeclStmnt, constStmnts);
+                removeStmnt = varDeclStmnt->varDecls.empty();
+            }
+        }
+        else if (auto basicDeclStmnt = (*it)->As<BasicDeclStmnt>())
+        {
+            if (auto uniformBufferDecl = basicDeclStmnt->declObject->As<UniformBufferDecl>())
+                SpecializeUniformBuffer(*uniformBufferDecl, constStmnts);
+        }
+
+        /* Remove statements that no longer declare anything */
+        if (removeStmnt)
+            it = globalStmnts.erase(it);
+
+        /* Insert constant declarations in front of their former uniform declarations */
+        it = globalStmnts.insert(it, constStmnts.begin(), constStmnts.end());
+        it += static_cast<std::ptrdiff_t>(constStmnts.size());
+
+        if (!removeStmnt)
+            ++it;
+    }
+
+    /* Return names of all values that have not been applied */
+    std::vector<std::string> unappliedValues;
+
+    for (const auto& entry : uniformValues)
+    {
+        if (appliedValues_.find(entry.first) == appliedValues_.end())
+            unappliedValues.push_back(entry.first);
+    }
+
+    return unappliedValues;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void UniformSpecializer::SpecializeVarDeclStmnt(VarDeclStmnt& varDeclStmnt, std::vector<StmntPtr>& constStmnts)
+{
+    auto& varDecls = varDeclStmnt.varDecls;
+
+    for (auto it = varDecls.begin(); it != varDecls.end();)
+    {
+        Variant value;
+        if (auto literalExpr = MakeSpecializedLiteral(**it, value))
+        {
+            /* Move variable into its own constant declaration statement */
+            constStmnts.push_back(MakeConstVarDeclStmnt(*it, *varDeclStmnt.typeSpecifier, literalExpr, value));
+            it = varDecls.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+
+void UniformSpecializer::SpecializeUniformBuffer(UniformBufferDecl& uniformBufferDecl, std::vector<StmntPtr>& constStmnts)
+{
+    for (const auto& varDeclStmnt : uniformBufferDecl.varMembers)
+    {
+        for (auto& varDecl : varDeclStmnt->varDecls)
+        {
+            Variant value;
+            if (auto literalExpr = MakeSpecializedLiteral(*varDecl, value))
+            {
+                /* Replace member by an unused placeholder, so the layout of the constant buffer remains unchanged */
+                auto constVarDecl = varDecl;
+                varDecl = MakePlaceholderVarDecl(*constVarDecl);
+
+                /* Rename constant, since the members of a uniform block share the global namespace in GLSL */
+                constVarDecl->ident.AppendPrefix(nameMangling_->temporaryPrefix);
+
+                constStmnts.push_back(MakeConstVarDeclStmnt(constVarDecl, *varDeclStmnt->typeSpecifier, literalExpr, value));
+            }
+        }
+    }
+}
+
+// Converts the specified uniform value into a variant of the specified scalar data type, or returns an invalid variant if the value is not representable.
+static Variant ConvertUniformValue(const UniformValue& value, const DataType dataType)
+{
+    Variant variant;
+
+    switch (value.type)
+    {
+        case UniformValue::Type::Bool:
+            variant = Variant::BoolType(value.boolValue);
+            break;
+        case UniformValue::Type::Int:
+            variant = Variant::IntType(value.intValue);
+            break;
+        case UniformValue::Type::Float:
+            variant = Variant::RealType(value.floatValue);
+            break;
+    }
+
+    if (IsBooleanType(dataType))
+        return variant.ToBool();
+
+    if (IsIntegralType(dataType))
+    {
+        /* Reject integers that overflow the 32-bit data type */
+        if (value.type == UniformValue::Type::Float && !std::isfinite(value.floatValue))
+            return {};
+
+        const auto intValue = variant.ToInt();
+
+        if (IsUIntType(dataType))
+        {
+            if (intValue < 0 || intValue > static_cast<Variant::IntType>(UINT32_MAX))
+                return {};
+        }
+        else if (intValue < static_cast<Variant::IntType>(INT32_MIN) || intValue > static_cast<Variant::IntType>(INT32_MAX))
+            return {};
+
+        return intValue;
+    }
+
+    if (IsRealType(dataType))
+    {
+        const auto realValue = variant.ToReal();
+        if (!std::isfinite(realValue))
+            return {};
+        return realValue;
+    }
+
+    return {};
+}
+
+LiteralExprPtr UniformSpecializer::MakeSpecializedLiteral(VarDecl& varDecl, Variant& value) const
+{
+    /* Find value for this uniform */
+    auto it = uniformValues_->find(varDecl.ident.Original());
+    if (it == uniformValues_->end())
+        return nullptr;
+
+    /* Only specialize uniforms of scalar type */
+    if (!varDecl.arrayDims.empty())
+        return nullptr;
+
+    auto baseTypeDen = varDecl.GetTypeDenoter()->GetAliased().As<BaseTypeDenoter>();
+    if (!baseTypeDen || !IsScalarType(baseTypeDen->dataType))
+        return nullptr;
+
+    /* Make literal expression with the data type of the uniform */
+    value = ConvertUniformValue(it->second, baseTypeDen->dataType);
+    if (!value.IsValid())
+        return nullptr;
+
+    if (auto literalExpr = ASTFactory::MakeLiteralExprOrNull(value))
+    {
+        literalExpr->ConvertDataType(baseTypeDen->dataType);
+        return literalExpr;
+    }
+
+    return nullptr;
+}
+
+VarDeclPtr UniformSpecializer::MakePlaceholderVarDecl(const VarDecl& varDecl)
+{
+    auto ast = std::make_shared<VarDecl>(varDecl.area);
+    {
+        ast->ident          = varDecl.ident;
+        ast->semantic       = varDecl.semantic;
+        ast->packOffset     = varDecl.packOffset;
+        ast->declStmntRef   = varDecl.declStmntRef;
+        ast->bufferDeclRef  = varDecl.bufferDeclRef;
+    }
+    return ast;
+}
+
+VarDeclStmntPtr UniformSpecializer::MakeConstVarDeclStmnt(
+    const VarDeclPtr& varDecl, const TypeSpecifier& typeSpecifier, const LiteralExprPtr& literalExpr, const Variant& value)
+{
+    auto ast = std::make_shared<VarDeclStmnt>(varDecl->area);
+    {
+        /* Make type specifier for a static constant */
+        ast->typeSpecifier = ASTFactory::MakeTypeSpecifier(typeSpecifier.typeDenoter);
+        ast->typeSpecifier->area = typeSpecifier.area;
+        ast->typeSpecifier->storageClasses.insert(StorageClass::Static);
+        ast->typeSpecifier->SetTypeModifier(TypeModifier::Const);
+
+        /* Move variable into new statement (references to this variable remain valid) */
+        varDecl->declStmntRef       = ast.get();
+        varDecl->bufferDeclRef      = nullptr;
+        varDecl->initializer        = literalExpr;
+        varDecl->initializerValue   = value;
+        varDecl->packOffset.reset();
+        varDecl->slotRegisters.clear();
+
+        ast->varDecls.push_back(varDecl);
+    }
+    appliedValues_.insert(varDecl->ident.Original());
+    return ast;
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
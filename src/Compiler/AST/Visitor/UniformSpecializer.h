@@ -0,0 +1,74 @@
+/*
+ * UniformSpecializer.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_UNIFORM_SPECIALIZER_H
+#define XSC_UNIFORM_SPECIALIZER_H
+
+
+#include <Xsc/Xsc.h>
+#include "Visitor.h"
+#include "Variant.h"
+#include <string>
+#include <vector>
+#include <set>
+
+
+namespace Xsc
+{
+
+
+/*
+Uniform specializer is not a visitor in the conventional sense.
+It only iterates over all global statements and constant buffers, and converts the uniforms with a known value
+into static constants (e.g. "uniform bool useFog;" -> "static const bool useFog = true;").
+The optimizer then propagates these constants and removes the dead branches.
+*/
+class UniformSpecializer
+{
+
+    public:
+
+        // Specializes the program with the specified uniform values, and returns the names of all values that could not be applied. Renamed constants get the 'temporaryPrefix'.
+        std::vector<std::string> Specialize(Program& program, const std::map<std::string, UniformValue>& uniformValues, const NameMangling& nameMangling);
+
+    private:
+
+        /* === Functions === */
+
+        // Moves all specialized variables out of the specified statement, and appends their new constant declaration statements.
+        void SpecializeVarDeclStmnt(VarDeclStmnt& varDeclStmnt, std::vector<StmntPtr>& constStmnts);
+
+        // Moves all specialized members out of the specified constant buffer (leaving placeholders behind), and appends their new constant declaration statements.
+        void SpecializeUniformBuffer(UniformBufferDecl& uniformBufferDecl, std::vector<StmntPtr>& constStmnts);
+
+        // Returns the literal expression for the specified variable, or null if the variable is not specialized.
+        LiteralExprPtr MakeSpecializedLiteral(VarDecl& varDecl, Variant& value) const;
+
+        // Returns a new variable with the same identifier and layout as the specified constant buffer member, which takes its place in the constant buffer.
+        VarDeclPtr MakePlaceholderVarDecl(const VarDecl& varDecl);
+
+        // Returns a new static constant declaration statement for the specified variable.
+        VarDeclStmntPtr MakeConstVarDeclStmnt(const VarDeclPtr& varDecl, const TypeSpecifier& typeSpecifier, const LiteralExprPtr& literalExpr, const Variant& value);
+
+        /* === Members === */
+
+        const std::map<std::string, UniformValue>*  uniformValues_  = nullptr;
+        const NameMangling*                         nameMangling_   = nullptr;
+
+        std::set<std::string>                       appliedValues_;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,566 @@
+/*
+ * VaryingLinker.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VaryingLinker.h"
+#include "IntrinsicAdept.h"
+#include "CiString.h"
+#include "AST.h"
+#include <algorithm>
+
+
+namespace Xsc
+{
+
+
+// Determines the number of floating-point components and the number of locations of the specified varying type.
+static void GetVaryingTypeSize(const TypeDenoter& typeDen, int& components, int& locations)
+{
+    const auto& aliasedTypeDen = typeDen.GetAliased();
+
+    components  = 0;
+    locations   = 1;
+
+    if (auto arrayTypeDen = aliasedTypeDen.As<ArrayTypeDenoter>())
+    {
+        /* Arrays never share a location with other varyings */
+        int subComponents = 0;
+        GetVaryingTypeSize(*arrayTypeDen->subTypeDenoter, subComponents, locations);
+        locations *= std::max(1, arrayTypeDen->NumArrayElements());
+    }
+    else if (auto baseTypeDen = aliasedTypeDen.As<BaseTypeDenoter>())
+    {
+        const auto dataType = baseTypeDen->dataType;
+
+        if (IsMatrixType(dataType))
+        {
+            /* Matrices occupy one location per column (or row, whichever is larger to be independent of the matrix packing) */
+            const auto matrixDim = MatrixTypeDim(dataType);
+            locations = std::max(matrixDim.first, matrixDim.second);
+        }
+        else if (IsDoubleRealType(dataType))
+        {
+            /* 64-bit vectors with more than two components occupy two locations */
+            if (VectorTypeDim(dataType) > 2)
+                locations = 2;
+        }
+        else if (IsRealType(dataType))
+        {
+            /* Only 32-bit floating-point scalars and vectors can share a location */
+            components = VectorTypeDim(dataType);
+        }
+    }
+}
+
+static VaryingLinker::Varying MakeVarying(const IndexedSemantic& semantic, const TypeDenoter& typeDen, const TypeSpecifier* typeSpecifier)
+{
+    VaryingLinker::Varying varying;
+
+    varying.semantic = semantic.ToString();
+
+    GetVaryingTypeSize(typeDen, varying.components, varying.locations);
+
+    if (typeSpecifier)
+    {
+        /* Linear interpolation is the default, so it is equal to no interpolation modifier */
+        varying.interpModifiers = typeSpecifier->interpModifiers;
+        varying.interpModifiers.erase(InterpModifier::Linear);
+    }
+
+    return varying;
+}
+
+void VaryingLinker::CollectVaryings(Program& program, const ShaderTarget shaderTarget, ShaderInterface& shaderInterface)
+{
+    if (auto entryPoint = program.entryPointRef)
+    {
+        /* Determine which variables are read by the entry point */
+        CollectReadVarDecls(entryPoint);
+
+        /* Collect all user-defined inputs */
+        for (auto varDecl : entryPoint->inputSemantics.varDeclRefs)
+        {
+            auto varying = MakeVarying(varDecl->semantic, *varDecl->GetTypeDenoter(), varDecl->FetchTypeSpecifier());
+            varying.isRead = IsVarDeclRead(varDecl);
+            shaderInterface.inputs.push_back(varying);
+        }
+
+        /* Collect all user-defined outputs (only vertex shader outputs can be removed) */
+        for (auto varDecl : entryPoint->outputSemantics.varDeclRefs)
+        {
+            auto varying = MakeVarying(varDecl->semantic, *varDecl->GetTypeDenoter(), varDecl->FetchTypeSpecifier());
+            varying.isRemovable = (shaderTarget == ShaderTarget::VertexShader);
+            shaderInterface.outputs.push_back(varying);
+        }
+
+        if (entryPoint->semantic.IsUserDefined())
+        {
+            /* Add output of the entry point return semantic, which can not be removed */
+            auto returnType = entryPoint->returnType.get();
+            shaderInterface.outputs.push_back(MakeVarying(entryPoint->semantic, *returnType->typeDenoter, returnType));
+        }
+    }
+}
+
+// Returns true if the specified layout contains the specified semantic.
+static bool ContainsVaryingSemantic(const VaryingLayout& layout, const IndexedSemantic& semantic)
+{
+    const auto semanticCi = ToCiString(semantic.ToString());
+    for (const auto& varying : layout.varyings)
+    {
+        if (ToCiString(varying.semantic) == semanticCi)
+            return true;
+    }
+    return false;
+}
+
+void VaryingLinker::EliminateInputs(Program& program, const ShaderTarget shaderTarget, const VaryingLayout& layout)
+{
+    auto entryPoint = program.entryPointRef;
+    if (!entryPoint || !layout.enabled || shaderTarget == ShaderTarget::VertexShader)
+        return;
+
+    CollectReadVarDecls(entryPoint);
+
+    /* Keep inputs that are not written by the previous shader stage as private variables, unless they are read */
+    for (auto varDecl : entryPoint->inputSemantics.varDeclRefs)
+    {
+        if (!ContainsVaryingSemantic(layout, varDecl->semantic) && !IsVarDeclRead(varDecl))
+            varDecl->flags << VarDecl::isUnlinkedVarying;
+    }
+}
+
+void VaryingLinker::EliminateOutputs(Program& program, const ShaderTarget shaderTarget, const VaryingLayout& layout)
+{
+    auto entryPoint = program.entryPointRef;
+    if (!entryPoint || !layout.enabled || shaderTarget != ShaderTarget::VertexShader)
+        return;
+
+    /* Gather all user-defined outputs, that are not passed to the next shader stage */
+    std::set<VarDecl*> unlinkedOutputs;
+
+    for (auto varDecl : entryPoint->outputSemantics.varDeclRefs)
+    {
+        if (!ContainsVaryingSemantic(layout, varDecl->semantic))
+            unlinkedOutputs.insert(varDecl);
+    }
+
+    if (unlinkedOutputs.empty())
+        return;
+
+    /* Remove assignments to unlinked outputs that are never read (repeat, since removed assignments can make further outputs unread) */
+    for (bool removed = true; removed;)
+    {
+        CollectReadVarDecls(entryPoint);
+
+        std::set<VarDecl*> unreadOutputs;
+        for (auto varDecl : unlinkedOutputs)
+        {
+            if (!IsVarDeclRead(varDecl))
+                unreadOutputs.insert(varDecl);
+        }
+
+        removed = RemoveStores(unreadOutputs);
+    }
+
+    /* Keep unlinked outputs that are still read as private variables, and remove all other unlinked outputs from the entry point */
+    auto& varDeclRefs = entryPoint->outputSemantics.varDeclRefs;
+
+    for (auto it = varDeclRefs.begin(); it != varDeclRefs.end();)
+    {
+        auto varDecl = *it;
+        if (unlinkedOutputs.find(varDecl) != unlinkedOutputs.end())
+        {
+            if (IsVarDeclRead(varDecl))
+                varDecl->flags << VarDecl::isUnlinkedVarying;
+            else
+            {
+                it = varDeclRefs.erase(it);
+                continue;
+            }
+        }
+        ++it;
+    }
+}
+
+// Returns true if the specified semantic is read by any of the specified inputs.
+static bool IsInputRead(const std::vector<VaryingLinker::Varying>& inputs, const std::string& semantic)
+{
+    const auto semanticCi = ToCiString(semantic);
+    for (const auto& input : inputs)
+    {
+        if (input.isRead && ToCiString(input.semantic) == semanticCi)
+            return true;
+    }
+    return false;
+}
+
+void VaryingLinker::LinkVaryings(
+    const std::vector<Varying>& outputs,
+    const std::vector<Varying>& inputs,
+    bool                        packComponents,
+    VaryingLayout&              layout)
+{
+    layout.enabled = true;
+    layout.varyings.clear();
+
+    /* Gather all outputs, that are read by the next shader stage or that can not be removed */
+    std::vector<const Varying*> separateVaryings, packedVaryings;
+
+    for (const auto& output : outputs)
+    {
+        if (!output.isRemovable || IsInputRead(inputs, output.semantic))
+        {
+            if (packComponents && output.components > 0)
+                packedVaryings.push_back(&output);
+            else
+                separateVaryings.push_back(&output);
+        }
+    }
+
+    /* Assign separate locations to all varyings, that can not share a location */
+    int nextLocation = 0;
+
+    for (auto varying : separateVaryings)
+    {
+        VaryingLocation varyingLoc;
+        {
+            varyingLoc.semantic = varying->semantic;
+            varyingLoc.location = nextLocation;
+        }
+        layout.varyings.push_back(varyingLoc);
+        nextLocation += varying->locations;
+    }
+
+    /* Pack all remaining varyings with first-fit decreasing by their number of components */
+    std::stable_sort(
+        packedVaryings.begin(), packedVaryings.end(),
+        [](const Varying* lhs, const Varying* rhs)
+        {
+            return (lhs->components > rhs->components);
+        }
+    );
+
+    struct Interpolator
+    {
+        int                             location;
+        int                             components;
+        const std::set<InterpModifier>* interpModifiers;
+    };
+
+    std::vector<Interpolator> interpolators;
+
+    for (auto varying : packedVaryings)
+    {
+        auto it = std::find_if(
+            interpolators.begin(), interpolators.end(),
+            [varying](const Interpolator& interp)
+            {
+                return (interp.components + varying->components <= 4 && *interp.interpModifiers == varying->interpModifiers);
+            }
+        );
+
+        if (it != interpolators.end())
+        {
+            /* Pack varying into the free components of an interpolator */
+            VaryingLocation varyingLoc;
+            {
+                varyingLoc.semantic     = varying->semantic;
+                varyingLoc.location     = it->location;
+                varyingLoc.component    = it->components;
+            }
+            layout.varyings.push_back(varyingLoc);
+            it->components += varying->components;
+        }
+        else
+        {
+            /* Allocate new interpolator */
+            VaryingLocation varyingLoc;
+            {
+                varyingLoc.semantic = varying->semantic;
+                varyingLoc.location = nextLocation;
+            }
+            layout.varyings.push_back(varyingLoc);
+            interpolators.push_back({ nextLocation, varying->components, &(varying->interpModifiers) });
+            ++nextLocation;
+        }
+    }
+
+    /* Sort layout by locations and components */
+    std::sort(
+        layout.varyings.begin(), layout.varyings.end(),
+        [](const VaryingLocation& lhs, const VaryingLocation& rhs)
+        {
+            if (lhs.location != rhs.location)
+                return (lhs.location < rhs.location);
+            return (lhs.component < rhs.component);
+        }
+    );
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VaryingLinker::CollectReadVarDecls(FunctionDecl* entryPoint)
+{
+    entryPoint_ = entryPoint;
+
+    visitedFuncDecls_.clear();
+    readVarDecls_.clear();
+    outputStores_.clear();
+    stmntLists_.clear();
+
+    visitedFuncDecls_.insert(entryPoint);
+
+    insideEntryPoint_ = true;
+    Visit(entryPoint);
+}
+
+void VaryingLinker::MarkVarDeclRead(VarDecl* varDecl, bool recursive)
+{
+    if (readVarDecls_.insert(varDecl).second && recursive)
+    {
+        /* Mark all members of the structure type (also for arrays of structures) */
+        auto typeDen = &(varDecl->GetTypeDenoter()->GetAliased());
+
+        while (auto arrayTypeDen = typeDen->As<ArrayTypeDenoter>())
+            typeDen = &(arrayTypeDen->subTypeDenoter->GetAliased());
+
+        if (auto structTypeDen = typeDen->As<StructTypeDenoter>())
+        {
+            if (auto structDecl = structTypeDen->structDeclRef)
+            {
+                structDecl->ForEachVarDecl(
+                    [this](VarDeclPtr& memberVarDecl)
+                    {
+                        MarkVarDeclRead(memberVarDecl.get(), true);
+                    }
+                );
+            }
+        }
+    }
+}
+
+bool VaryingLinker::IsVarDeclRead(VarDecl* varDecl) const
+{
+    return (readVarDecls_.find(varDecl) != readVarDecls_.end());
+}
+
+// Returns the variable the specified l-value expression writes to (e.g. "s.v" for "s.v.xy"), or null if there is no such variable.
+static VarDecl* FetchLValueVarDecl(const Expr* expr)
+{
+    if (expr)
+    {
+        if (auto objectExpr = expr->As<ObjectExpr>())
+        {
+            if (auto varDecl = objectExpr->FetchVarDecl())
+                return varDecl;
+            else
+                return FetchLValueVarDecl(objectExpr->prefixExpr.get());
+        }
+        else if (auto arrayExpr = expr->As<ArrayExpr>())
+            return FetchLValueVarDecl(arrayExpr->prefixExpr.get());
+        else if (auto bracketExpr = expr->As<BracketExpr>())
+            return FetchLValueVarDecl(bracketExpr->expr.get());
+    }
+    return nullptr;
+}
+
+void VaryingLinker::VisitLValueExpr(Expr* expr)
+{
+    /* Structures that are written as a whole are treated as read, since all of their members are referenced */
+    if (auto varDecl = FetchLValueVarDecl(expr))
+    {
+        if (varDecl->GetTypeDenoter()->GetAliased().IsStruct())
+            MarkVarDeclRead(varDecl, true);
+    }
+
+    /* Only visit array indices of the l-value expression */
+    while (expr)
+    {
+        if (auto objectExpr = expr->As<ObjectExpr>())
+            expr = objectExpr->prefixExpr.get();
+        else if (auto arrayExpr = expr->As<ArrayExpr>())
+        {
+            Visit(arrayExpr->arrayIndices);
+            expr = arrayExpr->prefixExpr.get();
+        }
+        else if (auto bracketExpr = expr->As<BracketExpr>())
+            expr = bracketExpr->expr.get();
+        else
+        {
+            Visit(expr);
+            break;
+        }
+    }
+}
+
+bool VaryingLinker::RemoveStores(const std::set<VarDecl*>& varDecls)
+{
+    bool hasRemovedStmnts = false;
+
+    for (auto stmnts : stmntLists_)
+    {
+        for (auto it = stmnts->begin(); it != stmnts->end();)
+        {
+            auto storeIt = outputStores_.find(it->get());
+            if (storeIt != outputStores_.end() && varDecls.find(storeIt->second) != varDecls.end())
+            {
+                it = stmnts->erase(it);
+                hasRemovedStmnts = true;
+            }
+            else
+                ++it;
+        }
+    }
+
+    return hasRemovedStmnts;
+}
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void VaryingLinker::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+IMPLEMENT_VISIT_PROC(CodeBlock)
+{
+    stmntLists_.push_back(&(ast->stmnts));
+    VISIT_DEFAULT(CodeBlock);
+}
+
+IMPLEMENT_VISIT_PROC(SwitchCase)
+{
+    stmntLists_.push_back(&(ast->stmnts));
+    VISIT_DEFAULT(SwitchCase);
+}
+
+/* --- Statements --- */
+
+IMPLEMENT_VISIT_PROC(ExprStmnt)
+{
+    if (auto assignExpr = ast->expr->As<AssignExpr>())
+    {
+        if (assignExpr->op == AssignOp::Set)
+        {
+            /* Store assignments to entry point outputs, which can be removed if the output is unlinked */
+            auto varDecl = FetchLValueVarDecl(assignExpr->lvalueExpr.get());
+            if (varDecl && entryPoint_->outputSemantics.Contains(varDecl))
+            {
+                hasSideEffects_ = false;
+
+                VisitLValueExpr(assignExpr->lvalueExpr.get());
+                Visit(assignExpr->rvalueExpr);
+
+                /* Assignments with further side effects are never removed, so the output is treated as read */
+                if (hasSideEffects_)
+                    MarkVarDeclRead(varDecl, false);
+                else
+                    outputStores_[ast] = varDecl;
+
+                return;
+            }
+        }
+    }
+    VISIT_DEFAULT(ExprStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(ReturnStmnt)
+{
+    if (ast->expr && insideEntryPoint_ && entryPoint_->returnType->GetTypeDenoter()->GetAliased().IsStruct())
+    {
+        /* Returning the output structure variable from the entry point does not read its members */
+        if (auto objectExpr = ast->expr->As<ObjectExpr>())
+        {
+            if (!objectExpr->prefixExpr && objectExpr->FetchVarDecl() != nullptr)
+                return;
+        }
+
+        /* Other return expressions (e.g. function calls) reference all outputs */
+        for (auto varDecl : entryPoint_->outputSemantics.varDeclRefs)
+            MarkVarDeclRead(varDecl, false);
+    }
+    VISIT_DEFAULT(ReturnStmnt);
+}
+
+/* --- Expressions --- */
+
+IMPLEMENT_VISIT_PROC(UnaryExpr)
+{
+    if (IsLValueOp(ast->op))
+        hasSideEffects_ = true;
+    VISIT_DEFAULT(UnaryExpr);
+}
+
+IMPLEMENT_VISIT_PROC(PostUnaryExpr)
+{
+    hasSideEffects_ = true;
+    VISIT_DEFAULT(PostUnaryExpr);
+}
+
+IMPLEMENT_VISIT_PROC(CallExpr)
+{
+    /* Type constructors and intrinsics without output parameters have no side effects */
+    if (ast->intrinsic != Intrinsic::Undefined)
+    {
+        if (HasIntrinsicSideEffects(ast->intrinsic) || !IntrinsicAdept::Get().GetIntrinsicOutputParameterIndices(ast->intrinsic).empty())
+            hasSideEffects_ = true;
+    }
+    else if (!ast->typeDenoter || !ast->ident.empty())
+        hasSideEffects_ = true;
+
+    VISIT_DEFAULT(CallExpr);
+
+    /* Visit each called function only once */
+    if (auto funcDecl = ast->GetFunctionImpl())
+    {
+        if (visitedFuncDecls_.insert(funcDecl).second)
+        {
+            auto insideEntryPoint = insideEntryPoint_;
+            insideEntryPoint_ = false;
+            {
+                Visit(funcDecl);
+            }
+            insideEntryPoint_ = insideEntryPoint;
+        }
+    }
+}
+
+IMPLEMENT_VISIT_PROC(ObjectExpr)
+{
+    /* Mark variable as read, but only mark all structure members if this is not the prefix of a member access (e.g. "s" in "s.x") */
+    if (auto varDecl = ast->FetchVarDecl())
+        MarkVarDeclRead(varDecl, ast != memberPrefixExpr_);
+
+    if (ast->prefixExpr)
+    {
+        memberPrefixExpr_ = ast->prefixExpr->As<ObjectExpr>();
+        Visit(ast->prefixExpr);
+    }
+}
+
+IMPLEMENT_VISIT_PROC(AssignExpr)
+{
+    hasSideEffects_ = true;
+
+    if (ast->op == AssignOp::Set)
+    {
+        VisitLValueExpr(ast->lvalueExpr.get());
+        Visit(ast->rvalueExpr);
+    }
+    else
+        VISIT_DEFAULT(AssignExpr);
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
@@ -0,0 +1,127 @@
+/*
+ * VaryingLinker.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_VARYING_LINKER_H
+#define XSC_VARYING_LINKER_H
+
+
+#include <Xsc/Xsc.h>
+#include "Visitor.h"
+#include "ASTEnums.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+
+
+namespace Xsc
+{
+
+
+/*
+Varying linker AST visitor.
+This helper class collects the user-defined input and output varyings of the entry point for the "LinkShaderStages" function,
+packs them into interpolator locations, and removes all vertex shader outputs which are not read by the next shader stage.
+*/
+class VaryingLinker : private Visitor
+{
+
+    public:
+
+        // Interface information of a single varying.
+        struct Varying
+        {
+            std::string                 semantic;               // Semantic with index (e.g. "TEXCOORD0").
+            std::set<InterpModifier>    interpModifiers;        // Interpolation modifiers. Only varyings with equal modifiers can share a location.
+            int                         components  = 0;        // Number of floating-point components (1 to 4), or 0 if the varying can not share a location.
+            int                         locations   = 1;        // Number of locations the varying occupies on its own.
+            bool                        isRead      = false;    // Input is read by the entry point.
+            bool                        isRemovable = false;    // Output can be removed from the entry point.
+        };
+
+        // User-defined varyings of an entry point.
+        struct ShaderInterface
+        {
+            std::vector<Varying> inputs;
+            std::vector<Varying> outputs;
+        };
+
+        // Collects the user-defined input and output varyings of the entry point of the specified program.
+        void CollectVaryings(Program& program, const ShaderTarget shaderTarget, ShaderInterface& shaderInterface);
+
+        // Detaches the user-defined inputs, that are neither contained in the specified layout nor read by the entry point, from the previous shader stage.
+        void EliminateInputs(Program& program, const ShaderTarget shaderTarget, const VaryingLayout& layout);
+
+        // Removes the user-defined vertex shader outputs, that are not contained in the specified layout, together with their assignments.
+        void EliminateOutputs(Program& program, const ShaderTarget shaderTarget, const VaryingLayout& layout);
+
+        // Determines the layout of the varyings between the outputs of one shader stage and the inputs of the next shader stage.
+        static void LinkVaryings(
+            const std::vector<Varying>& outputs,
+            const std::vector<Varying>& inputs,
+            bool                        packComponents,
+            VaryingLayout&              layout
+        );
+
+    private:
+
+        /* === Functions === */
+
+        // Visits the entry point and all functions it calls, and stores all variables that are read.
+        void CollectReadVarDecls(FunctionDecl* entryPoint);
+
+        // Marks the specified variable as read. Members of structure variables are marked as well if 'recursive' is true.
+        void MarkVarDeclRead(VarDecl* varDecl, bool recursive);
+
+        // Returns true if the specified variable is read from.
+        bool IsVarDeclRead(VarDecl* varDecl) const;
+
+        // Visits the specified l-value expression, without marking the variables it writes to as read.
+        void VisitLValueExpr(Expr* expr);
+
+        // Removes all stored assignments to the specified variables, and returns true if any statement was removed.
+        bool RemoveStores(const std::set<VarDecl*>& varDecls);
+
+        /* --- Visitor implementation --- */
+
+        DECL_VISIT_PROC( CodeBlock     );
+        DECL_VISIT_PROC( SwitchCase    );
+
+        DECL_VISIT_PROC( ExprStmnt     );
+        DECL_VISIT_PROC( ReturnStmnt   );
+
+        DECL_VISIT_PROC( UnaryExpr     );
+        DECL_VISIT_PROC( PostUnaryExpr );
+        DECL_VISIT_PROC( CallExpr      );
+        DECL_VISIT_PROC( ObjectExpr    );
+        DECL_VISIT_PROC( AssignExpr    );
+
+        /* === Members === */
+
+        FunctionDecl*                       entryPoint_         = nullptr;
+
+        std::set<FunctionDecl*>             visitedFuncDecls_;
+        std::set<VarDecl*>                  readVarDecls_;
+
+        std::map<Stmnt*, VarDecl*>          outputStores_;      // Assignment statements without side effects to an entry point output.
+        std::vector<std::vector<StmntPtr>*> stmntLists_;
+
+        const ObjectExpr*                   memberPrefixExpr_   = nullptr;  // Prefix of the current member access (e.g. "s" in "s.x").
+        bool                                insideEntryPoint_   = false;
+        bool                                hasSideEffects_     = false;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
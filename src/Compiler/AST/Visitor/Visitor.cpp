@@ -256,10 +256,22 @@ IMPLEMENT_VISIT_PROC(TernaryExpr)
     Visit(ast->elseExpr);
 }
 
+/*
+Visits the chain of left-hand-side binary expressions iteratively to avoid deep recursion (e.g. for sums of thousands of terms).
+The nested binary expressions of this chain are not dispatched to the derived visitor again,
+so derived visitors that process each binary expression must override this function without calling the default implementation.
+*/
 IMPLEMENT_VISIT_PROC(BinaryExpr)
 {
-    Visit(ast->lhsExpr);
-    Visit(ast->rhsExpr);
+    std::vector<BinaryExpr*> lhsChain;
+
+    for (auto binaryExpr = ast; binaryExpr != nullptr; binaryExpr = binaryExpr->lhsExpr->As<BinaryExpr>())
+        lhsChain.push_back(binaryExpr);
+
+    Visit(lhsChain.back()->lhsExpr);
+
+    for (auto it = lhsChain.rbegin(); it != lhsChain.rend(); ++it)
+        Visit((*it)->rhsExpr);
 }
 
 IMPLEMENT_VISIT_PROC(UnaryExpr)
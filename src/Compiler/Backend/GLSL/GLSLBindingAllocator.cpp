@@ -0,0 +1,137 @@
+/*
+ * GLSLBindingAllocator.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLSLBindingAllocator.h"
+#include "ASTFactory.h"
+#include <algorithm>
+#include <map>
+
+
+namespace Xsc
+{
+
+
+UniformBufferDecl* GLSLBindingAllocator::MarkPushConstantBuffer(Program& program, const std::string& ident)
+{
+    for (auto& stmnt : program.globalStmnts)
+    {
+        if (auto basicDeclStmnt = stmnt->As<BasicDeclStmnt>())
+        {
+            if (auto uniformBufferDecl = basicDeclStmnt->declObject->As<UniformBufferDecl>())
+            {
+                if ( uniformBufferDecl->bufferType == UniformBufferType::ConstantBuffer &&
+                     uniformBufferDecl->flags(AST::isReachable) &&
+                     uniformBufferDecl->ident.Original() == ident )
+                {
+                    uniformBufferDecl->flags << UniformBufferDecl::isPushConstant;
+                    return uniformBufferDecl;
+                }
+            }
+        }
+    }
+    return nullptr;
+}
+
+void GLSLBindingAllocator::CompactBindings(Program& program, const ShaderTarget shaderTarget, bool separateSamplers)
+{
+    shaderTarget_ = shaderTarget;
+
+    /* Collect slot registers of all resources that are written to the output code */
+    for (auto& stmnt : program.globalStmnts)
+    {
+        if (!stmnt->flags(AST::isReachable))
+            continue;
+
+        if (auto basicDeclStmnt = stmnt->As<BasicDeclStmnt>())
+        {
+            if (auto uniformBufferDecl = basicDeclStmnt->declObject->As<UniformBufferDecl>())
+            {
+                if (uniformBufferDecl->flags(AST::isReachable) && !uniformBufferDecl->flags(UniformBufferDecl::isPushConstant))
+                    AddBinding(uniformBufferDecl->slotRegisters, RegisterType::ConstantBuffer);
+            }
+        }
+        else if (auto bufferDeclStmnt = stmnt->As<BufferDeclStmnt>())
+        {
+            const auto registerType = (IsRWBufferType(bufferDeclStmnt->typeDenoter->bufferType) ? RegisterType::UnorderedAccessView : RegisterType::TextureBuffer);
+            for (auto& bufferDecl : bufferDeclStmnt->bufferDecls)
+                AddBinding(bufferDecl->slotRegisters, registerType);
+        }
+        else if (auto samplerDeclStmnt = stmnt->As<SamplerDeclStmnt>())
+        {
+            if (separateSamplers || !IsSamplerStateType(samplerDeclStmnt->typeDenoter->samplerType))
+            {
+                for (auto& samplerDecl : samplerDeclStmnt->samplerDecls)
+                    AddBinding(samplerDecl->slotRegisters, RegisterType::Sampler);
+            }
+        }
+    }
+
+    /* Sort bindings by descriptor set, register type, and register slot (resources without register come last) */
+    std::stable_sort(
+        bindings_.begin(), bindings_.end(),
+        [](const Binding& lhs, const Binding& rhs)
+        {
+            if (lhs.space != rhs.space)
+                return (lhs.space < rhs.space);
+            if (lhs.registerType != rhs.registerType)
+                return (lhs.registerType < rhs.registerType);
+            if (lhs.hasRegister != rhs.hasRegister)
+                return lhs.hasRegister;
+            return (lhs.slot < rhs.slot);
+        }
+    );
+
+    /* Assign consecutive binding slots within each descriptor set */
+    std::map<int, int> nextSlots;
+
+    for (const auto& binding : bindings_)
+    {
+        auto slotRegister = ASTFactory::MakeRegister(nextSlots[binding.space]++, binding.registerType);
+        slotRegister->space = binding.space;
+
+        binding.slotRegisters->clear();
+        binding.slotRegisters->push_back(slotRegister);
+    }
+
+    bindings_.clear();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLSLBindingAllocator::AddBinding(std::vector<RegisterPtr>& slotRegisters, const RegisterType defaultRegisterType)
+{
+    Binding binding;
+    {
+        binding.slotRegisters = (&slotRegisters);
+
+        if (auto slotRegister = Register::GetForTarget(slotRegisters, shaderTarget_))
+        {
+            binding.registerType    = (slotRegister->registerType != RegisterType::Undefined ? slotRegister->registerType : defaultRegisterType);
+            binding.hasRegister     = true;
+            binding.slot            = slotRegister->slot;
+            binding.space           = slotRegister->space;
+        }
+        else
+        {
+            binding.registerType    = defaultRegisterType;
+            binding.hasRegister     = false;
+            binding.slot            = 0;
+            binding.space           = 0;
+        }
+    }
+    bindings_.push_back(binding);
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
@@ -0,0 +1,68 @@
+/*
+ * GLSLBindingAllocator.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_GLSL_BINDING_ALLOCATOR_H
+#define XSC_GLSL_BINDING_ALLOCATOR_H
+
+
+#include <Xsc/Targets.h>
+#include "AST.h"
+#include <string>
+#include <vector>
+
+
+namespace Xsc
+{
+
+
+/*
+GLSL binding allocator for VKSL output. This is not a visitor in the conventional sense,
+it only iterates over all global statements and assigns new slot registers to all referenced resources.
+The register space of each resource denotes its descriptor set, and the binding slots within each descriptor set are compacted.
+*/
+class GLSLBindingAllocator
+{
+
+    public:
+
+        // Marks the referenced constant buffer with the specified identifier as push constant block, and returns it (or null if there is no such constant buffer).
+        UniformBufferDecl* MarkPushConstantBuffer(Program& program, const std::string& ident);
+
+        // Compacts the binding slots of all referenced resources within each descriptor set (push constant blocks are ignored).
+        void CompactBindings(Program& program, const ShaderTarget shaderTarget, bool separateSamplers);
+
+    private:
+
+        struct Binding
+        {
+            std::vector<RegisterPtr>*   slotRegisters;
+            RegisterType                registerType;   // Type of the register, or the default register type if there is no register.
+            bool                        hasRegister;    // Resource has a slot register for the shader target.
+            int                         slot;           // Original register slot.
+            int                         space;          // Register space (i.e. the descriptor set).
+        };
+
+        /* === Functions === */
+
+        void AddBinding(std::vector<RegisterPtr>& slotRegisters, const RegisterType defaultRegisterType);
+
+        /* === Members === */
+
+        ShaderTarget            shaderTarget_   = ShaderTarget::Undefined;
+        std::vector<Binding>    bindings_;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -396,9 +396,9 @@ IMPLEMENT_VISIT_PROC(VarDeclStmnt)
             ast->typeSpecifier->SwapMatrixStorageLayout(TypeModifier::RowMajor);
     }
 
-    if (!InsideFunctionDecl())
+    if (!InsideFunctionDecl() && !ast->HasSpecConstants())
     {
-        /* Remove const type modifier from variables that are out of local function scope */
+        /* Remove const type modifier from variables that are out of local function scope (except for specialization constants) */
         ast->typeSpecifier->typeModifiers.erase(TypeModifier::Const);
     }
 
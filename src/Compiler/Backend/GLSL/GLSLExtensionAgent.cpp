@@ -11,6 +11,7 @@
 #include "Exception.h"
 #include "ReportIdents.h"
 #include <algorithm>
+#include <vector>
 
 
 namespace Xsc
@@ -43,6 +44,8 @@ std::set<std::string> GLSLExtensionAgent::DetermineRequiredExtensions(
     bool                    allowExtensions,
     bool                    explicitBinding,
     bool                    separateShaders,
+    bool                    linkedVaryings,
+    bool                    packedVaryings,
     const OnReportProc&     onReportExtension)
 {
     /* Store parameters */
@@ -76,6 +79,14 @@ std::set<std::string> GLSLExtensionAgent::DetermineRequiredExtensions(
             AcquireExtension(E_GL_ARB_separate_shader_objects);
     }
 
+    if (linkedVaryings && IsLanguageGLSL(targetGLSLVersion))
+    {
+        /* Check for explicit locations of varyings, and for packed varyings (see LinkShaderStages) */
+        AcquireExtension(E_GL_ARB_separate_shader_objects, R_VaryingLocation);
+        if (packedVaryings)
+            AcquireExtension(E_GL_ARB_enhanced_layouts, R_PackedVarying);
+    }
+
     /* Visit AST program */
     Visit(&program);
 
@@ -302,11 +313,22 @@ IMPLEMENT_VISIT_PROC(BasicDeclStmnt)
 
 IMPLEMENT_VISIT_PROC(BinaryExpr)
 {
-    /* Check if bitwise operators are used -> requires "GL_EXT_gpu_shader4" extensions */
-    if (IsBitwiseOp(ast->op) || ast->op == BinaryOp::Mod)
-        AcquireExtension(E_GL_EXT_gpu_shader4, R_BitwiseOperator, ast);
+    /* Iterate over chain of left-hand-side binary expressions to avoid deep recursion (e.g. for sums of thousands of terms) */
+    std::vector<BinaryExpr*> lhsChain;
+
+    for (auto binaryExpr = ast; binaryExpr != nullptr; binaryExpr = binaryExpr->lhsExpr->As<BinaryExpr>())
+    {
+        /* Check if bitwise operators are used -> requires "GL_EXT_gpu_shader4" extensions */
+        if (IsBitwiseOp(binaryExpr->op) || binaryExpr->op == BinaryOp::Mod)
+            AcquireExtension(E_GL_EXT_gpu_shader4, R_BitwiseOperator, binaryExpr);
+
+        lhsChain.push_back(binaryExpr);
+    }
+
+    Visit(lhsChain.back()->lhsExpr);
 
-    VISIT_DEFAULT(BinaryExpr);
+    for (auto it = lhsChain.rbegin(); it != lhsChain.rend(); ++it)
+        Visit((*it)->rhsExpr);
 }
 
 IMPLEMENT_VISIT_PROC(UnaryExpr)
@@ -36,6 +36,8 @@ class GLSLExtensionAgent : private Visitor
             bool                    allowExtensions,
             bool                    explicitBinding,
             bool                    separateShaders,
+            bool                    linkedVaryings,
+            bool                    packedVaryings,
             const OnReportProc&     onReportExtension = nullptr
         );
 
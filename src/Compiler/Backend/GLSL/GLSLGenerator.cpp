@@ -10,6 +10,8 @@
 #include "GLSLConverter.h"
 #include "GLSLKeywords.h"
 #include "GLSLIntrinsics.h"
+#include "GLSLPrecisionAnalyzer.h"
+#include "GLSLBindingAllocator.h"
 #include "ReferenceAnalyzer.h"
 #include "StructParameterAnalyzer.h"
 #include "TypeDenoter.h"
@@ -20,6 +22,7 @@
 #include "UniformPacker.h"
 #include "Helper.h"
 #include "ReportIdents.h"
+#include "Profiler.h"
 #include <initializer_list>
 #include <algorithm>
 #include <cctype>
@@ -66,18 +69,29 @@ void GLSLGenerator::GenerateCodePrimary(
     preserveComments_   = outputDesc.options.preserveComments;
     separateShaders_    = outputDesc.options.separateShaders;
     separateSamplers_   = outputDesc.options.separateSamplers;
+    reorderUniforms_    = outputDesc.options.reorderUniforms;
+    matchBufferLayout_  = outputDesc.options.matchBufferLayout;
     autoBinding_        = outputDesc.options.autoBinding;
     writeHeaderComment_ = outputDesc.options.writeGeneratorHeader;
     allowLineMarks_     = outputDesc.formatting.lineMarks;
     compactWrappers_    = outputDesc.formatting.compactWrappers;
     alwaysBracedScopes_ = outputDesc.formatting.alwaysBracedScopes;
     uniformPacking_     = outputDesc.uniformPacking;
+    bufferMerging_      = outputDesc.bufferMerging;
+    bindingLayout_      = outputDesc.bindingLayout;
     entryPointName_     = inputDesc.entryPoint;
 
     #ifdef XSC_ENABLE_LANGUAGE_EXT
     extensions_         = inputDesc.extensions;
     #endif
 
+    /* Store linked varyings (input varyings of vertex shaders and output varyings of fragment shaders are no varyings) */
+    if (outputDesc.inputVaryings.enabled && !IsVertexShader())
+        StoreLinkedVaryings(outputDesc.inputVaryings, inputVaryingsMap_);
+
+    if (outputDesc.outputVaryings.enabled && !IsFragmentShader())
+        StoreLinkedVaryings(outputDesc.outputVaryings, outputVaryingsMap_);
+
     for (const auto& s : outputDesc.vertexSemantics)
     {
         const auto semanticCi = ToCiString(s.semantic);
@@ -95,7 +109,10 @@ void GLSLGenerator::GenerateCodePrimary(
             PreProcessAST(inputDesc, outputDesc);
 
             /* Visit program AST */
-            Visit(&program);
+            {
+                Profiler::ScopedPass pass { "GLSLGenerator" };
+                Visit(&program);
+            }
 
             /* Check for optional warning feedback */
             ReportOptionalFeedback();
@@ -348,6 +365,30 @@ int GLSLGenerator::GetBindingLocation(const TypeDenoter* typeDenoter, bool input
     return startLocation;
 }
 
+void GLSLGenerator::StoreLinkedVaryings(const VaryingLayout& layout, std::map<CiString, VaryingLocation>& varyingsMap)
+{
+    for (const auto& varying : layout.varyings)
+    {
+        varyingsMap[ToCiString(varying.semantic)] = varying;
+
+        /* Components of packed varyings require the 'GL_ARB_enhanced_layouts' extension */
+        if (varying.component > 0)
+            packedVaryings_ = true;
+    }
+    linkedVaryings_ = true;
+}
+
+const VaryingLocation* GLSLGenerator::FindLinkedVarying(const IndexedSemantic& semantic, bool input) const
+{
+    const auto& varyingsMap = (input ? inputVaryingsMap_ : outputVaryingsMap_);
+
+    auto it = varyingsMap.find(ToCiString(semantic.ToString()));
+    if (it != varyingsMap.end())
+        return &(it->second);
+
+    return nullptr;
+}
+
 /* ------- Visit functions ------- */
 
 #define IMPLEMENT_VISIT_PROC(AST_NAME) \
@@ -433,6 +474,18 @@ IMPLEMENT_VISIT_PROC(TypeSpecifier)
 {
     if (ast->structDecl)
         Visit(ast->structDecl);
+    else if (IsESSL() && ast->flags(TypeSpecifier::isMediumPrecision))
+    {
+        /* Write inferred precision specifier */
+        Write("mediump ");
+        WriteTypeDenoter(*ast->typeDenoter, false, ast);
+    }
+    else if (IsESSL() && ast->flags(TypeSpecifier::isHighPrecision))
+    {
+        /* Write inferred precision specifier */
+        Write("highp ");
+        WriteTypeDenoter(*ast->typeDenoter, false, ast);
+    }
     else
         WriteTypeDenoter(*ast->typeDenoter, IsESSL(), ast);
 }
@@ -546,7 +599,13 @@ IMPLEMENT_VISIT_PROC(UniformBufferDecl)
                     if (ast->commonStorageLayout == TypeModifier::RowMajor)
                         Write("row_major");
                 },
-                [&]() { WriteLayoutBinding(ast->slotRegisters); },
+                [&]()
+                {
+                    if (ast->flags(UniformBufferDecl::isPushConstant))
+                        Write("push_constant");
+                    else
+                        WriteLayoutBinding(ast->slotRegisters);
+                },
             }
         );
 
@@ -631,76 +690,21 @@ IMPLEMENT_VISIT_PROC(VarDeclStmnt)
     }
     #endif
 
-    const auto& varDecl0 = varDecls.front();
-
     /* Ignore declaration statement of static member variables */
     if (ast->typeSpecifier->HasAnyStorageClassOf({ StorageClass::Static }) && ast->FetchStructDeclRef() != nullptr)
         return;
 
-    PushVarDeclStmnt(ast);
+    /*
+    Write specialization constants and buffer members with explicit layout with separate declarations,
+    since each one requires its own 'constant_id' or 'offset' layout qualifier or its own padding
+    */
+    if (varDecls.size() > 1 && (ast->HasSpecConstants() || HasBufferMemberLayout(varDecls)))
     {
-        BeginLn();
-
-        /* Write location layout qualifier */
-        if (!varDecl0->slotRegisters.empty())
-        {
-            WriteLayout(
-                {
-                    [&]() { WriteLayoutBindingOrLocation(varDecl0->slotRegisters); },
-                }
-            );
-        }
-
-        /* Write storage classes and interpolation modifiers (must be before in/out keywords) */
-        if (!InsideStructDecl())
-        {
-            WriteInterpModifiers(ast->typeSpecifier->interpModifiers, ast);
-            WriteStorageClasses(ast->typeSpecifier->storageClasses, ast);
-        }
-
-        Separator();
-
-        /* Write input modifiers */
-        if (ast->flags(VarDeclStmnt::isShaderInput))
-            Write("in ");
-        else if (ast->flags(VarDeclStmnt::isShaderOutput))
-            Write("out ");
-        else if (ast->IsUniform())
-            Write("uniform ");
-
-        Separator();
-
-        /* Write type modifiers */
-        WriteTypeModifiersFrom(ast->typeSpecifier);
-        Separator();
-
-        /* Write variable type */
-        if (ast->typeSpecifier->structDecl)
-        {
-            /* Do not end line here with "EndLn" */
-            Visit(ast->typeSpecifier);
-            BeginLn();
-        }
-        else
-        {
-            Visit(ast->typeSpecifier);
-            Write(" ");
-        }
-
-        Separator();
-
-        /* Write variable declarations */
-        for (std::size_t i = 0; i < varDecls.size(); ++i)
-        {
-            Visit(varDecls[i]);
-            if (i + 1 < varDecls.size())
-                Write(", ");
-        }
-
-        Write(";");
-        EndLn();
+        for (const auto& varDecl : varDecls)
+            WriteVarDeclStmnt(ast, { varDecl });
     }
-    PopVarDeclStmnt();
+    else
+        WriteVarDeclStmnt(ast, varDecls);
 
     if (InsideGlobalScope())
         Blank();
@@ -951,9 +955,20 @@ IMPLEMENT_VISIT_PROC(TernaryExpr)
 
 IMPLEMENT_VISIT_PROC(BinaryExpr)
 {
-    Visit(ast->lhsExpr);
-    Write(" " + BinaryOpToString(ast->op) + " ");
-    Visit(ast->rhsExpr);
+    /* Collect chain of left-hand-side binary expressions to avoid deep recursion (e.g. for sums of thousands of terms) */
+    std::vector<BinaryExpr*> lhsChain;
+
+    for (auto binaryExpr = ast; binaryExpr != nullptr; binaryExpr = binaryExpr->lhsExpr->As<BinaryExpr>())
+        lhsChain.push_back(binaryExpr);
+
+    /* Write inner most left-hand-side expression, then all operators and right-hand-side expressions from inner most to outer most */
+    Visit(lhsChain.back()->lhsExpr);
+
+    for (auto it = lhsChain.rbegin(); it != lhsChain.rend(); ++it)
+    {
+        Write(" " + BinaryOpToString((*it)->op) + " ");
+        Visit((*it)->rhsExpr);
+    }
 }
 
 IMPLEMENT_VISIT_PROC(UnaryExpr)
@@ -977,6 +992,8 @@ IMPLEMENT_VISIT_PROC(CallExpr)
         WriteCallExprIntrinsicRcp(ast);
     else if (ast->intrinsic == Intrinsic::Clip && ast->flags(CallExpr::canInlineIntrinsicWrapper))
         WriteCallExprIntrinsicClip(ast);
+    else if (ast->intrinsic == Intrinsic::Lit && ast->flags(CallExpr::canInlineIntrinsicWrapper))
+        WriteCallExprIntrinsicLit(ast);
     else if (ast->intrinsic == Intrinsic::InterlockedCompareExchange)
         WriteCallExprIntrinsicAtomicCompSwap(ast);
     else if (ast->intrinsic >= Intrinsic::InterlockedAdd && ast->intrinsic <= Intrinsic::InterlockedXor)
@@ -1076,10 +1093,15 @@ void GLSLGenerator::PreProcessAST(const ShaderInput& inputDesc, const ShaderOutp
     PreProcessReferenceAnalyzer(inputDesc);
     PreProcessExprConverterSecondary();
     PreProcessPackedUniforms();
+    PreProcessBufferLayouts();
+    PreProcessBindingAllocator();
+    PreProcessPrecisionAnalyzer(outputDesc);
 }
 
 void GLSLGenerator::PreProcessStructParameterAnalyzer(const ShaderInput& inputDesc)
 {
+    Profiler::ScopedPass pass { "StructParameterAnalyzer" };
+
     /* Mark all structures that are used for another reason than entry-point parameter */
     StructParameterAnalyzer structAnalyzer;
     structAnalyzer.MarkStructsFromEntryPoint(*GetProgram(), inputDesc.shaderTarget);
@@ -1087,6 +1109,8 @@ void GLSLGenerator::PreProcessStructParameterAnalyzer(const ShaderInput& inputDe
 
 void GLSLGenerator::PreProcessTypeConverter()
 {
+    Profiler::ScopedPass pass { "TypeConverter" };
+
     /* Convert type of specific semantics */
     TypeConverter typeConverter;
     typeConverter.Convert(*GetProgram(), GLSLConverter::ConvertVarDeclType);
@@ -1094,6 +1118,8 @@ void GLSLGenerator::PreProcessTypeConverter()
 
 void GLSLGenerator::PreProcessExprConverterPrimary()
 {
+    Profiler::ScopedPass pass { "ExprConverterPrimary" };
+
     /* Convert expressions (Before reference analysis) */
     ExprConverter converter;
     Flags converterFlags = ExprConverter::All;
@@ -1115,6 +1141,8 @@ void GLSLGenerator::PreProcessExprConverterPrimary()
 
 void GLSLGenerator::PreProcessGLSLConverter(const ShaderInput& inputDesc, const ShaderOutput& outputDesc)
 {
+    Profiler::ScopedPass pass { "GLSLConverter" };
+
     /* Convert AST for GLSL code generation (Before reference analysis) */
     GLSLConverter converter;
     converter.ConvertAST(*GetProgram(), inputDesc, outputDesc);
@@ -1122,6 +1150,8 @@ void GLSLGenerator::PreProcessGLSLConverter(const ShaderInput& inputDesc, const
 
 void GLSLGenerator::PreProcessFuncNameConverter()
 {
+    Profiler::ScopedPass pass { "FuncNameConverter" };
+
     /* Convert function names after main conversion, since functon owner structs may have been renamed as well */
     FuncNameConverter funcNameConverter;
     funcNameConverter.Convert(
@@ -1138,6 +1168,8 @@ void GLSLGenerator::PreProcessFuncNameConverter()
 
 void GLSLGenerator::PreProcessReferenceAnalyzer(const ShaderInput& inputDesc)
 {
+    Profiler::ScopedPass pass { "ReferenceAnalyzer" };
+
     /* Mark all reachable AST nodes */
     ReferenceAnalyzer refAnalyzer;
     refAnalyzer.MarkReferencesFromEntryPoint(*GetProgram(), inputDesc.shaderTarget);
@@ -1145,6 +1177,8 @@ void GLSLGenerator::PreProcessReferenceAnalyzer(const ShaderInput& inputDesc)
 
 void GLSLGenerator::PreProcessExprConverterSecondary()
 {
+    Profiler::ScopedPass pass { "ExprConverterSecondary" };
+
     /* Convert AST for GLSL code generation (After reference analysis) */
     ExprConverter converter;
     converter.Convert(*GetProgram(), ExprConverter::ConvertMatrixSubscripts, nameMangling_);
@@ -1152,6 +1186,8 @@ void GLSLGenerator::PreProcessExprConverterSecondary()
 
 void GLSLGenerator::PreProcessPackedUniforms()
 {
+    Profiler::ScopedPass pass { "PackedUniforms" };
+
     if (uniformPacking_.enabled)
     {
         /* Move all global uniform into a single uniform buffer */
@@ -1163,6 +1199,81 @@ void GLSLGenerator::PreProcessPackedUniforms()
         }
         packer.Convert(*GetProgram(), attribs);
     }
+
+    if (reorderUniforms_)
+    {
+        /* Reorder members of packed uniform buffer and constant buffers with 'reorder_members' attribute */
+        UniformPacker packer;
+        packer.ReorderMembers(*GetProgram());
+    }
+
+    if (IsVKSL() && !bindingLayout_.pushConstantBuffer.empty())
+    {
+        /* Map constant buffer to push constant block (Before merging, so it is not merged with other constant buffers) */
+        GLSLBindingAllocator allocator;
+        if (auto uniformBufferDecl = allocator.MarkPushConstantBuffer(*GetProgram(), bindingLayout_.pushConstantBuffer))
+        {
+            /* Vulkan only guarantees 128 bytes for push constants (see 'maxPushConstantsSize') */
+            static const unsigned int maxPushConstantsSize = 128;
+            unsigned int size = 0, padding = 0;
+            if (uniformBufferDecl->AccumAlignedVectorSize(size, padding) && size > maxPushConstantsSize)
+                Warning(R_PushConstantBufferTooLarge(bindingLayout_.pushConstantBuffer, std::to_string(size), std::to_string(maxPushConstantsSize)), uniformBufferDecl);
+        }
+        else
+            Warning(R_PushConstantBufferNotFound(bindingLayout_.pushConstantBuffer));
+    }
+
+    if (bufferMerging_.enabled)
+    {
+        /* Merge small constant buffers after reordering, so each merged constant buffer keeps its own member order */
+        UniformPacker packer;
+        packer.MergeBuffers(*GetProgram(), bufferMerging_.sizeThreshold, bufferMerging_.bufferName);
+    }
+}
+
+void GLSLGenerator::PreProcessBufferLayouts()
+{
+    Profiler::ScopedPass pass { "BufferLayouts" };
+
+    if (matchBufferLayout_ && versionOut_ >= OutputShaderVersion::GLSL140)
+    {
+        /* Determine layout of constant buffer members to match the HLSL packing rules (After uniform packing) */
+        for (auto& stmnt : GetProgram()->globalStmnts)
+        {
+            if (auto basicDeclStmnt = stmnt->As<BasicDeclStmnt>())
+            {
+                if (auto uniformBufferDecl = basicDeclStmnt->declObject->As<UniformBufferDecl>())
+                {
+                    if (uniformBufferDecl->flags(AST::isReachable) && uniformBufferDecl->bufferType == UniformBufferType::ConstantBuffer)
+                        DetermineBufferMemberLayouts(*uniformBufferDecl);
+                }
+            }
+        }
+    }
+}
+
+void GLSLGenerator::PreProcessBindingAllocator()
+{
+    Profiler::ScopedPass pass { "BindingAllocator" };
+
+    if (IsVKSL() && bindingLayout_.enabled)
+    {
+        /* Compact binding slots within each descriptor set (After uniform packing) */
+        GLSLBindingAllocator allocator;
+        allocator.CompactBindings(*GetProgram(), GetShaderTarget(), UseSeparateSamplers());
+    }
+}
+
+void GLSLGenerator::PreProcessPrecisionAnalyzer(const ShaderOutput& outputDesc)
+{
+    Profiler::ScopedPass pass { "PrecisionAnalyzer" };
+
+    if (IsESSL() && outputDesc.precisionPolicy.enabled)
+    {
+        /* Infer precision qualifiers (After all conversions) */
+        GLSLPrecisionAnalyzer precisionAnalyzer;
+        precisionAnalyzer.MarkPrecisions(*GetProgram(), outputDesc.precisionPolicy);
+    }
 }
 
 /* ----- Basics ----- */
@@ -1214,6 +1325,7 @@ void GLSLGenerator::WriteProgramHeader()
     GLSLExtensionAgent extensionAgent;
     auto requiredExtensions = extensionAgent.DetermineRequiredExtensions(
         *GetProgram(), versionOut_, GetShaderTarget(), allowExtensions_, explicitBinding_, separateShaders_,
+        linkedVaryings_, packedVaryings_,
         [this](const std::string& msg, const AST* ast)
         {
             /* Report either error or warning whether extensions are allowed or not */
@@ -1554,6 +1666,94 @@ void GLSLGenerator::WriteBuiltinBlockRedeclarationsPerVertex(bool input, const s
     Blank();
 }
 
+/* ----- Variable declaration ----- */
+
+void GLSLGenerator::WriteVarDeclStmnt(VarDeclStmnt* ast, const std::vector<VarDeclPtr>& varDecls)
+{
+    const auto& varDecl0 = varDecls.front();
+
+    /* Find explicit layout of constant buffer member */
+    auto memberLayoutIt = bufferMemberLayouts_.find(varDecl0.get());
+    auto memberLayout = (memberLayoutIt != bufferMemberLayouts_.end() ? &(memberLayoutIt->second) : nullptr);
+
+    /* Write padding members in front of buffer member */
+    if (memberLayout && !IsVKSL() && memberLayout->paddingSize > 0)
+        WriteBufferMemberPadding(memberLayout->paddingOffset, memberLayout->paddingSize);
+
+    PushVarDeclStmnt(ast);
+    {
+        BeginLn();
+
+        /* Write location layout qualifier */
+        if (!varDecl0->slotRegisters.empty())
+        {
+            WriteLayout(
+                {
+                    [&]() { WriteLayoutBindingOrLocation(varDecl0->slotRegisters); },
+                }
+            );
+        }
+
+        /* Write 'constant_id' layout qualifier for specialization constants */
+        if (varDecl0->IsSpecConstant())
+            WriteLayout("constant_id = " + std::to_string(varDecl0->specConstantID));
+
+        /* Write 'offset' layout qualifier for buffer members */
+        if (memberLayout && IsVKSL())
+            WriteLayout("offset = " + std::to_string(memberLayout->offset));
+
+        /* Write storage classes and interpolation modifiers (must be before in/out keywords) */
+        if (!InsideStructDecl())
+        {
+            WriteInterpModifiers(ast->typeSpecifier->interpModifiers, ast);
+            WriteStorageClasses(ast->typeSpecifier->storageClasses, ast);
+        }
+
+        Separator();
+
+        /* Write input modifiers */
+        if (ast->flags(VarDeclStmnt::isShaderInput))
+            Write("in ");
+        else if (ast->flags(VarDeclStmnt::isShaderOutput))
+            Write("out ");
+        else if (ast->IsUniform())
+            Write("uniform ");
+
+        Separator();
+
+        /* Write type modifiers */
+        WriteTypeModifiersFrom(ast->typeSpecifier);
+        Separator();
+
+        /* Write variable type */
+        if (ast->typeSpecifier->structDecl)
+        {
+            /* Do not end line here with "EndLn" */
+            Visit(ast->typeSpecifier);
+            BeginLn();
+        }
+        else
+        {
+            Visit(ast->typeSpecifier);
+            Write(" ");
+        }
+
+        Separator();
+
+        /* Write variable declarations */
+        for (std::size_t i = 0; i < varDecls.size(); ++i)
+        {
+            Visit(varDecls[i]);
+            if (i + 1 < varDecls.size())
+                Write(", ");
+        }
+
+        Write(";");
+        EndLn();
+    }
+    PopVarDeclStmnt();
+}
+
 /* ----- Layout ----- */
 
 void GLSLGenerator::WriteLayout(const std::initializer_list<LayoutEntryFunctor>& entryFunctors)
@@ -1620,7 +1820,7 @@ void GLSLGenerator::WriteLayoutBinding(const std::vector<RegisterPtr>& slotRegis
     if ( explicitBinding_ && ( !IsESSL() || versionOut_ >= OutputShaderVersion::ESSL310 ) )
     {
         if (auto slotRegister = Register::GetForTarget(slotRegisters, GetShaderTarget()))
-            Write("binding = " + std::to_string(slotRegister->slot));
+            WriteLayoutBindingSlot(*slotRegister);
     }
 }
 
@@ -1640,7 +1840,7 @@ void GLSLGenerator::WriteLayoutBindingOrLocation(const std::vector<RegisterPtr>&
                 case RegisterType::ConstantBuffer:
                 case RegisterType::TextureBuffer:
                 case RegisterType::Sampler:
-                    Write("binding = " + std::to_string(slotRegister->slot));
+                    WriteLayoutBindingSlot(*slotRegister);
                     break;
                 default:
                     break;
@@ -1649,6 +1849,36 @@ void GLSLGenerator::WriteLayoutBindingOrLocation(const std::vector<RegisterPtr>&
     }
 }
 
+void GLSLGenerator::WriteLayoutBindingSlot(const Register& slotRegister)
+{
+    /* Write descriptor set of the register space (only for VKSL) */
+    if (IsVKSL() && slotRegister.space > 0)
+        Write("set = " + std::to_string(slotRegister.space) + ", ");
+
+    Write("binding = " + std::to_string(slotRegister.slot));
+}
+
+void GLSLGenerator::WriteLayoutVaryingLocation(const VaryingLocation& varyingLoc, IndexedSemantic& semantic)
+{
+    /* For ESSL: "location" qualifier for varyings is only available since ESSL 310 */
+    if ( !IsESSL() || versionOut_ >= OutputShaderVersion::ESSL310 )
+    {
+        WriteLayout(
+            {
+                [&]() { Write("location = " + std::to_string(varyingLoc.location)); },
+                [&]()
+                {
+                    if (varyingLoc.component > 0)
+                        Write("component = " + std::to_string(varyingLoc.component));
+                },
+            }
+        );
+
+        /* Reset the semantic index for code reflection output */
+        semantic.ResetIndex(varyingLoc.location);
+    }
+}
+
 /* ----- Input semantics ----- */
 
 void GLSLGenerator::WriteLocalInputSemantics(FunctionDecl* entryPoint)
@@ -1785,7 +2015,11 @@ void GLSLGenerator::WriteGlobalInputSemanticsVarDecl(VarDecl* varDecl)
     {
         const auto& interpModifiers = varDecl->declStmntRef->typeSpecifier->interpModifiers;
 
-        if (IsGLSL120OrESSL100())
+        if (varDecl->flags(VarDecl::isUnlinkedVarying))
+        {
+            /* Write input, which is not passed from the previous shader stage, as private variable (see VaryingLinker) */
+        }
+        else if (IsGLSL120OrESSL100())
         {
             if (WarnEnabled(Warnings::Basic) && !interpModifiers.empty())
                 Warning(R_InterpModNotSupportedForGLSL120, varDecl);
@@ -1801,7 +2035,12 @@ void GLSLGenerator::WriteGlobalInputSemanticsVarDecl(VarDecl* varDecl)
             WriteInterpModifiers(interpModifiers, varDecl->declStmntRef);
             Separator();
 
-            if ( ( !IsESSL() && explicitBinding_ ) || ( IsESSL() && IsVertexShader() ) )
+            if (auto varyingLoc = FindLinkedVarying(varDecl->semantic, true))
+            {
+                /* Write layout location of linked varying (see LinkShaderStages) */
+                WriteLayoutVaryingLocation(*varyingLoc, varDecl->semantic);
+            }
+            else if ( ( !IsESSL() && explicitBinding_ ) || ( IsESSL() && IsVertexShader() ) )
             {
                 /* Get slot index */
                 int location = -1;
@@ -1945,7 +2184,11 @@ void GLSLGenerator::WriteGlobalOutputSemanticsSlot(TypeSpecifier* typeSpecifier,
     {
         VarDeclStmnt* varDeclStmnt = (varDecl != nullptr ? varDecl->declStmntRef : nullptr);
 
-        if (IsGLSL120OrESSL100())
+        if (varDecl != nullptr && varDecl->flags(VarDecl::isUnlinkedVarying))
+        {
+            /* Write output, which is not passed to the next shader stage, as private variable (see VaryingLinker) */
+        }
+        else if (IsGLSL120OrESSL100())
         {
             if (WarnEnabled(Warnings::Basic) && varDeclStmnt && !varDeclStmnt->typeSpecifier->interpModifiers.empty())
                 Warning(R_InterpModNotSupportedForGLSL120, varDecl);
@@ -1959,7 +2202,12 @@ void GLSLGenerator::WriteGlobalOutputSemanticsSlot(TypeSpecifier* typeSpecifier,
                 WriteInterpModifiers(varDeclStmnt->typeSpecifier->interpModifiers, varDecl);
             Separator();
 
-            if ( ( !IsESSL() && explicitBinding_ ) || ( IsESSL() && IsFragmentShader() ) )
+            if (auto varyingLoc = FindLinkedVarying(semantic, false))
+            {
+                /* Write layout location of linked varying (see LinkShaderStages) */
+                WriteLayoutVaryingLocation(*varyingLoc, semantic);
+            }
+            else if ( ( !IsESSL() && explicitBinding_ ) || ( IsESSL() && IsFragmentShader() ) )
             {
                 /* Get slot index: directly for fragment output, and automatically otherwise */
                 int location = -1;
@@ -2165,6 +2413,234 @@ void GLSLGenerator::WriteVarDeclIdentOrSystemValue(VarDecl* varDecl, int arrayIn
     }
 }
 
+/* ----- Buffer layout ----- */
+
+// Base alignment and size (in bytes) of a type with the std140 layout rules.
+struct Std140Layout
+{
+    unsigned int alignment;
+    unsigned int size;
+};
+
+static unsigned int AlignStd140Offset(unsigned int offset, unsigned int alignment)
+{
+    return (offset + RemainingVectorSize(offset, alignment));
+}
+
+// Returns the matrix storage layout of the specified type specifier, or the specified default layout.
+static TypeModifier GetMatrixStorageLayout(const TypeSpecifier& typeSpecifier, const TypeModifier defaultLayout)
+{
+    const auto& typeModifiers = typeSpecifier.typeModifiers;
+    if (typeModifiers.find(TypeModifier::RowMajor) != typeModifiers.end())
+        return TypeModifier::RowMajor;
+    if (typeModifiers.find(TypeModifier::ColumnMajor) != typeModifiers.end())
+        return TypeModifier::ColumnMajor;
+    return defaultLayout;
+}
+
+static bool GetStd140Layout(const TypeDenoter& typeDen, const TypeModifier matrixLayout, Std140Layout& layout);
+
+static bool GetStd140LayoutOfStruct(const StructDecl& structDecl, const TypeModifier matrixLayout, Std140Layout& layout)
+{
+    unsigned int size = 0, padding = 0, std140Size = 0;
+
+    layout.alignment = 16;
+
+    for (const auto& varDeclStmnt : structDecl.varMembers)
+    {
+        const auto memberMatrixLayout = GetMatrixStorageLayout(*varDeclStmnt->typeSpecifier, matrixLayout);
+
+        for (const auto& varDecl : varDeclStmnt->varDecls)
+        {
+            unsigned int offset = 0;
+            Std140Layout memberLayout;
+
+            if ( !varDecl->AccumAlignedVectorSize(size, padding, &offset) ||
+                 !GetStd140Layout(varDecl->GetTypeDenoter()->GetAliased(), memberMatrixLayout, memberLayout) )
+            {
+                return false;
+            }
+
+            /* Structure members can not have explicit offsets, so they must be equal with both packing rules */
+            if (offset != AlignStd140Offset(std140Size, memberLayout.alignment))
+                return false;
+
+            std140Size          = offset + memberLayout.size;
+            layout.alignment    = std::max(layout.alignment, memberLayout.alignment);
+        }
+    }
+
+    layout.size = AlignStd140Offset(std140Size, layout.alignment);
+
+    return true;
+}
+
+// Determines the std140 layout of the specified type, and returns false if its memory layout differs from the HLSL packing rules (regardless of its offset).
+static bool GetStd140Layout(const TypeDenoter& typeDen, const TypeModifier matrixLayout, Std140Layout& layout)
+{
+    if (auto baseTypeDen = typeDen.As<BaseTypeDenoter>())
+    {
+        const auto dataType         = baseTypeDen->dataType;
+        const auto componentSize    = (IsDoubleRealType(dataType) ? 8u : 4u);
+
+        if (IsScalarType(dataType) || IsVectorType(dataType))
+        {
+            /* Scalars and vectors are aligned to their size, except 3D vectors which are aligned like 4D vectors */
+            const auto dim = static_cast<unsigned int>(VectorTypeDim(dataType));
+            layout.alignment    = componentSize * (dim == 3 ? 4u : dim);
+            layout.size         = componentSize * dim;
+        }
+        else if (IsMatrixType(dataType))
+        {
+            /* Matrices are stored like arrays of column vectors (or row vectors), but the HLSL packing rules store them without padding */
+            auto dim = MatrixTypeDim(dataType);
+            if (matrixLayout == TypeModifier::RowMajor)
+                std::swap(dim.first, dim.second);
+
+            const auto numVectors       = static_cast<unsigned int>(dim.first);
+            const auto numComponents    = static_cast<unsigned int>(dim.second);
+
+            layout.alignment    = AlignStd140Offset(componentSize * (numComponents == 3 ? 4u : numComponents), 16u);
+            layout.size         = layout.alignment * numVectors;
+        }
+        else
+            return false;
+
+        /* Size must be equal to the HLSL packing rules (e.g. 'bool' and 'half' differ) */
+        return (layout.size == DataTypeSize(dataType));
+    }
+
+    if (auto structTypeDen = typeDen.As<StructTypeDenoter>())
+    {
+        if (auto structDecl = structTypeDen->structDeclRef)
+            return GetStd140LayoutOfStruct(*structDecl, matrixLayout, layout);
+        return false;
+    }
+
+    if (auto arrayTypeDen = typeDen.As<ArrayTypeDenoter>())
+    {
+        /* Array elements are aligned to 16 bytes with both packing rules */
+        Std140Layout elementLayout;
+        if (!GetStd140Layout(arrayTypeDen->subTypeDenoter->GetAliased(), matrixLayout, elementLayout))
+            return false;
+
+        unsigned int numElements = 1;
+        for (auto dimSize : arrayTypeDen->GetDimensionSizes())
+        {
+            if (dimSize > 0)
+                numElements *= static_cast<unsigned int>(dimSize);
+            else
+                return false;
+        }
+
+        layout.alignment    = AlignStd140Offset(elementLayout.alignment, 16u);
+        layout.size         = AlignStd140Offset(elementLayout.size, layout.alignment) * numElements;
+
+        return true;
+    }
+
+    return false;
+}
+
+void GLSLGenerator::DetermineBufferMemberLayouts(UniformBufferDecl& uniformBufferDecl)
+{
+    const auto commonStorageLayout = uniformBufferDecl.DeriveCommonStorageLayout();
+
+    unsigned int size = 0, padding = 0, std140Size = 0;
+
+    for (std::size_t i = 0; i < uniformBufferDecl.varMembers.size(); ++i)
+    {
+        const auto& varDeclStmnt = uniformBufferDecl.varMembers[i];
+        const auto matrixLayout = GetMatrixStorageLayout(*varDeclStmnt->typeSpecifier, commonStorageLayout);
+
+        /* Start each merged constant buffer at a 16 byte boundary */
+        uniformBufferDecl.AccumMergedBufferPadding(i, size, padding);
+
+        for (const auto& varDecl : varDeclStmnt->varDecls)
+        {
+            /* Determine member offset with the HLSL packing rules (same as in the code reflection) */
+            unsigned int offset = 0;
+            Std140Layout layout;
+
+            if ( !varDecl->AccumAlignedVectorSize(size, padding, &offset) ||
+                 !GetStd140Layout(varDecl->GetTypeDenoter()->GetAliased(), matrixLayout, layout) )
+            {
+                Error(R_CantMatchBufferMemberLayout(varDecl->ident, uniformBufferDecl.ident), varDecl.get());
+            }
+
+            /* Members which are not written are covered by the padding of the next member */
+            if (!varDeclStmnt->flags(AST::isReachable))
+                continue;
+
+            /* Offsets can only be moved forward, and they must satisfy the std140 alignment */
+            if (offset < std140Size || offset % layout.alignment != 0)
+                Error(R_CantMatchBufferMemberLayout(varDecl->ident, uniformBufferDecl.ident), varDecl.get());
+
+            BufferMemberLayout memberLayout;
+            {
+                memberLayout.offset         = offset;
+                memberLayout.paddingOffset  = std140Size;
+                memberLayout.paddingSize    = (offset > AlignStd140Offset(std140Size, layout.alignment) ? offset - std140Size : 0);
+            }
+
+            if (IsVKSL() || memberLayout.paddingSize > 0)
+                bufferMemberLayouts_[varDecl.get()] = memberLayout;
+
+            std140Size = offset + layout.size;
+        }
+    }
+}
+
+bool GLSLGenerator::HasBufferMemberLayout(const std::vector<VarDeclPtr>& varDecls) const
+{
+    return std::any_of(
+        varDecls.begin(), varDecls.end(),
+        [this](const VarDeclPtr& varDecl)
+        {
+            return (bufferMemberLayouts_.find(varDecl.get()) != bufferMemberLayouts_.end());
+        }
+    );
+}
+
+void GLSLGenerator::WriteBufferMemberPadding(unsigned int offset, unsigned int size)
+{
+    const auto end = offset + size;
+
+    while (offset < end)
+    {
+        const auto ident = nameMangling_.temporaryPrefix + "padding" + std::to_string(paddingCounter_++);
+
+        BeginLn();
+        {
+            Separator();
+            Separator();
+            Separator();
+
+            if (offset % 16 == 0 && end - offset >= 16)
+            {
+                /* Fill up entire 16 byte rows with 4D vectors */
+                const auto numRows = (end - offset) / 16;
+
+                Write("vec4 ");
+                Separator();
+                Write(ident + (numRows > 1 ? "[" + std::to_string(numRows) + "]" : "") + ";");
+
+                offset += numRows * 16;
+            }
+            else
+            {
+                /* Fill up partial 16 byte rows with scalars */
+                Write("float ");
+                Separator();
+                Write(ident + ";");
+
+                offset += 4;
+            }
+        }
+        EndLn();
+    }
+}
+
 /* ----- Object expression ----- */
 
 void GLSLGenerator::WriteObjectExpr(const ObjectExpr& objectExpr)
@@ -2755,6 +3231,43 @@ void GLSLGenerator::WriteCallExprIntrinsicClip(CallExpr* funcCall)
     DecIndent();
 }
 
+void GLSLGenerator::WriteCallExprIntrinsicLit(CallExpr* funcCall)
+{
+    AssertIntrinsicNumArgs(funcCall, 3, 3);
+
+    /* Writes the specified argument as operand of a multiplication */
+    auto WriteFactor = [this](const ExprPtr& expr)
+    {
+        if (expr->Type() == AST::Types::BinaryExpr || expr->Type() == AST::Types::TernaryExpr || expr->Type() == AST::Types::AssignExpr)
+        {
+            Write("(");
+            Visit(expr);
+            Write(")");
+        }
+        else
+            Visit(expr);
+    };
+
+    const auto& args = funcCall->arguments;
+
+    /* Convert to: 'vec4(1, max(0, N_DOT_L), max(0, N_DOT_H * M), 1)' */
+    Write("vec4(");
+    WriteLiteral("1", DataType::Float, funcCall);
+    Write(", max(");
+    WriteLiteral("0", DataType::Float, funcCall);
+    Write(", ");
+    Visit(args[0]);
+    Write("), max(");
+    WriteLiteral("0", DataType::Float, funcCall);
+    Write(", ");
+    WriteFactor(args[1]);
+    Write(" * ");
+    WriteFactor(args[2]);
+    Write("), ");
+    WriteLiteral("1", DataType::Float, funcCall);
+    Write(")");
+}
+
 void GLSLGenerator::WriteCallExprIntrinsicAtomic(CallExpr* callExpr)
 {
     AssertIntrinsicNumArgs(callExpr, 2, 3);
@@ -97,6 +97,12 @@ class GLSLGenerator : public Generator
         // Attempts to find an empty binding location for the specified type, or returns -1 if it cannot find one. 
         int GetBindingLocation(const TypeDenoter* typeDenoter, bool input);
 
+        // Stores the locations of the specified varying layout in the specified map (see LinkShaderStages).
+        void StoreLinkedVaryings(const VaryingLayout& layout, std::map<CiString, VaryingLocation>& varyingsMap);
+
+        // Returns the location of the linked input or output varying with the specified semantic, or null if there is no such varying.
+        const VaryingLocation* FindLinkedVarying(const IndexedSemantic& semantic, bool input) const;
+
         /* --- Visitor implementation --- */
 
         DECL_VISIT_PROC( Program           );
@@ -157,6 +163,9 @@ class GLSLGenerator : public Generator
         void PreProcessReferenceAnalyzer(const ShaderInput& inputDesc);
         void PreProcessExprConverterSecondary();
         void PreProcessPackedUniforms();
+        void PreProcessBufferLayouts();
+        void PreProcessBindingAllocator();
+        void PreProcessPrecisionAnalyzer(const ShaderOutput& outputDesc);
 
         /* ----- Basics ----- */
 
@@ -188,6 +197,10 @@ class GLSLGenerator : public Generator
         void WriteBuiltinBlockRedeclarations();
         void WriteBuiltinBlockRedeclarationsPerVertex(bool input, const std::string& name = "");
 
+        /* ----- Variable declaration ----- */
+
+        void WriteVarDeclStmnt(VarDeclStmnt* ast, const std::vector<VarDeclPtr>& varDecls);
+
         /* ----- Layout ----- */
 
         void WriteLayout(const std::initializer_list<LayoutEntryFunctor>& entryFunctors);
@@ -197,6 +210,8 @@ class GLSLGenerator : public Generator
         void WriteLayoutGlobalOut(const std::initializer_list<LayoutEntryFunctor>& entryFunctors, const LayoutEntryFunctor& varFunctor = nullptr);
         void WriteLayoutBinding(const std::vector<RegisterPtr>& slotRegisters);
         void WriteLayoutBindingOrLocation(const std::vector<RegisterPtr>& slotRegisters);
+        void WriteLayoutBindingSlot(const Register& slotRegister);
+        void WriteLayoutVaryingLocation(const VaryingLocation& varyingLoc, IndexedSemantic& semantic);
 
         /* ----- Input semantics ----- */
 
@@ -226,6 +241,17 @@ class GLSLGenerator : public Generator
         void WriteGlobalUniforms();
         void WriteGlobalUniformsParameter(VarDeclStmnt* param);
 
+        /* ----- Buffer layout ----- */
+
+        // Determines the offsets and paddings of the members in the specified constant buffer to match the HLSL packing rules.
+        void DetermineBufferMemberLayouts(UniformBufferDecl& uniformBufferDecl);
+
+        // Returns true if any of the specified variables has an explicit buffer member layout.
+        bool HasBufferMemberLayout(const std::vector<VarDeclPtr>& varDecls) const;
+
+        // Writes padding members for the specified range (in bytes) of a uniform buffer.
+        void WriteBufferMemberPadding(unsigned int offset, unsigned int size);
+
         // Writes the specified variable identifier or a system value if the identifier has a system value semantic.
         void WriteVarDeclIdentOrSystemValue(VarDecl* varDecl, int arrayIndex = -1);
 
@@ -267,6 +293,7 @@ class GLSLGenerator : public Generator
         void WriteCallExprIntrinsicMul(CallExpr* callExpr);
         void WriteCallExprIntrinsicRcp(CallExpr* callExpr);
         void WriteCallExprIntrinsicClip(CallExpr* callExpr);
+        void WriteCallExprIntrinsicLit(CallExpr* callExpr);
         void WriteCallExprIntrinsicAtomic(CallExpr* callExpr);
         void WriteCallExprIntrinsicAtomicCompSwap(CallExpr* callExpr);
         void WriteCallExprIntrinsicImageAtomic(CallExpr* callExpr);
@@ -322,11 +349,25 @@ class GLSLGenerator : public Generator
             bool    found;
         };
 
+        // Explicit layout of a constant buffer member to match the HLSL packing rules.
+        struct BufferMemberLayout
+        {
+            unsigned int    offset;         // Byte offset of the member (only written for VKSL output).
+            unsigned int    paddingOffset;  // Byte offset of the padding in front of the member.
+            unsigned int    paddingSize;    // Size (in bytes) of the padding in front of the member (only written for GLSL output).
+        };
+
         OutputShaderVersion                     versionOut_             = OutputShaderVersion::GLSL;
         NameMangling                            nameMangling_;
         std::map<CiString, VertexSemanticLoc>   vertexSemanticsMap_;
+        std::map<CiString, VaryingLocation>     inputVaryingsMap_;
+        std::map<CiString, VaryingLocation>     outputVaryingsMap_;
         UniformPacking                          uniformPacking_;
+        BufferMerging                           bufferMerging_;
+        BindingLayout                           bindingLayout_;
         std::string                             entryPointName_;
+        std::map<const VarDecl*, BufferMemberLayout> bufferMemberLayouts_;
+        unsigned int                            paddingCounter_         = 0;
 
         bool                                    allowExtensions_        = false;
         bool                                    explicitBinding_        = false;
@@ -336,8 +377,12 @@ class GLSLGenerator : public Generator
         bool                                    alwaysBracedScopes_     = false;
         bool                                    separateShaders_        = false;
         bool                                    separateSamplers_       = true;
+        bool                                    reorderUniforms_        = false;
+        bool                                    matchBufferLayout_      = false;
         bool                                    autoBinding_            = false;
         bool                                    writeHeaderComment_     = true;
+        bool                                    linkedVaryings_         = false;
+        bool                                    packedVaryings_         = false;
 
         std::set<int>                           usedInLocationsSet_;
         std::set<int>                           usedOutLocationsSet_;
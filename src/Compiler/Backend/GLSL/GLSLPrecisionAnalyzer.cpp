@@ -0,0 +1,372 @@
+/*
+ * GLSLPrecisionAnalyzer.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLSLPrecisionAnalyzer.h"
+#include "AST.h"
+#include "CiString.h"
+#include <algorithm>
+
+
+namespace Xsc
+{
+
+
+void GLSLPrecisionAnalyzer::MarkPrecisions(Program& program, const PrecisionPolicy& policy)
+{
+    /* Store parameters */
+    policy_ = (&policy);
+
+    /* Collect variable precisions and local variable sources */
+    Visit(&program);
+
+    /* Infer precision of local variables, and mark all type specifiers */
+    if (policy.inferLocals)
+        InferLocalPrecisions();
+
+    ApplyPrecisions();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+// Returns the floating-point base data type of the specified type denoter (also for arrays), or DataType::Undefined.
+static DataType RealBaseDataType(const TypeDenoter& typeDen)
+{
+    const auto& aliasedTypeDen = typeDen.GetAliased();
+
+    if (auto arrayTypeDen = aliasedTypeDen.As<ArrayTypeDenoter>())
+        return RealBaseDataType(*arrayTypeDen->subTypeDenoter);
+
+    if (auto baseTypeDen = aliasedTypeDen.As<BaseTypeDenoter>())
+    {
+        if (IsRealType(baseTypeDen->dataType))
+            return baseTypeDen->dataType;
+    }
+
+    return DataType::Undefined;
+}
+
+// Returns all names the specified semantic can be referred to in the precision policy (without index).
+static std::vector<CiString> GetSemanticNames(const IndexedSemantic& semantic)
+{
+    std::vector<CiString> names;
+
+    if (semantic.IsUserDefined())
+    {
+        /* Remove index from user defined semantic */
+        auto s = semantic.ToString();
+        s.resize(s.size() - std::to_string(semantic.Index()).size());
+        names.push_back(ToCiString(s));
+    }
+    else
+    {
+        names.push_back(ToCiString(SemanticToString(semantic)));
+
+        /* Append legacy names of system value semantics */
+        switch (semantic)
+        {
+            case Semantic::Target:
+                names.push_back("COLOR");
+                break;
+            case Semantic::VertexPosition:
+            case Semantic::FragCoord:
+                names.push_back("SV_Position");
+                names.push_back("POSITION");
+                break;
+            case Semantic::Depth:
+            case Semantic::DepthGreaterEqual:
+            case Semantic::DepthLessEqual:
+                names.push_back("SV_Depth");
+                names.push_back("DEPTH");
+                break;
+            default:
+                break;
+        }
+    }
+
+    return names;
+}
+
+// Returns true if any of the specified semantic names is contained in the specified list.
+static bool ContainsSemantic(const std::vector<std::string>& list, const std::vector<CiString>& names)
+{
+    for (const auto& entry : list)
+    {
+        if (std::find(names.begin(), names.end(), ToCiString(entry)) != names.end())
+            return true;
+    }
+    return false;
+}
+
+GLSLPrecisionAnalyzer::Precision GLSLPrecisionAnalyzer::SemanticPrecision(const IndexedSemantic& semantic) const
+{
+    if (semantic.IsValid())
+    {
+        const auto names = GetSemanticNames(semantic);
+
+        /* High precision semantics take precedence over medium precision semantics */
+        if (ContainsSemantic(policy_->highSemantics, names))
+            return Precision::High;
+        if (ContainsSemantic(policy_->mediumSemantics, names))
+            return Precision::Medium;
+    }
+    return Precision::Undefined;
+}
+
+GLSLPrecisionAnalyzer::Precision GLSLPrecisionAnalyzer::VarDeclPrecision(VarDecl* varDecl) const
+{
+    /* Return precision determined by semantic */
+    auto it = varPrecisions_.find(varDecl);
+    if (it != varPrecisions_.end() && it->second != Precision::Undefined)
+        return it->second;
+
+    /* Return default precision of the data type */
+    if (IsHalfRealType(RealBaseDataType(*varDecl->GetTypeDenoter())))
+        return Precision::Medium;
+    else
+        return Precision::High;
+}
+
+void GLSLPrecisionAnalyzer::RegisterLocalVarDecl(VarDecl* varDecl)
+{
+    localSources_[varDecl] = LocalSources();
+}
+
+GLSLPrecisionAnalyzer::LocalSources* GLSLPrecisionAnalyzer::FetchLocalSources(VarDecl* varDecl)
+{
+    if (varDecl)
+    {
+        auto it = localSources_.find(varDecl);
+        if (it != localSources_.end())
+            return &(it->second);
+    }
+    return nullptr;
+}
+
+void GLSLPrecisionAnalyzer::InferLocalPrecisions()
+{
+    /*
+    A local variable is tainted if it is assigned from an unknown source or from a high precision variable,
+    and it is seeded if it is assigned from at least one medium precision variable.
+    Only seeded variables, that are not tainted, are qualified with medium precision.
+    Local variables that are only assigned from literals (e.g. loop counters) are neither seeded nor tainted,
+    so they keep the default precision, but they do not taint other variables.
+    */
+    std::set<VarDecl*> tainted, seeded;
+
+    for (bool changed = true; changed;)
+    {
+        changed = false;
+
+        for (const auto& entry : localSources_)
+        {
+            auto varDecl = entry.first;
+            const auto& sources = entry.second;
+
+            bool isTainted = (tainted.find(varDecl) != tainted.end());
+            bool isSeeded = (seeded.find(varDecl) != seeded.end());
+
+            if (sources.unknown)
+                isTainted = true;
+
+            for (auto sourceVarDecl : sources.varDecls)
+            {
+                if (sourceVarDecl == varDecl)
+                    continue;
+
+                if (localSources_.find(sourceVarDecl) != localSources_.end())
+                {
+                    /* Propagate state from other local variable */
+                    if (tainted.find(sourceVarDecl) != tainted.end())
+                        isTainted = true;
+                    if (seeded.find(sourceVarDecl) != seeded.end())
+                        isSeeded = true;
+                }
+                else if (VarDeclPrecision(sourceVarDecl) == Precision::Medium)
+                    isSeeded = true;
+                else
+                    isTainted = true;
+            }
+
+            if (isTainted && tainted.insert(varDecl).second)
+                changed = true;
+            if (isSeeded && seeded.insert(varDecl).second)
+                changed = true;
+        }
+    }
+
+    for (const auto& entry : localSources_)
+    {
+        auto varDecl = entry.first;
+        if (tainted.find(varDecl) == tainted.end() && seeded.find(varDecl) != seeded.end())
+            varPrecisions_[varDecl] = Precision::Medium;
+    }
+}
+
+void GLSLPrecisionAnalyzer::ApplyPrecisions()
+{
+    for (auto varDeclStmnt : varDeclStmnts_)
+    {
+        bool anyHigh = false, allMedium = true;
+
+        for (const auto& varDecl : varDeclStmnt->varDecls)
+        {
+            switch (VarDeclPrecision(varDecl.get()))
+            {
+                case Precision::High:
+                    anyHigh = true;
+                    allMedium = false;
+                    break;
+                case Precision::Medium:
+                    break;
+                default:
+                    allMedium = false;
+                    break;
+            }
+        }
+
+        /* Mark type specifier only if all variables of this statement agree on medium precision */
+        auto& typeSpecifier = varDeclStmnt->typeSpecifier;
+        if (anyHigh)
+            typeSpecifier->flags << TypeSpecifier::isHighPrecision;
+        else if (allMedium)
+            typeSpecifier->flags << TypeSpecifier::isMediumPrecision;
+    }
+}
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void GLSLPrecisionAnalyzer::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+IMPLEMENT_VISIT_PROC(FunctionDecl)
+{
+    /* Mark return type by the function semantic */
+    if (RealBaseDataType(*ast->returnType->typeDenoter) != DataType::Undefined)
+    {
+        switch (SemanticPrecision(ast->semantic))
+        {
+            case Precision::Medium:
+                ast->returnType->flags << TypeSpecifier::isMediumPrecision;
+                break;
+            case Precision::High:
+                ast->returnType->flags << TypeSpecifier::isHighPrecision;
+                break;
+            default:
+                break;
+        }
+    }
+
+    PushFunctionDecl(ast);
+    {
+        VISIT_DEFAULT(FunctionDecl);
+    }
+    PopFunctionDecl();
+}
+
+IMPLEMENT_VISIT_PROC(VarDeclStmnt)
+{
+    if (!ast->typeSpecifier->structDecl && RealBaseDataType(*ast->typeSpecifier->typeDenoter) != DataType::Undefined)
+        varDeclStmnts_.push_back(ast);
+
+    VISIT_DEFAULT(VarDeclStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(VarDecl)
+{
+    auto activeSources = activeSources_;
+    activeSources_ = nullptr;
+
+    const auto dataType = RealBaseDataType(*ast->GetTypeDenoter());
+    if (dataType != DataType::Undefined)
+    {
+        auto precision = SemanticPrecision(ast->semantic);
+        if (precision != Precision::Undefined)
+        {
+            /* Store precision determined by semantic */
+            varPrecisions_[ast] = precision;
+        }
+        else if (InsideFunctionDecl() && !IsHalfRealType(dataType) && !ast->structDeclRef)
+        {
+            /* Register non-static local variable to infer its precision by its sources */
+            auto declStmnt = ast->declStmntRef;
+            if (declStmnt && !declStmnt->flags(VarDeclStmnt::isParameter) && !ast->IsStatic())
+            {
+                RegisterLocalVarDecl(ast);
+                activeSources_ = FetchLocalSources(ast);
+            }
+        }
+    }
+
+    VISIT_DEFAULT(VarDecl);
+
+    activeSources_ = activeSources;
+}
+
+IMPLEMENT_VISIT_PROC(CallExpr)
+{
+    /* Precision of return values from other functions is unknown */
+    if (activeSources_ && ast->GetFunctionDecl() != nullptr)
+        activeSources_->unknown = true;
+
+    /* Mark all local variables, that are assigned to output parameters, as unknown */
+    ast->ForEachOutputArgument(
+        [this](ExprPtr& argExpr, VarDecl* /*param*/)
+        {
+            if (auto lvalueExpr = argExpr->FetchLValueExpr())
+            {
+                if (auto sources = FetchLocalSources(lvalueExpr->FetchVarDecl()))
+                    sources->unknown = true;
+            }
+        }
+    );
+
+    VISIT_DEFAULT(CallExpr);
+}
+
+IMPLEMENT_VISIT_PROC(AssignExpr)
+{
+    auto activeSources = activeSources_;
+
+    /* Visit l-value expression without sources */
+    activeSources_ = nullptr;
+    Visit(ast->lvalueExpr);
+
+    /* Visit r-value expression as source of the assigned local variable */
+    if (auto lvalueExpr = ast->lvalueExpr->FetchLValueExpr())
+        activeSources_ = FetchLocalSources(lvalueExpr->FetchVarDecl());
+
+    Visit(ast->rvalueExpr);
+
+    activeSources_ = activeSources;
+}
+
+IMPLEMENT_VISIT_PROC(ObjectExpr)
+{
+    /* Add referenced floating-point variable to the active sources */
+    if (activeSources_)
+    {
+        if (auto varDecl = ast->FetchVarDecl())
+        {
+            if (RealBaseDataType(*varDecl->GetTypeDenoter()) != DataType::Undefined)
+                activeSources_->varDecls.insert(varDecl);
+        }
+    }
+
+    VISIT_DEFAULT(ObjectExpr);
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
@@ -0,0 +1,110 @@
+/*
+ * GLSLPrecisionAnalyzer.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_GLSL_PRECISION_ANALYZER_H
+#define XSC_GLSL_PRECISION_ANALYZER_H
+
+
+#include <Xsc/Xsc.h>
+#include "VisitorTracker.h"
+#include "ASTEnums.h"
+#include <map>
+#include <set>
+#include <vector>
+
+
+namespace Xsc
+{
+
+
+/*
+GLSL precision analyzer visitor. Infers the precision qualifiers of all floating-point variables for ESSL output.
+Variables with a semantic are qualified by the semantic lists of the precision policy (e.g. "COLOR" -> mediump, "POSITION" -> highp),
+and local variables are qualified with 'mediump' if they are only assigned from medium precision variables.
+The result is stored in the flags of the type specifiers (see TypeSpecifier::isMediumPrecision).
+*/
+class GLSLPrecisionAnalyzer : private VisitorTracker
+{
+
+    public:
+
+        // Marks the type specifiers of the specified program with the precision qualifiers inferred by the specified policy.
+        void MarkPrecisions(Program& program, const PrecisionPolicy& policy);
+
+    private:
+
+        enum class Precision
+        {
+            Undefined,
+            Medium,
+            High,
+        };
+
+        // Sources of a local variable, i.e. all variables it is assigned from.
+        struct LocalSources
+        {
+            bool                    unknown = false;    // Local variable is assigned from an unknown source (e.g. output argument of a function call).
+            std::set<VarDecl*>      varDecls;           // Floating-point variables the local variable is assigned from.
+        };
+
+        /* === Functions === */
+
+        // Returns the precision for the specified semantic by the precision policy.
+        Precision SemanticPrecision(const IndexedSemantic& semantic) const;
+
+        // Returns the precision of the specified variable, which is not a local variable.
+        Precision VarDeclPrecision(VarDecl* varDecl) const;
+
+        // Registers the specified variable declaration as local variable, whose precision is inferred by its sources.
+        void RegisterLocalVarDecl(VarDecl* varDecl);
+
+        // Returns the sources of the specified local variable, or null if the variable is not a registered local variable.
+        LocalSources* FetchLocalSources(VarDecl* varDecl);
+
+        // Infers the precision of all registered local variables by their sources.
+        void InferLocalPrecisions();
+
+        // Sets the precision flags of all type specifiers.
+        void ApplyPrecisions();
+
+        /* --- Visitor implementation --- */
+
+        DECL_VISIT_PROC( FunctionDecl );
+        DECL_VISIT_PROC( VarDeclStmnt );
+        DECL_VISIT_PROC( VarDecl      );
+
+        DECL_VISIT_PROC( CallExpr     );
+        DECL_VISIT_PROC( AssignExpr   );
+        DECL_VISIT_PROC( ObjectExpr   );
+
+        /* === Members === */
+
+        const PrecisionPolicy*              policy_         = nullptr;
+
+        // Precision of all variables, that has been determined by their semantic.
+        std::map<VarDecl*, Precision>       varPrecisions_;
+
+        // Sources of all local floating-point variables.
+        std::map<VarDecl*, LocalSources>    localSources_;
+
+        // Active local variable sources, while an initializer or the right-hand-side of an assignment is visited.
+        LocalSources*                       activeSources_  = nullptr;
+
+        // All variable declaration statements with a floating-point type.
+        std::vector<VarDeclStmnt*>          varDeclStmnts_;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,57 @@
+/*
+ * CharClass.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CharClass.h"
+
+
+namespace Xsc
+{
+
+
+/* Short names to keep the table readable */
+#define B CharClass::Blank
+#define N CharClass::NewLine
+#define D CharClass::Digit
+#define H CharClass::HexDigit
+#define A CharClass::Alpha
+#define I CharClass::IdentHead
+#define T CharClass::IdentTail
+
+const unsigned char g_charClassTable[256] =
+{
+    0,       0,       0,       0,       0,       0,       0,       0,       0,       B,       N,       B,       B,       N,       0,       0,
+    0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,
+    B,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,
+    D|H|T,   D|H|T,   D|H|T,   D|H|T,   D|H|T,   D|H|T,   D|H|T,   D|H|T,   D|H|T,   D|H|T,   0,       0,       0,       0,       0,       0,
+    0,       H|A|I|T, H|A|I|T, H|A|I|T, H|A|I|T, H|A|I|T, H|A|I|T, A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,
+    A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   0,       0,       0,       0,       I|T,
+    0,       H|A|I|T, H|A|I|T, H|A|I|T, H|A|I|T, H|A|I|T, H|A|I|T, A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,
+    A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   A|I|T,   0,       0,       0,       0,       0,
+    0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,
+    0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,
+    0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,
+    0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,
+    0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,
+    0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,
+    0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,
+    0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,       0,
+};
+
+#undef B
+#undef N
+#undef D
+#undef H
+#undef A
+#undef I
+#undef T
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
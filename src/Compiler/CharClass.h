@@ -0,0 +1,53 @@
+/*
+ * CharClass.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_CHAR_CLASS_H
+#define XSC_CHAR_CLASS_H
+
+
+namespace Xsc
+{
+
+
+/*
+Character class flags for the table driven scanner loops.
+These classes are equivalent to the functions of <cctype> for the "C" locale, but without function call overhead.
+*/
+struct CharClass
+{
+    enum : unsigned char
+    {
+        Blank       = (1 << 0), // ' ', '\t', '\v', '\f'
+        NewLine     = (1 << 1), // '\n', '\r'
+        Digit       = (1 << 2), // '0'-'9'
+        HexDigit    = (1 << 3), // '0'-'9', 'a'-'f', 'A'-'F'
+        Alpha       = (1 << 4), // 'a'-'z', 'A'-'Z'
+        IdentHead   = (1 << 5), // 'a'-'z', 'A'-'Z', '_'
+        IdentTail   = (1 << 6), // 'a'-'z', 'A'-'Z', '0'-'9', '_'
+
+        Space       = (Blank | NewLine),
+    };
+};
+
+// Lookup table of the character classes for all 256 characters.
+extern const unsigned char g_charClassTable[256];
+
+// Returns true if the specified character belongs to any of the specified character classes (see CharClass).
+inline bool IsCharClass(char chr, unsigned char charClass)
+{
+    return ((g_charClassTable[static_cast<unsigned char>(chr)] & charClass) != 0);
+}
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
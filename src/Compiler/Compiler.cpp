@@ -8,10 +8,21 @@
 #include "Compiler.h"
 #include "ReportIdents.h"
 #include "Helper.h"
+#include "Profiler.h"
 
 #include "PreProcessor.h"
 #include "Optimizer.h"
+#include "FunctionInliner.h"
+#include "LoopUnroller.h"
+#include "DeadCodeEliminator.h"
+#include "CommonSubexprEliminator.h"
+#include "UniformSpecializer.h"
+#include "VaryingLinker.h"
 #include "ReflectionAnalyzer.h"
+#include "ReferenceAnalyzer.h"
+#include "AnonymousStructLabeler.h"
+#include "CostEstimator.h"
+#include "LivenessAnalyzer.h"
 #include "ASTPrinter.h"
 
 #include "GLSLPreProcessor.h"
@@ -39,7 +50,7 @@ bool Compiler::CompileShader(
     const ShaderInput&          inputDesc,
     const ShaderOutput&         outputDesc,
     Reflection::ReflectionData* reflectionData,
-    StageTimePoints*            stageTimePoints)
+    CompileStatistics*          statistics)
 {
     /* Make copy of output descriptor to support validation without output stream */
     std::stringstream dummyOutputStream;
@@ -59,12 +70,73 @@ bool Compiler::CompileShader(
     if (outputDescCopy.options.autoBinding)
         outputDescCopy.options.explicitBinding = true;
 
+    /* Implicitly enable 'explicitBinding' option if binding slots are compacted */
+    if (outputDescCopy.bindingLayout.enabled && IsLanguageVKSL(outputDescCopy.shaderVersion))
+        outputDescCopy.options.explicitBinding = true;
+
+    /* Collect compile statistics and trace events on this thread only if requested */
+    std::unique_ptr<Profiler> profiler;
+    if (statistics || outputDesc.traceRecorder)
+    {
+        if (statistics)
+            *statistics = CompileStatistics();
+        profiler = MakeUnique<Profiler>(statistics, outputDesc.traceRecorder, inputDesc.filename);
+    }
+
     /* Compile shader with primary function */
+    const auto startTime = Time::now();
+
     auto result = CompileShaderPrimary(inputDesc, outputDescCopy, reflectionData);
 
-    /* Copy time points to output */
-    if (stageTimePoints)
-        *stageTimePoints = timePoints_;
+    /* Compilation has finished before the AST is released, unless it has been aborted */
+    if (timePoints_.finished == TimePoint())
+        timePoints_.finished = Time::now();
+
+    if (profiler)
+    {
+        RecordStages(*profiler);
+        profiler->RecordEvent("CompileShader (" + inputDesc.entryPoint + ")", "compile", startTime, Time::now());
+    }
+
+    if (statistics)
+        statistics->peakMemory = Profiler::QueryPeakMemory();
+
+    return result;
+}
+
+bool Compiler::AnalyzeVaryings(
+    const ShaderInput&              inputDesc,
+    const ShaderOutput&             outputDesc,
+    VaryingLinker::ShaderInterface& shaderInterface)
+{
+    /* Make copy of output descriptor, since no output code is generated */
+    std::stringstream dummyOutputStream;
+
+    auto outputDescCopy = outputDesc;
+    {
+        outputDescCopy.sourceCode               = &dummyOutputStream;
+        outputDescCopy.options.preprocessOnly   = false;
+        outputDescCopy.options.showAST          = false;
+    }
+
+    /* Record trace events on this thread only if requested */
+    std::unique_ptr<Profiler> profiler;
+    if (outputDesc.traceRecorder)
+        profiler = MakeUnique<Profiler>(nullptr, outputDesc.traceRecorder, inputDesc.filename);
+
+    /* Compile shader with primary function until the varyings are collected */
+    const auto startTime = Time::now();
+
+    shaderInterface_ = (&shaderInterface);
+    auto result = CompileShaderPrimary(inputDesc, outputDescCopy, nullptr);
+    shaderInterface_ = nullptr;
+
+    if (profiler)
+    {
+        timePoints_.finished = Time::now();
+        RecordStages(*profiler);
+        profiler->RecordEvent("AnalyzeVaryings (" + inputDesc.entryPoint + ")", "compile", startTime, Time::now());
+    }
 
     return result;
 }
@@ -132,6 +204,65 @@ void Compiler::ValidateArguments(const ShaderInput& inputDesc, const ShaderOutpu
     #endif
 }
 
+void Compiler::RecordStages(Profiler& profiler) const
+{
+    /* Each stage ends with the beginning of the next stage that has been reached */
+    const TimePoint* timePoints[] =
+    {
+        &timePoints_.preprocessor,
+        &timePoints_.parser,
+        &timePoints_.analyzer,
+        &timePoints_.optimizer,
+        &timePoints_.generation,
+        &timePoints_.reflection,
+        &timePoints_.finished,
+    };
+
+    const char* stageNames[] =
+    {
+        "Pre-Processing",
+        "Parsing",
+        "Context Analysis",
+        "Optimization",
+        "Code Generation",
+        "Code Reflection",
+    };
+
+    auto statistics = profiler.GetStatistics();
+
+    std::uint64_t* durations[] =
+    {
+        (statistics ? &(statistics->preProcessingTime) : nullptr),
+        (statistics ? &(statistics->parsingTime      ) : nullptr),
+        (statistics ? &(statistics->analysisTime     ) : nullptr),
+        (statistics ? &(statistics->optimizationTime ) : nullptr),
+        (statistics ? &(statistics->generationTime   ) : nullptr),
+        (statistics ? &(statistics->reflectionTime   ) : nullptr),
+    };
+
+    for (std::size_t i = 0; i < sizeof(stageNames)/sizeof(stageNames[0]); ++i)
+    {
+        const auto& startTime = *timePoints[i];
+        if (startTime == TimePoint())
+            continue;
+
+        for (std::size_t j = i + 1; j < sizeof(timePoints)/sizeof(timePoints[0]); ++j)
+        {
+            const auto& endTime = *timePoints[j];
+            if (endTime != TimePoint())
+            {
+                if (endTime > startTime)
+                {
+                    if (durations[i])
+                        *durations[i] = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count());
+                    profiler.RecordEvent(stageNames[i], "stage", startTime, endTime);
+                }
+                break;
+            }
+        }
+    }
+}
+
 bool Compiler::CompileShaderPrimary(
     const ShaderInput&          inputDesc,
     const ShaderOutput&         outputDesc,
@@ -169,7 +300,11 @@ bool Compiler::CompileShaderPrimary(
     );
 
     if (reflectionData)
-        reflectionData->macros = preProcessor->ListDefinedMacroIdents();
+    {
+        reflectionData->macros          = preProcessor->ListDefinedMacroIdents();
+        reflectionData->usedMacros      = preProcessor->ListUsedMacroIdents();
+        reflectionData->includeFiles    = preProcessor->GetIncludeFiles();
+    }
 
     if (!processedInput)
         return ReturnWithError(R_PreProcessingSourceFailed);
@@ -250,27 +385,106 @@ bool Compiler::CompileShaderPrimary(
     /* Optimize AST */
     timePoints_.optimizer = Time::now();
 
+    if (!outputDesc.uniformValues.empty())
+    {
+        /* Replace uniforms with known values by constants */
+        Profiler::ScopedPass pass { "UniformSpecializer" };
+        UniformSpecializer uniformSpecializer;
+        for (const auto& ident : uniformSpecializer.Specialize(*program, outputDesc.uniformValues, outputDesc.nameMangling))
+            Warning(R_CantSpecializeUniform(ident));
+    }
+
+    if (!shaderInterface_ && (outputDesc.inputVaryings.enabled || outputDesc.outputVaryings.enabled))
+    {
+        /* Remove varyings that are not linked with the adjacent shader stages (before the optimizer removes their computation) */
+        Profiler::ScopedPass pass { "VaryingLinker" };
+        VaryingLinker varyingLinker;
+        if (outputDesc.inputVaryings.enabled)
+            varyingLinker.EliminateInputs(*program, inputDesc.shaderTarget, outputDesc.inputVaryings);
+        if (outputDesc.outputVaryings.enabled)
+            varyingLinker.EliminateOutputs(*program, inputDesc.shaderTarget, outputDesc.outputVaryings);
+    }
+
     if (outputDesc.options.optimize)
     {
+        {
+            Profiler::ScopedPass pass { "FunctionInliner" };
+            FunctionInliner functionInliner;
+            functionInliner.InlineFunctions(*program, outputDesc.nameMangling);
+        }
+        {
+            Profiler::ScopedPass pass { "LoopUnroller" };
+            LoopUnroller loopUnroller;
+            loopUnroller.UnrollLoops(*program);
+        }
+        {
+            Profiler::ScopedPass pass { "Optimizer" };
+            Optimizer optimizer;
+            optimizer.Optimize(*program);
+        }
+        {
+            Profiler::ScopedPass pass { "DeadCodeEliminator" };
+            DeadCodeEliminator deadCodeEliminator;
+            deadCodeEliminator.EliminateDeadCode(*program);
+        }
+        {
+            Profiler::ScopedPass pass { "CommonSubexprEliminator" };
+            CommonSubexprEliminator commonSubexprEliminator;
+            commonSubexprEliminator.EliminateCommonSubexprs(*program, outputDesc.nameMangling);
+        }
+    }
+    else if (!outputDesc.uniformValues.empty())
+    {
+        /* Fold specialized uniforms and remove dead branches */
+        Profiler::ScopedPass pass { "Optimizer" };
         Optimizer optimizer;
         optimizer.Optimize(*program);
     }
 
+    if (shaderInterface_)
+    {
+        /* Only collect the varyings of the entry point (see LinkShaderStages) */
+        {
+            Profiler::ScopedPass pass { "VaryingLinker" };
+            VaryingLinker varyingLinker;
+            varyingLinker.CollectVaryings(*program, inputDesc.shaderTarget, *shaderInterface_);
+        }
+        return true;
+    }
+
     /* ----- Code generation ----- */
 
     timePoints_.generation = Time::now();
 
-    bool generatorResult = false;
-
-    if (IsLanguageGLSL(outputDesc.shaderVersion) || IsLanguageESSL(outputDesc.shaderVersion) || IsLanguageVKSL(outputDesc.shaderVersion))
+    if (outputDesc.options.reflectOnly)
     {
-        /* Generate GLSL output code */
-        GLSLGenerator generator(log_);
-        generatorResult = generator.GenerateCode(*program, inputDesc, outputDesc, log_);
+        /* Only mark all reachable AST nodes for the code reflection (code conversion and generation are skipped) */
+        {
+            Profiler::ScopedPass pass { "ReferenceAnalyzer" };
+            ReferenceAnalyzer refAnalyzer;
+            refAnalyzer.MarkReferencesFromEntryPoint(*program, inputDesc.shaderTarget);
+        }
+        {
+            /* Name anonymous structures as the code converter would do */
+            Profiler::ScopedPass pass { "AnonymousStructLabeler" };
+            AnonymousStructLabeler anonymStructLabeler;
+            anonymStructLabeler.LabelAnonymousStructs(*program, outputDesc.nameMangling);
+        }
     }
+    else
+    {
+        bool generatorResult = false;
+
+        if (IsLanguageGLSL(outputDesc.shaderVersion) || IsLanguageESSL(outputDesc.shaderVersion) || IsLanguageVKSL(outputDesc.shaderVersion))
+        {
+            /* Generate GLSL output code */
+            GLSLGenerator generator(log_);
+            generatorResult = generator.GenerateCode(*program, inputDesc, outputDesc, log_);
+        }
 
-    if (!generatorResult)
-        return ReturnWithError(R_GeneratingOutputCodeFailed);
+        if (!generatorResult)
+            return ReturnWithError(R_GeneratingOutputCodeFailed);
+    }
 
     /* ----- Code reflection ----- */
 
@@ -278,13 +492,28 @@ bool Compiler::CompileShaderPrimary(
 
     if (reflectionData)
     {
-        ReflectionAnalyzer reflectAnalyzer(log_);
-        reflectAnalyzer.Reflect(
-            *program, inputDesc.shaderTarget, *reflectionData,
-            ((inputDesc.warnings & Warnings::CodeReflection) != 0)
-        );
+        {
+            Profiler::ScopedPass pass { "ReflectionAnalyzer" };
+            ReflectionAnalyzer reflectAnalyzer(log_);
+            reflectAnalyzer.Reflect(
+                *program, inputDesc.shaderTarget, *reflectionData,
+                ((inputDesc.warnings & Warnings::CodeReflection) != 0)
+            );
+        }
+        {
+            Profiler::ScopedPass pass { "CostEstimator" };
+            CostEstimator costEstimator;
+            costEstimator.EstimateCost(*program, inputDesc.shaderTarget, reflectionData->cost);
+        }
+        {
+            Profiler::ScopedPass pass { "LivenessAnalyzer" };
+            LivenessAnalyzer livenessAnalyzer;
+            livenessAnalyzer.AnalyzeLiveness(*program, reflectionData->registerPressure);
+        }
     }
 
+    timePoints_.finished = Time::now();
+
     return true;
 }
 
@@ -10,6 +10,7 @@
 
 
 #include <Xsc/Xsc.h>
+#include "VaryingLinker.h"
 #include <chrono>
 #include <array>
 
@@ -18,14 +19,16 @@ namespace Xsc
 {
 
 
+class Profiler;
+
 // Compiler driver class.
 class Compiler
 {
 
     public:
 
-        using Time      = std::chrono::system_clock;
-        using TimePoint = std::chrono::time_point<std::chrono::system_clock>;
+        using Time      = std::chrono::steady_clock;
+        using TimePoint = Time::time_point;
 
         // Time points of all compiler stages.
         struct StageTimePoints
@@ -36,6 +39,7 @@ class Compiler
             TimePoint optimizer;
             TimePoint generation;
             TimePoint reflection;
+            TimePoint finished;
         };
 
         Compiler(Log* log = nullptr);
@@ -44,7 +48,14 @@ class Compiler
             const ShaderInput&          inputDesc,
             const ShaderOutput&         outputDesc,
             Reflection::ReflectionData* reflectionData  = nullptr,
-            StageTimePoints*            stageTimePoints = nullptr
+            CompileStatistics*          statistics      = nullptr
+        );
+
+        // Analyzes the shader without generating output code, and returns the user-defined varyings of its entry point.
+        bool AnalyzeVaryings(
+            const ShaderInput&              inputDesc,
+            const ShaderOutput&             outputDesc,
+            VaryingLinker::ShaderInterface& shaderInterface
         );
 
     private:
@@ -56,6 +67,9 @@ class Compiler
 
         void ValidateArguments(const ShaderInput& inputDesc, const ShaderOutput& outputDesc);
 
+        // Stores the durations of all compiler stages in the statistics of the specified profiler and records them as trace events.
+        void RecordStages(Profiler& profiler) const;
+
         bool CompileShaderPrimary(
             const ShaderInput&          inputDesc,
             const ShaderOutput&         outputDesc,
@@ -64,9 +78,11 @@ class Compiler
 
         /* === Members === */
 
-        Log*            log_        = nullptr;
+        Log*                            log_                = nullptr;
+
+        StageTimePoints                 timePoints_;
 
-        StageTimePoints timePoints_;
+        VaryingLinker::ShaderInterface* shaderInterface_    = nullptr;
 
 };
 
@@ -8,6 +8,7 @@
 #include "HLSLAnalyzer.h"
 #include "HLSLIntrinsics.h"
 #include "HLSLKeywords.h"
+#include "ReachabilityAnalyzer.h"
 #include "Exception.h"
 #include "Helper.h"
 #include "ReportIdents.h"
@@ -54,11 +55,20 @@ void HLSLAnalyzer::DecorateASTPrimary(
     versionIn_              = inputDesc.shaderVersion;
     shaderModel_            = GetShaderModel(inputDesc.shaderVersion);
     preferWrappers_         = outputDesc.options.preferWrappers;
+    specConstantIDs_        = &(outputDesc.specConstantIDs);
+    specConstantsEnabled_   = IsLanguageVKSL(outputDesc.shaderVersion);
 
     #ifdef XSC_ENABLE_LANGUAGE_EXT
     extensions_             = inputDesc.extensions;
     #endif // XSC_ENABLE_LANGUAGE_EXT
 
+    /* Remove all functions that are unreachable from the entry points, so they don't need to be analyzed */
+    if (outputDesc.options.analyzeReachableOnly)
+    {
+        ReachabilityAnalyzer reachabilityAnalyzer;
+        reachabilityAnalyzer.RemoveUnreachableFunctions(program, entryPoint_, inputDesc.secondaryEntryPoint);
+    }
+
     /* Decorate program AST */
     program_ = &program;
 
@@ -70,6 +80,9 @@ void HLSLAnalyzer::DecorateASTPrimary(
 
     /* Analyze remaining shader model 3 semantic */
     AnalyzeSemanticSM3Remaining();
+
+    /* Analyze specialization constants that have not been found */
+    AnalyzeSpecConstantsRemaining();
 }
 
 
@@ -377,10 +390,17 @@ IMPLEMENT_VISIT_PROC(UniformBufferDecl)
         Visit(ast->localStmnts);
     }
     PopUniformBufferDecl();
+
+    #ifdef XSC_ENABLE_LANGUAGE_EXT
+    AnalyzeExtAttributesUniformBuffer(ast);
+    #endif // XSC_ENABLE_LANGUAGE_EXT
 }
 
 IMPLEMENT_VISIT_PROC(VarDeclStmnt)
 {
+    if (InsideGlobalScope())
+        ast->flags << VarDeclStmnt::isGlobal;
+
     /* Global variables are implicitly constant (or rather uniform) */
     if (InsideGlobalScope() && !InsideUniformBufferDecl())
         ast->MakeImplicitConst();
@@ -389,9 +409,13 @@ IMPLEMENT_VISIT_PROC(VarDeclStmnt)
     Visit(ast->typeSpecifier);
     Visit(ast->varDecls);
 
+    /* Analyze specialization constants of the output descriptor (these take precedence over the 'constant_id' attribute) */
+    if (InsideGlobalScope() && !InsideUniformBufferDecl())
+        AnalyzeSpecConstants(ast);
+
     #ifdef XSC_ENABLE_LANGUAGE_EXT
 
-    AnalyzeExtAttributes(ast->attribs, ast->typeSpecifier->typeDenoter->GetSub());
+    AnalyzeExtAttributes(ast->attribs, ast->typeSpecifier->typeDenoter->GetSub(), ast);
 
     if (extensions_(Extensions::SpaceAttribute))
     {
@@ -674,6 +698,10 @@ IMPLEMENT_VISIT_PROC(PostUnaryExpr)
 IMPLEMENT_VISIT_PROC(CallExpr)
 {
     AnalyzeCallExpr(ast);
+
+    /* Analyze wrapper inlining for intrinsic calls that are not restricted to expression statements */
+    if (!preferWrappers_ && ast->intrinsic == Intrinsic::Lit)
+        AnalyzeIntrinsicWrapperInlining(ast);
 }
 
 IMPLEMENT_VISIT_PROC(AssignExpr)
@@ -1234,6 +1262,19 @@ void HLSLAnalyzer::AnalyzeIntrinsicWrapperInlining(CallExpr* callExpr)
         /* The wrapper function for this intrinsic can be inlined */
         callExpr->flags << CallExpr::canInlineIntrinsicWrapper;
     }
+    /* Is this a 'lit'-intrinsic call with arguments of type 'float'? */
+    else if (callExpr->intrinsic == Intrinsic::Lit && callExpr->arguments.size() == 3)
+    {
+        for (const auto& arg : callExpr->arguments)
+        {
+            auto typeDen = GetTypeDenoterFrom(arg.get());
+            if (!typeDen || !typeDen->GetAliased().IsBase() || typeDen->GetAliased().As<BaseTypeDenoter>()->dataType != DataType::Float)
+                return;
+        }
+
+        /* The wrapper function for this intrinsic can be inlined (each argument is used only once) */
+        callExpr->flags << CallExpr::canInlineIntrinsicWrapper;
+    }
 }
 
 /* ----- Object expressions ----- */
@@ -2400,11 +2441,90 @@ void HLSLAnalyzer::AnalyzeSemanticFunctionReturn(IndexedSemantic& semantic)
         AnalyzeSemanticSM3(semantic, false);
 }
 
+/* ----- Specialization constants ----- */
+
+void HLSLAnalyzer::AnalyzeSpecConstants(VarDeclStmnt* varDeclStmnt)
+{
+    if (!specConstantIDs_->empty())
+    {
+        /* Find variables in the map of specialization constant IDs */
+        for (const auto& varDecl : varDeclStmnt->varDecls)
+        {
+            auto it = specConstantIDs_->find(varDecl->ident.Original());
+            if (it != specConstantIDs_->end())
+            {
+                specConstantIdents_.insert(it->first);
+                AnalyzeSpecConstant(varDecl.get(), it->second, varDecl.get());
+            }
+        }
+    }
+}
+
+void HLSLAnalyzer::AnalyzeSpecConstant(VarDecl* varDecl, int constantID, const AST* ast)
+{
+    if (!specConstantsEnabled_)
+    {
+        /* Ignore specialization constants for all other output languages than VKSL */
+        if (!specConstantsIgnored_ && WarnEnabled(Warnings::Basic))
+            Warning(R_SpecConstantsRequireVKSL, ast);
+        specConstantsIgnored_ = true;
+    }
+    else if (!IsSpecConstantCandidate(varDecl))
+        Error(R_InvalidSpecConstant(varDecl->ident), ast);
+    else if (constantID < 0)
+        Error(R_InvalidSpecConstantID(constantID, varDecl->ident), ast);
+    else
+    {
+        /* Check if the specialization constant ID is already in use */
+        auto it = specConstants_.find(constantID);
+        if (it != specConstants_.end() && it->second != varDecl)
+            Error(R_DuplicateSpecConstantID(constantID, it->second->ident), ast, { it->second });
+        else
+        {
+            varDecl->specConstantID = constantID;
+            specConstants_[constantID] = varDecl;
+        }
+    }
+}
+
+void HLSLAnalyzer::AnalyzeSpecConstantsRemaining()
+{
+    /* Report all specialization constants of the output descriptor that have not been declared */
+    if (specConstantsEnabled_ && WarnEnabled(Warnings::UnlocatedObjects))
+    {
+        for (const auto& entry : *specConstantIDs_)
+        {
+            if (specConstantIdents_.find(entry.first) == specConstantIdents_.end())
+                Warning(R_UndeclaredSpecConstant(entry.first));
+        }
+    }
+}
+
+bool HLSLAnalyzer::IsSpecConstantCandidate(VarDecl* varDecl) const
+{
+    /* Specialization constants must be global non-uniform constants with a constant initializer */
+    auto varDeclStmnt = varDecl->declStmntRef;
+    if (!varDeclStmnt || varDecl->structDeclRef || varDecl->bufferDeclRef || !varDecl->initializerValue.IsValid())
+        return false;
+
+    if (!varDeclStmnt->typeSpecifier->IsConst() || varDeclStmnt->typeSpecifier->isUniform)
+        return false;
+
+    /* Specialization constants must have a scalar type */
+    if (!varDecl->arrayDims.empty())
+        return false;
+
+    if (auto baseTypeDen = varDecl->GetTypeDenoter()->GetAliased().As<BaseTypeDenoter>())
+        return IsScalarType(baseTypeDen->dataType);
+
+    return false;
+}
+
 /* ----- Language extensions ----- */
 
 #ifdef XSC_ENABLE_LANGUAGE_EXT
 
-void HLSLAnalyzer::AnalyzeExtAttributes(std::vector<AttributePtr>& attribs, const TypeDenoterPtr& typeDen)
+void HLSLAnalyzer::AnalyzeExtAttributes(std::vector<AttributePtr>& attribs, const TypeDenoterPtr& typeDen, VarDeclStmnt* varDeclStmnt)
 {
     for (const auto& attrib : attribs)
     {
@@ -2430,6 +2550,32 @@ void HLSLAnalyzer::AnalyzeExtAttributes(std::vector<AttributePtr>& attribs, cons
             }
             break;
 
+            case AttributeType::ConstantID:
+            {
+                /* Analyze "constant_id" attribute (if this language extension is enabled) */
+                if (extensions_(Extensions::ConstantIDAttribute))
+                    AnalyzeAttributeConstantID(attrib.get(), varDeclStmnt);
+                else if (WarnEnabled(Warnings::RequiredExtensions))
+                    Warning(R_AttributeRequiresExtension("constant_id", "attr-constant-id"), attrib.get());
+            }
+            break;
+
+            case AttributeType::ReorderMembers:
+            {
+                /* Attribute "reorder_members" is only allowed for constant buffers (see AnalyzeExtAttributesUniformBuffer) */
+                if (extensions_(Extensions::ReorderMembersAttribute))
+                    Error(R_InvalidConstantBufferAttr("reorder_members"), attrib.get());
+            }
+            break;
+
+            case AttributeType::UpdateFrequency:
+            {
+                /* Attribute "update_frequency" is only allowed for constant buffers (see AnalyzeExtAttributesUniformBuffer) */
+                if (extensions_(Extensions::UpdateFrequencyAttribute))
+                    Error(R_InvalidConstantBufferAttr("update_frequency"), attrib.get());
+            }
+            break;
+
             default:
             {
                 /* Ignore other attributes here */
@@ -2520,6 +2666,58 @@ bool HLSLAnalyzer::AnalyzeAttributeSpaceIdent(Attribute* attrib, std::size_t arg
     return false;
 }
 
+void HLSLAnalyzer::AnalyzeAttributeConstantID(Attribute* attrib, VarDeclStmnt* varDeclStmnt)
+{
+    if (AnalyzeNumArgsAttribute(attrib, 1, true))
+    {
+        /* Attribute can only be used for a single global constant */
+        if (varDeclStmnt && varDeclStmnt->varDecls.size() == 1 && InsideGlobalScope() && !InsideUniformBufferDecl())
+        {
+            /* Specialization constant IDs of the output descriptor take precedence */
+            auto varDecl = varDeclStmnt->varDecls.front().get();
+            if (!varDecl->IsSpecConstant())
+                AnalyzeSpecConstant(varDecl, EvaluateConstExprInt(*attrib->arguments[0]), attrib);
+        }
+        else
+            Error(R_InvalidConstantIDAttr, attrib);
+    }
+}
+
+void HLSLAnalyzer::AnalyzeExtAttributesUniformBuffer(UniformBufferDecl* uniformBufferDecl)
+{
+    for (const auto& attrib : uniformBufferDecl->declStmntRef->attribs)
+    {
+        if (attrib->attributeType == AttributeType::ReorderMembers)
+        {
+            /* Analyze "reorder_members" attribute (if this language extension is enabled) */
+            if (extensions_(Extensions::ReorderMembersAttribute))
+            {
+                if (AnalyzeNumArgsAttribute(attrib.get(), 0, true))
+                    uniformBufferDecl->flags << UniformBufferDecl::isReorderable;
+            }
+            else if (WarnEnabled(Warnings::RequiredExtensions))
+                Warning(R_AttributeRequiresExtension("reorder_members", "attr-reorder-members"), attrib.get());
+        }
+        else if (attrib->attributeType == AttributeType::UpdateFrequency)
+        {
+            /* Analyze "update_frequency" attribute (if this language extension is enabled) */
+            if (extensions_(Extensions::UpdateFrequencyAttribute))
+            {
+                if (AnalyzeNumArgsAttribute(attrib.get(), 1, true))
+                {
+                    auto expr = attrib->arguments[0].get();
+                    if (auto objectExpr = expr->As<ObjectExpr>())
+                        uniformBufferDecl->updateFrequency = objectExpr->ident;
+                    else
+                        Error(R_ExpectedIdentArgInAttribute("update_frequency"), expr);
+                }
+            }
+            else if (WarnEnabled(Warnings::RequiredExtensions))
+                Warning(R_AttributeRequiresExtension("update_frequency", "attr-update-frequency"), attrib.get());
+        }
+    }
+}
+
 void HLSLAnalyzer::AnalyzeVectorSpaceAssign(
     TypedAST* lhs, const TypeDenoter& rhsTypeDen, const OnAssignTypeDenoterProc& assignTypeDenProc, bool swapAssignOrder)
 {
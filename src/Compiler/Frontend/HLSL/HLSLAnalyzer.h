@@ -196,17 +196,29 @@ class HLSLAnalyzer : public Analyzer
         void AnalyzeSemanticVarDecl(IndexedSemantic& semantic, VarDecl* varDecl);
         void AnalyzeSemanticFunctionReturn(IndexedSemantic& semantic);
 
+        /* ----- Specialization constants ----- */
+
+        void AnalyzeSpecConstants(VarDeclStmnt* varDeclStmnt);
+        void AnalyzeSpecConstant(VarDecl* varDecl, int constantID, const AST* ast);
+        void AnalyzeSpecConstantsRemaining();
+
+        bool IsSpecConstantCandidate(VarDecl* varDecl) const;
+
         /* ----- Language extensions ----- */
 
         #ifdef XSC_ENABLE_LANGUAGE_EXT
 
-        void AnalyzeExtAttributes(std::vector<AttributePtr>& attribs, const TypeDenoterPtr& typeDen);
+        void AnalyzeExtAttributes(std::vector<AttributePtr>& attribs, const TypeDenoterPtr& typeDen, VarDeclStmnt* varDeclStmnt = nullptr);
 
         void AnalyzeAttributeLayout(Attribute* attrib, const TypeDenoterPtr& typeDen);
 
         void AnalyzeAttributeSpace(Attribute* attrib, const TypeDenoterPtr& typeDen);
         bool AnalyzeAttributeSpaceIdent(Attribute* attrib, std::size_t argIndex, std::string& ident);
 
+        void AnalyzeAttributeConstantID(Attribute* attrib, VarDeclStmnt* varDeclStmnt);
+
+        void AnalyzeExtAttributesUniformBuffer(UniformBufferDecl* uniformBufferDecl);
+
         void AnalyzeVectorSpaceAssign(
             TypedAST*                       lhs,
             const TypeDenoter&              rhsTypeDen,
@@ -237,6 +249,12 @@ class HLSLAnalyzer : public Analyzer
 
         std::set<VarDecl*>  varDeclSM3Semantics_;
 
+        const std::map<std::string, int>*   specConstantIDs_            = nullptr;
+        std::map<int, VarDecl*>             specConstants_;                         // Specialization constants by their IDs.
+        std::set<std::string>               specConstantIdents_;                    // Identifiers of the output descriptor's specialization constants that have been found.
+        bool                                specConstantsEnabled_       = false;    // Specialization constants are only supported for VKSL output.
+        bool                                specConstantsIgnored_       = false;
+
         #ifdef XSC_ENABLE_LANGUAGE_EXT
 
         Flags               extensions_;
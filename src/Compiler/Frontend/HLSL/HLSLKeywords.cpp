@@ -922,6 +922,9 @@ static Dictionary<AttributeType> GenerateAttributeTypeDict()
         #ifdef XSC_ENABLE_LANGUAGE_EXT
         { "space",                     T::Space                     },
         { "layout",                    T::Layout                    },
+        { "constant_id",               T::ConstantID                },
+        { "reorder_members",           T::ReorderMembers            },
+        { "update_frequency",          T::UpdateFrequency           },
         #endif
     };
 }
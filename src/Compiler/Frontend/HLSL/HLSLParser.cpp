@@ -465,7 +465,13 @@ static ShaderTarget HLSLShaderProfileToTarget(const std::string& s)
     return ShaderTarget::Undefined;
 }
 
-// ':' 'register' '(' (IDENT ',')? IDENT ('[' INT_LITERAL ']')? ')'
+// Returns true if the specified identifier denotes a register space (e.g. "space1").
+static bool IsRegisterSpaceIdent(const std::string& ident)
+{
+    return (ident.size() > 5 && ident.compare(0, 5, "space") == 0);
+}
+
+// ':' 'register' '(' (IDENT ',')? IDENT ('[' INT_LITERAL ']')? (',' IDENT)? ')'
 RegisterPtr HLSLParser::ParseRegister(bool parseColon)
 {
     /* Colon is only syntactic sugar, thus not part of the source area */
@@ -478,22 +484,34 @@ RegisterPtr HLSLParser::ParseRegister(bool parseColon)
     Accept(Tokens::LBracket);
 
     auto typeIdent = ParseIdent();
+    std::string spaceIdent;
 
     /* Parse optional shader profile */
     if (Is(Tokens::Comma))
     {
-        ast->shaderTarget = HLSLShaderProfileToTarget(typeIdent);
+        AcceptIt();
+        auto nextIdent = ParseIdent();
 
-        //TODO: only report a warning (or rather an error), if all valid profiles are checked correctly
-        //if (ast->shaderTarget == ShaderTarget::Undefined)
-        //    Warning("unknown shader profile: '" + typeIdent + "'");
+        if (IsRegisterSpaceIdent(nextIdent))
+        {
+            /* Second identifier is a register space (e.g. "register(t0, space1)") */
+            spaceIdent = nextIdent;
+        }
+        else
+        {
+            ast->shaderTarget = HLSLShaderProfileToTarget(typeIdent);
 
-        AcceptIt();
-        typeIdent = ParseIdent();
+            //TODO: only report a warning (or rather an error), if all valid profiles are checked correctly
+            //if (ast->shaderTarget == ShaderTarget::Undefined)
+            //    Warning("unknown shader profile: '" + typeIdent + "'");
+
+            typeIdent = nextIdent;
+        }
     }
 
     /* Set area offset to register type character */
-    ast->area.Offset(GetScanner().PreviousToken()->Pos());
+    if (spaceIdent.empty())
+        ast->area.Offset(GetScanner().PreviousToken()->Pos());
 
     /* Get register type and slot index from type identifier */
     ast->registerType = CharToRegisterType(typeIdent.front());
@@ -513,6 +531,21 @@ RegisterPtr HLSLParser::ParseRegister(bool parseColon)
         Accept(Tokens::RParen);
     }
 
+    /* Parse optional register space (e.g. "register(ps_5_0, t0, space1)") */
+    if (spaceIdent.empty() && Is(Tokens::Comma))
+    {
+        AcceptIt();
+        spaceIdent = ParseIdent();
+    }
+
+    if (!spaceIdent.empty())
+    {
+        if (IsRegisterSpaceIdent(spaceIdent))
+            ast->space = ParseIntLiteral(spaceIdent.substr(5), GetScanner().PreviousToken().get());
+        else
+            Error(R_InvalidRegisterSpace(spaceIdent), GetScanner().PreviousToken().get());
+    }
+
     Accept(Tokens::RBracket);
 
     return UpdateSourceArea(ast);
@@ -1114,9 +1147,6 @@ StmntPtr HLSLParser::ParseStmntWithStructDecl()
     auto ast = Make<BasicDeclStmnt>();
 
     auto structDecl = ParseStructDecl();
-    structDecl->declStmntRef = ast.get();
-
-    ast->declObject = structDecl;
 
     if (!Is(Tokens::Semicolon))
     {
@@ -1134,6 +1164,10 @@ StmntPtr HLSLParser::ParseStmntWithStructDecl()
     else
         Semi();
 
+    /* Only refer to the declaration statement if it is returned (otherwise the reference would dangle) */
+    structDecl->declStmntRef = ast.get();
+    ast->declObject = structDecl;
+
     return ast;
 }
 
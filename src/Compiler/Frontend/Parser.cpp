@@ -261,7 +261,7 @@ Parser::ParsingState Parser::ActiveParsingState() const
 // expr: logic_or_expr | ternary_expr;
 ExprPtr Parser::ParseGenericExpr()
 {
-    auto ast = ParseLogicOrExpr();
+    auto ast = ParseBinaryExpr();
 
     /* Parse optional ternary expression */
     if (Is(Tokens::TernaryOp))
@@ -293,68 +293,60 @@ TernaryExprPtr Parser::ParseTernaryExpr(const ExprPtr& condExpr)
     return UpdateSourceArea(ast);
 }
 
-ExprPtr Parser::ParseLogicOrExpr()
-{
-    return ParseLTRBinaryExpr(std::bind(&Parser::ParseLogicAndExpr, this), { BinaryOp::LogicalOr });
-}
+/*
+binary_expr: (binary_expr OP)? value_expr;
 
-ExprPtr Parser::ParseLogicAndExpr()
+Parses all left-to-right associative binary operators with an explicit operator stack (operator-precedence parsing),
+so neither the number of terms nor the number of precedence levels increases the recursion depth.
+*/
+ExprPtr Parser::ParseBinaryExpr()
 {
-    return ParseLTRBinaryExpr(std::bind(&Parser::ParseBitwiseOrExpr, this), { BinaryOp::LogicalAnd });
-}
+    std::vector<ExprPtr>                        exprStack;
+    std::vector<std::pair<BinaryExprPtr, int>>  opStack;
 
-ExprPtr Parser::ParseBitwiseOrExpr()
-{
-    return ParseLTRBinaryExpr(std::bind(&Parser::ParseBitwiseXOrExpr, this), { BinaryOp::Or });
-}
+    /* Reduces the top most operator with its two operands */
+    auto ReduceTopOp = [&]()
+    {
+        auto binaryExpr = opStack.back().first;
+        opStack.pop_back();
 
-ExprPtr Parser::ParseBitwiseXOrExpr()
-{
-    return ParseLTRBinaryExpr(std::bind(&Parser::ParseBitwiseAndExpr, this), { BinaryOp::Xor });
-}
+        binaryExpr->rhsExpr = exprStack.back();
+        exprStack.pop_back();
+        binaryExpr->lhsExpr = exprStack.back();
+        exprStack.back() = binaryExpr;
+    };
 
-ExprPtr Parser::ParseBitwiseAndExpr()
-{
-    return ParseLTRBinaryExpr(std::bind(&Parser::ParseEqualityExpr, this), { BinaryOp::And });
-}
+    /* Parse first primary expression */
+    exprStack.push_back(ParseValueExpr());
 
-ExprPtr Parser::ParseEqualityExpr()
-{
-    return ParseLTRBinaryExpr(std::bind(&Parser::ParseRelationExpr, this), { BinaryOp::Equal, BinaryOp::NotEqual });
-}
+    while (Is(Tokens::BinaryOp))
+    {
+        /* Parse binary operator */
+        auto op         = StringToBinaryOp(Tkn()->Spell());
+        auto precedence = GetBinaryOpPrecedence(op);
 
-ExprPtr Parser::ParseRelationExpr()
-{
-    /* Do not parse '<' and '>' as binary operator while a template is actively being parsed */
-    if (ActiveParsingState().activeTemplate)
-        return ParseLTRBinaryExpr(std::bind(&Parser::ParseShiftExpr, this), { BinaryOp::LessEqual, BinaryOp::GreaterEqual });
-    else
-        return ParseLTRBinaryExpr(std::bind(&Parser::ParseShiftExpr, this), { BinaryOp::Less, BinaryOp::LessEqual, BinaryOp::Greater, BinaryOp::GreaterEqual });
-}
+        if (precedence == 0)
+            break;
 
-ExprPtr Parser::ParseShiftExpr()
-{
-    return ParseLTRBinaryExpr(std::bind(&Parser::ParseAddExpr, this), { BinaryOp::LShift, BinaryOp::RShift });
-}
+        AcceptIt();
 
-ExprPtr Parser::ParseAddExpr()
-{
-    return ParseLTRBinaryExpr(std::bind(&Parser::ParseSubExpr, this), { BinaryOp::Add });
-}
+        /* Reduce all previous operators with equal or higher precedence (left-to-right associativity) */
+        while (!opStack.empty() && opStack.back().second >= precedence)
+            ReduceTopOp();
 
-ExprPtr Parser::ParseSubExpr()
-{
-    return ParseLTRBinaryExpr(std::bind(&Parser::ParseMulExpr, this), { BinaryOp::Sub });
-}
+        /* Create binary expression and parse next primary expression */
+        auto binaryExpr = Make<BinaryExpr>();
+        binaryExpr->op = op;
 
-ExprPtr Parser::ParseMulExpr()
-{
-    return ParseLTRBinaryExpr(std::bind(&Parser::ParseDivExpr, this), { BinaryOp::Mul });
-}
+        opStack.push_back({ binaryExpr, precedence });
+        exprStack.push_back(ParseValueExpr());
+    }
 
-ExprPtr Parser::ParseDivExpr()
-{
-    return ParseLTRBinaryExpr(std::bind(&Parser::ParseValueExpr, this), { BinaryOp::Div, BinaryOp::Mod });
+    /* Reduce all remaining operators */
+    while (!opStack.empty())
+        ReduceTopOp();
+
+    return exprStack.back();
 }
 
 ExprPtr Parser::ParseValueExpr()
@@ -422,34 +414,45 @@ const std::string* Parser::FindNameManglingPrefix(const std::string& ident) cons
  * ======= Private: =======
  */
 
-// binary_expr: (binary_expr OP)? sub_expr;
-ExprPtr Parser::ParseLTRBinaryExpr(const std::function<ExprPtr()>& parseSubExprFunc, const BinaryOpList& binaryOps)
+int Parser::GetBinaryOpPrecedence(const BinaryOp op) const
 {
-    /* Parse primary expression */
-    ExprPtr ast = parseSubExprFunc();
-
-    while (Is(Tokens::BinaryOp))
+    switch (op)
     {
-        /* Parse binary operator */
-        auto op = StringToBinaryOp(Tkn()->Spell());
-
-        if (std::find(binaryOps.begin(), binaryOps.end(), op) == binaryOps.end())
-            break;
-
-        AcceptIt();
-
-        /* Create left-to-right associative binary expression and parse next primary expression */
-        auto binaryExpr = Make<BinaryExpr>();
-
-        binaryExpr->lhsExpr = ast;
-        binaryExpr->op      = op;
-        binaryExpr->rhsExpr = parseSubExprFunc();
-
-        /* New binary expression becomes the active AST node */
-        ast = binaryExpr;
+        case BinaryOp::LogicalOr:
+            return 1;
+        case BinaryOp::LogicalAnd:
+            return 2;
+        case BinaryOp::Or:
+            return 3;
+        case BinaryOp::Xor:
+            return 4;
+        case BinaryOp::And:
+            return 5;
+        case BinaryOp::Equal:
+        case BinaryOp::NotEqual:
+            return 6;
+        case BinaryOp::Less:
+        case BinaryOp::Greater:
+            /* Do not parse '<' and '>' as binary operator while a template is actively being parsed */
+            return (ActiveParsingState().activeTemplate ? 0 : 7);
+        case BinaryOp::LessEqual:
+        case BinaryOp::GreaterEqual:
+            return 7;
+        case BinaryOp::LShift:
+        case BinaryOp::RShift:
+            return 8;
+        case BinaryOp::Add:
+            return 9;
+        case BinaryOp::Sub:
+            return 10;
+        case BinaryOp::Mul:
+            return 11;
+        case BinaryOp::Div:
+        case BinaryOp::Mod:
+            return 12;
+        default:
+            return 0;
     }
-
-    return ast;
 }
 
 void Parser::IncUnexpectedTokenCounter()
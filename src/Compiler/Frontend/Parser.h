@@ -38,8 +38,7 @@ class Parser
 
     protected:
 
-        using Tokens        = Token::Types;
-        using BinaryOpList  = std::initializer_list<BinaryOp>;
+        using Tokens = Token::Types;
 
         struct ParsingState
         {
@@ -139,18 +138,7 @@ class Parser
         ExprPtr         ParseGenericExpr();
         TernaryExprPtr  ParseTernaryExpr(const ExprPtr& condExpr);
 
-        ExprPtr         ParseLogicOrExpr();
-        ExprPtr         ParseLogicAndExpr();
-        ExprPtr         ParseBitwiseOrExpr();
-        ExprPtr         ParseBitwiseXOrExpr();
-        ExprPtr         ParseBitwiseAndExpr();
-        ExprPtr         ParseEqualityExpr();
-        ExprPtr         ParseRelationExpr();
-        ExprPtr         ParseShiftExpr();
-        ExprPtr         ParseAddExpr();
-        ExprPtr         ParseSubExpr();
-        ExprPtr         ParseMulExpr();
-        ExprPtr         ParseDivExpr();
+        ExprPtr         ParseBinaryExpr();
         ExprPtr         ParseValueExpr();
 
         virtual ExprPtr ParsePrimaryExpr() = 0;
@@ -225,8 +213,8 @@ class Parser
 
         /* === Functions === */
 
-        // Parse left-to-right associative binary expression.
-        ExprPtr ParseLTRBinaryExpr(const std::function<ExprPtr()>& parseSubExprFunc, const BinaryOpList& binaryOps);
+        // Returns the precedence of the specified binary operator (higher binds stronger), or 0 if it can not be parsed in the current state.
+        int GetBinaryOpPrecedence(const BinaryOp op) const;
 
         void IncUnexpectedTokenCounter();
 
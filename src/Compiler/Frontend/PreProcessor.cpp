@@ -13,6 +13,8 @@
 #include "ReportIdents.h"
 #include "Exception.h"
 #include <sstream>
+#include <iterator>
+#include <cstdint>
 
 
 namespace Xsc
@@ -61,6 +63,11 @@ std::vector<std::string> PreProcessor::ListDefinedMacroIdents() const
     return idents;
 }
 
+std::vector<std::string> PreProcessor::ListUsedMacroIdents() const
+{
+    return std::vector<std::string>(usedMacros_.begin(), usedMacros_.end());
+}
+
 
 /*
  * ======= Protected: =======
@@ -166,6 +173,14 @@ bool PreProcessor::IsDefined(const std::string& ident) const
     return (macros_.find(ident) != macros_.end());
 }
 
+void PreProcessor::MarkMacroUsed(const std::string& ident)
+{
+    /* Ignore standard macros, since they can not be supplied from outside */
+    auto it = macros_.find(ident);
+    if (it == macros_.end() || !it->second->stdMacro)
+        usedMacros_.insert(ident);
+}
+
 bool PreProcessor::OnDefineMacro(const Macro& macro)
 {
     /* Always allow to define any macros per default */
@@ -480,6 +495,45 @@ TokenPtrString PreProcessor::ExpandMacro(const Macro& macro, const std::vector<T
     return expandedString;
 }
 
+// Returns the 64-bit FNV-1a hash of the specified string.
+static std::uint64_t HashFNV1a(const std::string& s)
+{
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+
+    for (auto c : s)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
+std::unique_ptr<std::istream> PreProcessor::RecordIncludeFile(const std::string& filename, std::unique_ptr<std::istream>&& stream)
+{
+    /* Read entire content of the include file to determine its hash */
+    std::string content { std::istreambuf_iterator<char>(*stream), std::istreambuf_iterator<char>() };
+
+    /* Determine resolved filename */
+    auto path = includeHandler_.GetResolvedFilename();
+    if (path.empty())
+        path = filename;
+
+    /* Append include file only once */
+    if (includePaths_.insert(path).second)
+    {
+        Reflection::IncludeFile includeFile;
+        {
+            includeFile.name = filename;
+            includeFile.path = path;
+            includeFile.hash = HashFNV1a(content);
+        }
+        includeFiles_.push_back(includeFile);
+    }
+
+    return MakeUnique<std::stringstream>(std::move(content));
+}
+
 void PreProcessor::WritePosToLineDirective()
 {
     if (writeLineMarks_)
@@ -571,6 +625,8 @@ TokenPtrString PreProcessor::ParseIdentAsTokenString()
         {
             /* Perform macro expansion */
             auto& macro = *it->second;
+            MarkMacroUsed(identTkn->Spell());
+
             if (macro.HasParameterList())
             {
                 /* Replace identifier to macro with arguments */
@@ -834,6 +890,10 @@ void PreProcessor::ParseDirectiveInclude()
             Error(e.what());
         }
 
+        /* Record include file for dependency tracking */
+        if (includeStream)
+            includeStream = RecordIncludeFile(filename, std::move(includeStream));
+
         /* Push scanner soruce for include file */
         auto sourceCode = std::make_shared<SourceCode>(std::move(includeStream));
         PushScannerSource(sourceCode, filename);
@@ -862,6 +922,7 @@ void PreProcessor::ParseDirectiveIfdef(bool skipEvaluation)
         /* Parse identifier */
         IgnoreWhiteSpaces();
         auto ident = Accept(Tokens::Ident)->Spell();
+        MarkMacroUsed(ident);
 
         /* Push new if-block activation (with 'defined' condExpr) */
         PushIfBlock(tkn, IsDefined(ident));
@@ -877,6 +938,9 @@ void PreProcessor::ParseDirectiveIfndef(bool skipEvaluation)
     IgnoreWhiteSpaces();
     auto ident = Accept(Tokens::Ident)->Spell();
 
+    if (!skipEvaluation)
+        MarkMacroUsed(ident);
+
     /* Push new if-block activation (with 'not defined' condExpr) */
     PushIfBlock(tkn, !IsDefined(ident));
 }
@@ -1235,6 +1299,8 @@ std::string PreProcessor::ParseDefinedMacro()
     else
         macroIdent = Accept(Tokens::Ident)->Spell();
 
+    MarkMacroUsed(macroIdent);
+
     /* Determine value of integer literal ('1' if macro is defined, '0' otherwise */
     return (IsDefined(macroIdent) ? "1" : "0");
 }
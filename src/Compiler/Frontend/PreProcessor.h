@@ -53,6 +53,15 @@ class PreProcessor : public Parser
         // Returns a list of all defined macro identifiers after pre-processing.
         std::vector<std::string> ListDefinedMacroIdents() const;
 
+        // Returns a list of all macro identifiers that were tested or expanded during pre-processing.
+        std::vector<std::string> ListUsedMacroIdents() const;
+
+        // Returns the list of all files that have been included during pre-processing.
+        inline const std::vector<Reflection::IncludeFile>& GetIncludeFiles() const
+        {
+            return includeFiles_;
+        }
+
     protected:
 
         // Macro object structure.
@@ -105,6 +114,9 @@ class PreProcessor : public Parser
         // Returns true if the specified macro identifier is defined.
         bool IsDefined(const std::string& ident) const;
 
+        // Marks the specified macro identifier as used, i.e. its definition has an effect on the output.
+        void MarkMacroUsed(const std::string& ident);
+
         // Callback function when a macro is about to be defined
         virtual bool OnDefineMacro(const Macro& macro);
 
@@ -170,6 +182,9 @@ class PreProcessor : public Parser
         */
         TokenPtrString ExpandMacro(const Macro& macro, const std::vector<TokenPtrString>& arguments);
 
+        // Reads the entire include stream and records the include file with its resolved filename and content hash. Returns the new stream.
+        std::unique_ptr<std::istream> RecordIncludeFile(const std::string& filename, std::unique_ptr<std::istream>&& stream);
+
         // Writes a '#line'-directive to the output with the current source position and filename.
         void WritePosToLineDirective();
 
@@ -209,22 +224,26 @@ class PreProcessor : public Parser
 
         /* === Members === */
 
-        IncludeHandler&                     includeHandler_;
+        IncludeHandler&                         includeHandler_;
+
+        std::unique_ptr<std::stringstream>      output_;
 
-        std::unique_ptr<std::stringstream>  output_;
+        std::map<std::string, MacroPtr>         macros_;
+        std::set<std::string>                   onceIncluded_;
+        std::set<std::string>                   usedMacros_;        // Macros tested with '#if', '#ifdef', 'defined', or expanded
+        std::map<std::string, std::size_t>      includeCounter_;    // Counter for each included file
 
-        std::map<std::string, MacroPtr>     macros_;
-        std::set<std::string>               onceIncluded_;
-        std::map<std::string, std::size_t>  includeCounter_; // Counter for each included file
+        std::vector<Reflection::IncludeFile>    includeFiles_;
+        std::set<std::string>                   includePaths_;      // Resolved paths of all entries in 'includeFiles_'
 
         /*
         Stack to store the info which if-block in the hierarchy is active.
         Once an if-block is inactive, all subsequent if-blocks are inactive, too.
         */
-        std::stack<IfBlock>                 ifBlockStack_;
+        std::stack<IfBlock>                     ifBlockStack_;
 
-        bool                                writeLineMarks_         = true;
-        bool                                writeLineMarkFilenames_ = true;
+        bool                                    writeLineMarks_         = true;
+        bool                                    writeLineMarkFilenames_ = true;
 
 };
 
@@ -6,7 +6,6 @@
  */
 
 #include "PreProcessorScanner.h"
-#include <cctype>
 
 
 namespace Xsc
@@ -37,13 +36,13 @@ TokenPtr PreProcessorScanner::ScanToken()
         return ScanDirectiveOrDirectiveConcat();
 
     /* Scan identifier */
-    if (std::isalpha(UChr()) || Is('_'))
+    if (IsClass(CharClass::IdentHead))
         return ScanIdentifier();
 
     /* Scan number */
     if (Is('.'))
         return ScanNumberOrDot();
-    if (std::isdigit(UChr()))
+    if (IsClass(CharClass::Digit))
         return ScanNumber();
 
     /* Scan string literal */
@@ -150,8 +149,7 @@ TokenPtr PreProcessorScanner::ScanDirectiveOrDirectiveConcat()
     /* Scan identifier string */
     StoreStartPos();
 
-    while (std::isalpha(UChr()))
-        spell += TakeIt();
+    TakeRun(spell, CharClass::Alpha);
 
     /* Return as identifier */
     return Make(Token::Types::Directive, spell);
@@ -163,8 +161,7 @@ TokenPtr PreProcessorScanner::ScanIdentifier()
     std::string spell;
     spell += TakeIt();
 
-    while (std::isalnum(UChr()) || Is('_'))
-        spell += TakeIt();
+    TakeRun(spell, CharClass::IdentTail);
 
     /* Return as identifier */
     return Make(Token::Types::Ident, spell);
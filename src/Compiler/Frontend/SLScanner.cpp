@@ -6,7 +6,6 @@
  */
 
 #include "SLScanner.h"
-#include <cctype>
 
 
 namespace Xsc
@@ -37,13 +36,13 @@ TokenPtr SLScanner::ScanToken()
         return ScanDirective();
 
     /* Scan identifier */
-    if (std::isalpha(UChr()) || Is('_'))
+    if (IsClass(CharClass::IdentHead))
         return ScanIdentifier();
 
     /* Scan number */
     if (Is('.'))
         return ScanNumberOrDot();
-    if (std::isdigit(UChr()))
+    if (IsClass(CharClass::Digit))
         return ScanNumber();
 
     /* Scan string literal */
@@ -162,8 +161,7 @@ TokenPtr SLScanner::ScanDirective()
     /* Scan identifier string */
     StoreStartPos();
 
-    while (std::isalpha(UChr()))
-        spell += TakeIt();
+    TakeRun(spell, CharClass::Alpha);
 
     /* Return as identifier */
     return Make(Token::Types::Directive, spell);
@@ -175,8 +173,7 @@ TokenPtr SLScanner::ScanIdentifier()
     std::string spell;
     spell += TakeIt();
 
-    while (std::isalnum(UChr()) || Is('_'))
-        spell += TakeIt();
+    TakeRun(spell, CharClass::IdentTail);
 
     /* Scan identifier or keyword */
     return ScanIdentifierOrKeyword(std::move(spell));
@@ -8,7 +8,8 @@
 #include "Scanner.h"
 #include "Helper.h"
 #include "ReportIdents.h"
-#include <cctype>
+#include "Profiler.h"
+#include <cstring>
 
 
 namespace Xsc
@@ -90,6 +91,7 @@ TokenPtr Scanner::NextToken(bool scanComments, bool scanWhiteSpaces)
     {
         /* Scan next token from token sub-scanner */
         tkn = NextTokenScan(scanComments, scanWhiteSpaces);
+        Profiler::CountToken();
     }
 
     /* Store new active token */
@@ -113,7 +115,7 @@ TokenPtr Scanner::NextTokenScan(bool scanComments, bool scanWhiteSpaces)
             do
             {
                 /* Scan or ignore white spaces */
-                if (scanWhiteSpaces && std::isspace(UChr()))
+                if (scanWhiteSpaces && IsClass(CharClass::Space))
                 {
                     StoreStartPos();
                     return ScanWhiteSpaces(false);
@@ -259,16 +261,41 @@ void Scanner::ErrorUnexpectedEOS()
 
 /* ----- Scanning ----- */
 
-void Scanner::Ignore(const std::function<bool(char)>& pred)
+void Scanner::Ignore(unsigned char charClass)
 {
-    while (pred(Chr()))
+    while (IsClass(charClass))
+    {
+        /* Ignore the whole run of characters within the current line at once */
+        source_->IgnoreRun(charClass);
         TakeIt();
+    }
 }
 
 void Scanner::IgnoreWhiteSpaces(bool includeNewLines)
 {
-    while ( std::isspace(UChr()) && ( includeNewLines || !IsNewLine() ) )
+    Ignore(includeNewLines ? CharClass::Space : CharClass::Blank);
+}
+
+void Scanner::TakeRun(std::string& spell, unsigned char charClass)
+{
+    while (IsClass(charClass))
+    {
+        /* Take the whole run of characters within the current line at once */
+        spell += chr_;
+        source_->AppendRun(spell, charClass);
         TakeIt();
+    }
+}
+
+void Scanner::TakeUntil(std::string& spell, const char* delimiters)
+{
+    while (!Is(0) && std::strchr(delimiters, chr_) == nullptr)
+    {
+        /* Take all characters within the current line up to the next delimiter at once */
+        spell += chr_;
+        source_->AppendUntil(spell, delimiters);
+        TakeIt();
+    }
 }
 
 TokenPtr Scanner::ScanWhiteSpaces(bool includeNewLines)
@@ -279,9 +306,7 @@ TokenPtr Scanner::ScanWhiteSpaces(bool includeNewLines)
 
     /* Scan other white spaces */
     std::string spell;
-
-    while ( std::isspace(UChr()) && ( includeNewLines || !IsNewLine() ) )
-        spell += TakeIt();
+    TakeRun(spell, (includeNewLines ? CharClass::Space : CharClass::Blank));
 
     return Make(Tokens::WhiteSpace, spell);
 }
@@ -292,8 +317,7 @@ TokenPtr Scanner::ScanCommentLine(bool scanComments)
 
     TakeIt(); // Ignore second '/' from commentary line beginning
 
-    while (!IsNewLine())
-        spell += TakeIt();
+    TakeUntil(spell, "\n\r");
 
     /* Store commentary string */
     AppendComment(spell);
@@ -328,7 +352,7 @@ TokenPtr Scanner::ScanCommentBlock(bool scanComments)
                 spell += '*';
         }
         else
-            spell += TakeIt();
+            TakeUntil(spell, "*");
     }
 
     /* Store commentary string */
@@ -437,8 +461,7 @@ TokenPtr Scanner::ScanNumber(bool startWithPeriod)
         if (spell == "0" && Is('x'))
         {
             spell += TakeIt();
-            while ( std::isdigit(UChr()) || ( Chr() >= 'a' && Chr() <= 'f' ) || ( Chr() >= 'A' && Chr() <= 'F' ) )
-                spell += TakeIt();
+            TakeRun(spell, CharClass::HexDigit);
         }
 
         /* Check for integer-suffix */
@@ -458,7 +481,7 @@ TokenPtr Scanner::ScanNumberOrDot()
 
     if (Is('.'))
         return ScanVarArg(spell);
-    if (std::isdigit(UChr()))
+    if (IsClass(CharClass::Digit))
         return ScanNumber(true);
 
     return Make(Tokens::Dot, spell);
@@ -473,11 +496,8 @@ TokenPtr Scanner::ScanVarArg(std::string& spell)
 
 bool Scanner::ScanDigitSequence(std::string& spell)
 {
-    bool result = (std::isdigit(UChr()) != 0);
-
-    while (std::isdigit(UChr()))
-        spell += TakeIt();
-
+    bool result = IsClass(CharClass::Digit);
+    TakeRun(spell, CharClass::Digit);
     return result;
 }
 
@@ -17,7 +17,6 @@
 #include "TokenString.h"
 
 #include <string>
-#include <functional>
 
 
 namespace Xsc
@@ -115,10 +114,16 @@ class Scanner
 
         /* ----- Scanning ----- */
 
-        // Ignores all characters which comply the specified predicate.
-        void        Ignore(const std::function<bool(char)>& pred);
+        // Ignores all characters which belong to the specified character class (see CharClass).
+        void        Ignore(unsigned char charClass);
         void        IgnoreWhiteSpaces(bool includeNewLines = true);
 
+        // Takes all characters which belong to the specified character class and appends them to the spelling.
+        void        TakeRun(std::string& spell, unsigned char charClass);
+
+        // Takes all characters until any of the specified delimiters or the end-of-stream appears and appends them to the spelling.
+        void        TakeUntil(std::string& spell, const char* delimiters);
+
         TokenPtr    ScanWhiteSpaces(bool includeNewLines = true);
         TokenPtr    ScanCommentLine(bool scanComments);
         TokenPtr    ScanCommentBlock(bool scanComments);
@@ -138,6 +143,12 @@ class Scanner
             return (chr_ == '\n' || chr_ == '\r');
         }
 
+        // Returns true if the next character belongs to the specified character class (see CharClass).
+        inline bool IsClass(unsigned char charClass) const
+        {
+            return IsCharClass(chr_, charClass);
+        }
+
         // Returns true if the next character is equal to the specified character.
         inline bool Is(char chr) const
         {
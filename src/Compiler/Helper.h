@@ -19,6 +19,8 @@
 #include <functional>
 #include <iomanip>
 #include <cctype>
+#include <cstdlib>
+#include <cerrno>
 
 
 namespace Xsc
@@ -137,7 +139,7 @@ void Replace(
     Replace(s, std::basic_string<CharT, Traits, Allocator>(from), to);
 }
 
-// Parses a number from the specified string with std::stoi, std::stoll, std::stof, or std::stod
+// Parses a number from the specified string with std::stoi, std::stoll, std::stoul, std::strtof, or std::strtod
 template <typename T>
 inline T FromStringOrDefault(const std::string& s)
 {
@@ -192,27 +194,21 @@ inline unsigned long FromStringOrDefault<unsigned long>(const std::string& s)
 template <>
 inline float FromStringOrDefault<float>(const std::string& s)
 {
-    try
-    {
-        return std::stof(s);
-    }
-    catch (const std::exception&)
-    {
-        return 0.0f;
-    }
+    /* Parse with std::strtof to avoid exception handling (result is correctly rounded) */
+    char* end = nullptr;
+    errno = 0;
+    auto value = std::strtof(s.c_str(), &end);
+    return (end != s.c_str() && errno != ERANGE ? value : 0.0f);
 }
 
 template <>
 inline double FromStringOrDefault<double>(const std::string& s)
 {
-    try
-    {
-        return std::stod(s);
-    }
-    catch (const std::exception&)
-    {
-        return 0.0;
-    }
+    /* Parse with std::strtod to avoid exception handling (result is correctly rounded) */
+    char* end = nullptr;
+    errno = 0;
+    auto value = std::strtod(s.c_str(), &end);
+    return (end != s.c_str() && errno != ERANGE ? value : 0.0);
 }
 
 // Transforms the specified string to upper case.
@@ -18,6 +18,7 @@ namespace Xsc
 struct IncludeHandler::OpaqueData
 {
     std::vector<std::string> searchPaths;
+    std::string              resolvedFilename;
 };
 
 IncludeHandler::IncludeHandler() :
@@ -38,11 +39,16 @@ static std::unique_ptr<std::istream> ReadFile(const std::string& filename)
 
 std::unique_ptr<std::istream> IncludeHandler::Include(const std::string& filename, bool useSearchPathsFirst)
 {
+    data_->resolvedFilename.clear();
+
     if (!useSearchPathsFirst)
     {
         /* Read file from relative path */
         if (auto file = ReadFile(filename))
+        {
+            data_->resolvedFilename = filename;
             return file;
+        }
     }
 
     /* Search file in search paths */
@@ -58,7 +64,10 @@ std::unique_ptr<std::istream> IncludeHandler::Include(const std::string& filenam
 
             /* Read file from current path */
             if (auto file = ReadFile(s))
+            {
+                data_->resolvedFilename = s;
                 return file;
+            }
         }
     }
 
@@ -66,7 +75,10 @@ std::unique_ptr<std::istream> IncludeHandler::Include(const std::string& filenam
     {
         /* Read file from relative path */
         if (auto file = ReadFile(filename))
+        {
+            data_->resolvedFilename = filename;
             return file;
+        }
     }
 
     RuntimeErr(R_FailedToIncludeFile(filename));
@@ -82,6 +94,21 @@ const std::vector<std::string>& IncludeHandler::GetSearchPaths() const
     return data_->searchPaths;
 }
 
+const std::string& IncludeHandler::GetResolvedFilename() const
+{
+    return data_->resolvedFilename;
+}
+
+
+/*
+ * ======= Protected: =======
+ */
+
+void IncludeHandler::SetResolvedFilename(const std::string& filename)
+{
+    data_->resolvedFilename = filename;
+}
+
 
 } // /namespace Xsc
 
@@ -0,0 +1,36 @@
+/*
+ * UnixProfiler.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Profiler.h"
+#include <sys/resource.h>
+
+
+namespace Xsc
+{
+
+
+std::size_t Profiler::QueryPeakMemory()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+
+    #ifdef __APPLE__
+    /* Maximum resident set size is in bytes on macOS */
+    return static_cast<std::size_t>(usage.ru_maxrss);
+    #else
+    /* Maximum resident set size is in kilobytes on Linux and BSD */
+    return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+    #endif
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
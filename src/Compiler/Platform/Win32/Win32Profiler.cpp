@@ -0,0 +1,33 @@
+/*
+ * Win32Profiler.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Profiler.h"
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#include <Psapi.h>
+
+
+namespace Xsc
+{
+
+
+std::size_t Profiler::QueryPeakMemory()
+{
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return static_cast<std::size_t>(counters.PeakWorkingSetSize);
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
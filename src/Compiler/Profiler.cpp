@@ -0,0 +1,135 @@
+/*
+ * Profiler.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Profiler.h"
+#include <Xsc/Xsc.h>
+#include <Xsc/Trace.h>
+
+
+namespace Xsc
+{
+
+
+thread_local static Profiler* g_profilerInstance = nullptr;
+
+Profiler::Profiler(CompileStatistics* statistics, TraceRecorder* traceRecorder, const std::string& filename) :
+    statistics_    { statistics         },
+    traceRecorder_ { traceRecorder      },
+    filename_      { filename           },
+    startTime_     { Clock::now()       },
+    prevProfiler_  { g_profilerInstance }
+{
+    if (traceRecorder_)
+        traceStartTime_ = traceRecorder_->Now();
+    g_profilerInstance = this;
+}
+
+Profiler::~Profiler()
+{
+    g_profilerInstance = prevProfiler_;
+}
+
+Profiler* Profiler::Get()
+{
+    return g_profilerInstance;
+}
+
+void Profiler::CountToken()
+{
+    if (auto profiler = g_profilerInstance)
+    {
+        if (auto statistics = profiler->statistics_)
+        {
+            statistics->numTokens++;
+            statistics->numAllocations++;
+        }
+    }
+}
+
+void Profiler::CountASTNode()
+{
+    if (auto profiler = g_profilerInstance)
+    {
+        if (auto statistics = profiler->statistics_)
+        {
+            statistics->numASTNodes++;
+            statistics->numAllocations++;
+        }
+    }
+}
+
+void Profiler::CountTypeDenoter()
+{
+    if (auto profiler = g_profilerInstance)
+    {
+        if (auto statistics = profiler->statistics_)
+            statistics->numAllocations++;
+    }
+}
+
+// Returns the duration (in nanoseconds) from the start time to the end time, or 0 if the end time is before the start time.
+static std::uint64_t DurationNanoseconds(const Profiler::TimePoint& startTime, const Profiler::TimePoint& endTime)
+{
+    if (endTime > startTime)
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count());
+    else
+        return 0;
+}
+
+void Profiler::RecordEvent(const std::string& name, const std::string& category, const TimePoint& startTime, const TimePoint& endTime)
+{
+    if (traceRecorder_)
+    {
+        traceRecorder_->RecordEvent(
+            name,
+            category,
+            traceStartTime_ + DurationNanoseconds(startTime_, startTime),
+            DurationNanoseconds(startTime, endTime),
+            filename_
+        );
+    }
+}
+
+
+/*
+ * ScopedPass class
+ */
+
+Profiler::ScopedPass::ScopedPass(const char* name) :
+    profiler_ { g_profilerInstance },
+    name_     { name               }
+{
+    if (profiler_)
+        startTime_ = Clock::now();
+}
+
+Profiler::ScopedPass::~ScopedPass()
+{
+    if (profiler_)
+    {
+        const auto endTime = Clock::now();
+
+        if (auto statistics = profiler_->statistics_)
+        {
+            CompileStatistics::Pass pass;
+            {
+                pass.name       = name_;
+                pass.duration   = DurationNanoseconds(startTime_, endTime);
+            }
+            statistics->passes.push_back(pass);
+        }
+
+        profiler_->RecordEvent(name_, "pass", startTime_, endTime);
+    }
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
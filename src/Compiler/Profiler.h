@@ -0,0 +1,110 @@
+/*
+ * Profiler.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_PROFILER_H
+#define XSC_PROFILER_H
+
+
+#include <chrono>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace Xsc
+{
+
+
+struct CompileStatistics;
+class TraceRecorder;
+
+/*
+Compile profiler class.
+Collects the compile statistics and the trace events of a single compilation (see CompileStatistics and TraceRecorder).
+The profiler is only active on the thread it has been created on, and all static counting functions do nothing if no profiler is active on the current thread.
+*/
+class Profiler
+{
+
+    public:
+
+        using Clock     = std::chrono::steady_clock;
+        using TimePoint = Clock::time_point;
+
+        // Scope guard that measures the duration of a compiler pass until the end of its scope (recorded as trace event of category "pass").
+        class ScopedPass
+        {
+
+            public:
+
+                ScopedPass(const ScopedPass&) = delete;
+                ScopedPass& operator = (const ScopedPass&) = delete;
+
+                ScopedPass(const char* name);
+                ~ScopedPass();
+
+            private:
+
+                Profiler*   profiler_   = nullptr;
+                const char* name_       = nullptr;
+                TimePoint   startTime_;
+
+        };
+
+        Profiler(const Profiler&) = delete;
+        Profiler& operator = (const Profiler&) = delete;
+
+        // Activates this profiler for the current thread until it is destroyed. Both the statistics and the trace recorder are optional.
+        Profiler(CompileStatistics* statistics, TraceRecorder* traceRecorder, const std::string& filename);
+        ~Profiler();
+
+        // Returns the active profiler of the current thread, or null if no compile statistics are collected.
+        static Profiler* Get();
+
+        // Counts a newly scanned token.
+        static void CountToken();
+
+        // Counts a newly created AST node.
+        static void CountASTNode();
+
+        // Counts a newly created type denoter.
+        static void CountTypeDenoter();
+
+        // Returns the peak memory usage (in bytes) of the process, or 0 if the platform does not support this query (implemented per platform).
+        static std::size_t QueryPeakMemory();
+
+        // Records a trace event for the specified time range, if a trace recorder is used.
+        void RecordEvent(const std::string& name, const std::string& category, const TimePoint& startTime, const TimePoint& endTime);
+
+        // Returns the compile statistics this profiler writes to, or null if no statistics are collected.
+        inline CompileStatistics* GetStatistics()
+        {
+            return statistics_;
+        }
+
+    private:
+
+        CompileStatistics*  statistics_     = nullptr;
+        TraceRecorder*      traceRecorder_  = nullptr;
+        std::string         filename_;
+
+        TimePoint           startTime_;                 // Start time of this profiler.
+        std::uint64_t       traceStartTime_ = 0;        // Start time of this profiler in the time domain of the trace recorder.
+
+        Profiler*           prevProfiler_   = nullptr;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -7,6 +7,8 @@
 
 #include <Xsc/Reflection.h>
 #include "ReflectionPrinter.h"
+#include "ReflectionJSONPrinter.h"
+#include "ReflectionSerializer.h"
 #include "ASTEnums.h"
 
 
@@ -40,6 +42,68 @@ XSC_EXPORT void PrintReflection(std::ostream& stream, const Reflection::Reflecti
     printer.PrintReflection(reflectionData, referencedOnly);
 }
 
+// Escapes the specified filename for the Makefile dependency format.
+static std::string EscapeDependencyFilename(const std::string& filename)
+{
+    std::string s;
+    s.reserve(filename.size());
+
+    for (auto c : filename)
+    {
+        if (c == ' ' || c == '#')
+            s += '\\';
+        else if (c == '$')
+            s += '$';
+        s += c;
+    }
+
+    return s;
+}
+
+XSC_EXPORT void PrintDependencies(std::ostream& stream, const std::string& target, const std::string& source, const Reflection::ReflectionData& reflectionData)
+{
+    stream << EscapeDependencyFilename(target) << ':';
+
+    if (!source.empty())
+        stream << ' ' << EscapeDependencyFilename(source);
+
+    for (const auto& includeFile : reflectionData.includeFiles)
+        stream << " \\\n  " << EscapeDependencyFilename(includeFile.path);
+
+    stream << '\n';
+
+    /* Write phony targets for all include files to avoid errors when a header file is deleted */
+    for (const auto& includeFile : reflectionData.includeFiles)
+        stream << '\n' << EscapeDependencyFilename(includeFile.path) << ":\n";
+}
+
+XSC_EXPORT void WriteReflection(std::ostream& stream, const Reflection::ReflectionData& reflectionData)
+{
+    std::vector<char> buffer;
+
+    ReflectionSerializer serializer;
+    serializer.Serialize(reflectionData, buffer);
+
+    stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
+
+XSC_EXPORT bool ReadReflection(const void* data, std::size_t size, Reflection::ReflectionData& reflectionData)
+{
+    Reflection::ReflectionReader reader;
+    if (reader.Load(data, size))
+    {
+        ReflectionSerializer::Deserialize(reader, reflectionData);
+        return true;
+    }
+    return false;
+}
+
+XSC_EXPORT void PrintReflectionJSON(std::ostream& stream, const Reflection::ReflectionData& reflectionData)
+{
+    ReflectionJSONPrinter printer { stream };
+    printer.PrintReflection(reflectionData);
+}
+
 
 } // /namespace Xsc
 
@@ -0,0 +1,578 @@
+/*
+ * ReflectionJSONPrinter.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ReflectionJSONPrinter.h"
+#include "ASTEnums.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+
+
+namespace Xsc
+{
+
+
+ReflectionJSONPrinter::ReflectionJSONPrinter(std::ostream& output) :
+    output_ { output }
+{
+}
+
+void ReflectionJSONPrinter::PrintReflection(const Reflection::ReflectionData& reflectionData)
+{
+    BeginObject();
+    {
+        PrintStrings            ( "macros",           reflectionData.macros           );
+        PrintStrings            ( "usedMacros",       reflectionData.usedMacros       );
+        PrintIncludeFiles       ( reflectionData.includeFiles                         );
+        PrintRecords            ( reflectionData.records                              );
+        PrintAttributes         ( "inputAttributes",  reflectionData.inputAttributes  );
+        PrintAttributes         ( "outputAttributes", reflectionData.outputAttributes );
+        PrintAttributes         ( "uniforms",         reflectionData.uniforms         );
+        PrintSpecConstants      ( reflectionData.specConstants                        );
+        PrintResources          ( reflectionData.resources                            );
+        PrintConstantBuffers    ( reflectionData.constantBuffers                      );
+        PrintSamplerStates      ( reflectionData.samplerStates                        );
+        PrintStaticSamplerStates( reflectionData.staticSamplerStates                  );
+        PrintNumThreads         ( reflectionData.numThreads                           );
+        PrintCostEstimate       ( reflectionData.cost                                 );
+        PrintRegisterPressure   ( reflectionData.registerPressure                     );
+    }
+    EndObject();
+    output_ << std::endl;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+static const char* FieldTypeToString(const Reflection::FieldType t)
+{
+    using T = Reflection::FieldType;
+
+    switch (t)
+    {
+        case T::Bool:   return "bool";
+        case T::Int:    return "int";
+        case T::UInt:   return "uint";
+        case T::Half:   return "half";
+        case T::Float:  return "float";
+        case T::Double: return "double";
+        case T::Record: return "record";
+        default:        return "undefined";
+    }
+}
+
+// Returns the shortest decimal representation of the specified value, which is converted back to the same value.
+template <typename T>
+std::string ShortestNumberString(T value)
+{
+    std::ostringstream s;
+
+    for (int precision = 6; precision <= std::numeric_limits<T>::max_digits10; ++precision)
+    {
+        s.str("");
+        s << std::setprecision(precision) << value;
+        if (static_cast<T>(std::strtod(s.str().c_str(), nullptr)) == value)
+            break;
+    }
+
+    return s.str();
+}
+
+/* --- JSON output --- */
+
+void ReflectionJSONPrinter::BeginObject()
+{
+    output_ << '{';
+    indentHandler_.IncIndent();
+    firstValue_ = true;
+}
+
+void ReflectionJSONPrinter::EndObject()
+{
+    indentHandler_.DecIndent();
+    if (!firstValue_)
+        output_ << std::endl << indentHandler_.FullIndent();
+    output_ << '}';
+    firstValue_ = false;
+}
+
+void ReflectionJSONPrinter::BeginArray()
+{
+    output_ << '[';
+    indentHandler_.IncIndent();
+    firstValue_ = true;
+}
+
+void ReflectionJSONPrinter::EndArray()
+{
+    indentHandler_.DecIndent();
+    if (!firstValue_)
+        output_ << std::endl << indentHandler_.FullIndent();
+    output_ << ']';
+    firstValue_ = false;
+}
+
+void ReflectionJSONPrinter::NextValue(const char* key)
+{
+    if (!firstValue_)
+        output_ << ',';
+    output_ << std::endl << indentHandler_.FullIndent();
+
+    if (key)
+    {
+        PrintString(key);
+        output_ << ": ";
+    }
+
+    firstValue_ = false;
+}
+
+void ReflectionJSONPrinter::PrintString(const std::string& s)
+{
+    output_ << '\"';
+
+    for (auto c : s)
+    {
+        switch (c)
+        {
+            case '\"':  output_ << "\\\"";  break;
+            case '\\':  output_ << "\\\\";  break;
+            case '\n':  output_ << "\\n";   break;
+            case '\r':  output_ << "\\r";   break;
+            case '\t':  output_ << "\\t";   break;
+            default:
+            {
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char hex[8];
+                    std::snprintf(hex, sizeof(hex), "\\u%04x", static_cast<unsigned>(c));
+                    output_ << hex;
+                }
+                else
+                    output_ << c;
+            }
+            break;
+        }
+    }
+
+    output_ << '\"';
+}
+
+template <typename T>
+void ReflectionJSONPrinter::PrintRealNumber(T value)
+{
+    /* JSON does not support infinite values or NaN */
+    if (std::isfinite(value))
+        output_ << ShortestNumberString(value);
+    else
+        output_ << "null";
+}
+
+void ReflectionJSONPrinter::PrintNumber(unsigned int value)
+{
+    output_ << value;
+}
+
+void ReflectionJSONPrinter::PrintNumber(float value)
+{
+    PrintRealNumber(value);
+}
+
+void ReflectionJSONPrinter::PrintNumber(double value)
+{
+    PrintRealNumber(value);
+}
+
+void ReflectionJSONPrinter::PrintMember(const char* key, const std::string& value)
+{
+    NextValue(key);
+    PrintString(value);
+}
+
+void ReflectionJSONPrinter::PrintMember(const char* key, const char* value)
+{
+    NextValue(key);
+    PrintString(value);
+}
+
+void ReflectionJSONPrinter::PrintMember(const char* key, bool value)
+{
+    NextValue(key);
+    output_ << (value ? "true" : "false");
+}
+
+void ReflectionJSONPrinter::PrintMember(const char* key, int value)
+{
+    NextValue(key);
+    output_ << value;
+}
+
+void ReflectionJSONPrinter::PrintMember(const char* key, unsigned int value)
+{
+    NextValue(key);
+    output_ << value;
+}
+
+void ReflectionJSONPrinter::PrintMember(const char* key, float value)
+{
+    NextValue(key);
+    PrintNumber(value);
+}
+
+void ReflectionJSONPrinter::PrintMember(const char* key, double value)
+{
+    NextValue(key);
+    PrintNumber(value);
+}
+
+template <typename T>
+void ReflectionJSONPrinter::PrintInlineArray(const char* key, const T* values, std::size_t count)
+{
+    NextValue(key);
+    output_ << '[';
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (i > 0)
+            output_ << ", ";
+        PrintNumber(values[i]);
+    }
+    output_ << ']';
+}
+
+/* --- Reflection objects --- */
+
+void ReflectionJSONPrinter::PrintStrings(const char* key, const std::vector<std::string>& strings)
+{
+    NextValue(key);
+    BeginArray();
+    {
+        for (const auto& s : strings)
+        {
+            NextValue();
+            PrintString(s);
+        }
+    }
+    EndArray();
+}
+
+void ReflectionJSONPrinter::PrintFields(const std::vector<Reflection::Field>& fields)
+{
+    NextValue("fields");
+    BeginArray();
+    {
+        for (const auto& obj : fields)
+        {
+            NextValue();
+            BeginObject();
+            {
+                PrintMember     ( "name",            obj.name                              );
+                PrintMember     ( "referenced",      obj.referenced                        );
+                PrintMember     ( "type",            FieldTypeToString(obj.type)           );
+                PrintInlineArray( "dimensions",      obj.dimensions, 2                     );
+                PrintMember     ( "typeRecordIndex", obj.typeRecordIndex                   );
+                PrintMember     ( "size",            obj.size                              );
+                PrintMember     ( "offset",          obj.offset                            );
+                PrintInlineArray( "arrayElements",   obj.arrayElements.data(), obj.arrayElements.size() );
+            }
+            EndObject();
+        }
+    }
+    EndArray();
+}
+
+void ReflectionJSONPrinter::PrintAttributes(const char* key, const std::vector<Reflection::Attribute>& attributes)
+{
+    NextValue(key);
+    BeginArray();
+    {
+        for (const auto& obj : attributes)
+        {
+            NextValue();
+            BeginObject();
+            {
+                PrintMember("name",       obj.name      );
+                PrintMember("referenced", obj.referenced);
+                PrintMember("slot",       obj.slot      );
+            }
+            EndObject();
+        }
+    }
+    EndArray();
+}
+
+void ReflectionJSONPrinter::PrintIncludeFiles(const std::vector<Reflection::IncludeFile>& includeFiles)
+{
+    NextValue("includeFiles");
+    BeginArray();
+    {
+        for (const auto& obj : includeFiles)
+        {
+            /* Print 64-bit hash as hexadecimal string, since JSON numbers are not precise enough */
+            char hash[24];
+            std::snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(obj.hash));
+
+            NextValue();
+            BeginObject();
+            {
+                PrintMember("name", obj.name);
+                PrintMember("path", obj.path);
+                PrintMember("hash", hash    );
+            }
+            EndObject();
+        }
+    }
+    EndArray();
+}
+
+void ReflectionJSONPrinter::PrintRecords(const std::vector<Reflection::Record>& records)
+{
+    NextValue("records");
+    BeginArray();
+    {
+        for (const auto& obj : records)
+        {
+            NextValue();
+            BeginObject();
+            {
+                PrintMember("name",            obj.name           );
+                PrintMember("referenced",      obj.referenced     );
+                PrintMember("baseRecordIndex", obj.baseRecordIndex);
+                PrintMember("size",            obj.size           );
+                PrintMember("padding",         obj.padding        );
+                PrintFields(obj.fields);
+            }
+            EndObject();
+        }
+    }
+    EndArray();
+}
+
+void ReflectionJSONPrinter::PrintSpecConstants(const std::vector<Reflection::SpecConstant>& specConstants)
+{
+    NextValue("specConstants");
+    BeginArray();
+    {
+        for (const auto& obj : specConstants)
+        {
+            NextValue();
+            BeginObject();
+            {
+                PrintMember("name",         obj.name                   );
+                PrintMember("referenced",   obj.referenced             );
+                PrintMember("type",         FieldTypeToString(obj.type));
+                PrintMember("constantID",   obj.constantID             );
+                PrintMember("defaultValue", obj.defaultValue           );
+            }
+            EndObject();
+        }
+    }
+    EndArray();
+}
+
+void ReflectionJSONPrinter::PrintResources(const std::vector<Reflection::Resource>& resources)
+{
+    NextValue("resources");
+    BeginArray();
+    {
+        for (const auto& obj : resources)
+        {
+            NextValue();
+            BeginObject();
+            {
+                PrintMember("name",       obj.name                      );
+                PrintMember("referenced", obj.referenced                );
+                PrintMember("type",       ResourceTypeToString(obj.type));
+                PrintMember("slot",       obj.slot                      );
+                PrintMember("set",        obj.set                       );
+            }
+            EndObject();
+        }
+    }
+    EndArray();
+}
+
+void ReflectionJSONPrinter::PrintConstantBuffers(const std::vector<Reflection::ConstantBuffer>& constantBuffers)
+{
+    NextValue("constantBuffers");
+    BeginArray();
+    {
+        for (const auto& obj : constantBuffers)
+        {
+            NextValue();
+            BeginObject();
+            {
+                PrintMember("name",         obj.name                      );
+                PrintMember("referenced",   obj.referenced                );
+                PrintMember("type",         ResourceTypeToString(obj.type));
+                PrintMember("slot",         obj.slot                      );
+                PrintMember("set",          obj.set                       );
+                PrintMember("pushConstant", obj.pushConstant              );
+                PrintMember("size",         obj.size                      );
+                PrintMember("padding",      obj.padding                   );
+                PrintFields(obj.fields);
+
+                NextValue("mergedBuffers");
+                BeginArray();
+                {
+                    for (const auto& range : obj.mergedBuffers)
+                    {
+                        NextValue();
+                        BeginObject();
+                        {
+                            PrintMember("name",       range.name                                  );
+                            PrintMember("slot",       range.slot                                  );
+                            PrintMember("offset",     range.offset                                );
+                            PrintMember("size",       range.size                                  );
+                            PrintMember("firstField", static_cast<unsigned int>(range.firstField) );
+                            PrintMember("numFields",  static_cast<unsigned int>(range.numFields)  );
+                        }
+                        EndObject();
+                    }
+                }
+                EndArray();
+            }
+            EndObject();
+        }
+    }
+    EndArray();
+}
+
+void ReflectionJSONPrinter::PrintSamplerStates(const std::vector<Reflection::SamplerState>& samplerStates)
+{
+    NextValue("samplerStates");
+    BeginArray();
+    {
+        for (const auto& obj : samplerStates)
+        {
+            NextValue();
+            BeginObject();
+            {
+                PrintMember("name",       obj.name                      );
+                PrintMember("referenced", obj.referenced                );
+                PrintMember("type",       ResourceTypeToString(obj.type));
+                PrintMember("slot",       obj.slot                      );
+                PrintMember("set",        obj.set                       );
+            }
+            EndObject();
+        }
+    }
+    EndArray();
+}
+
+void ReflectionJSONPrinter::PrintStaticSamplerStates(const std::vector<Reflection::StaticSamplerState>& samplerStates)
+{
+    NextValue("staticSamplerStates");
+    BeginArray();
+    {
+        for (const auto& obj : samplerStates)
+        {
+            const auto& desc = obj.desc;
+
+            NextValue();
+            BeginObject();
+            {
+                PrintMember("name", obj.name                      );
+                PrintMember("type", ResourceTypeToString(obj.type));
+
+                NextValue("desc");
+                BeginObject();
+                {
+                    PrintMember     ( "filter",         FilterToString(desc.filter)                 );
+                    PrintMember     ( "addressU",       TexAddressModeToString(desc.addressU)       );
+                    PrintMember     ( "addressV",       TexAddressModeToString(desc.addressV)       );
+                    PrintMember     ( "addressW",       TexAddressModeToString(desc.addressW)       );
+                    PrintMember     ( "mipLODBias",     desc.mipLODBias                             );
+                    PrintMember     ( "maxAnisotropy",  desc.maxAnisotropy                          );
+                    PrintMember     ( "comparisonFunc", CompareFuncToString(desc.comparisonFunc)    );
+                    PrintInlineArray( "borderColor",    desc.borderColor, 4                         );
+                    PrintMember     ( "minLOD",         desc.minLOD                                 );
+                    PrintMember     ( "maxLOD",         desc.maxLOD                                 );
+                }
+                EndObject();
+            }
+            EndObject();
+        }
+    }
+    EndArray();
+}
+
+void ReflectionJSONPrinter::PrintNumThreads(const Reflection::NumThreads& numThreads)
+{
+    NextValue("numThreads");
+    BeginObject();
+    {
+        PrintMember("x", numThreads.x);
+        PrintMember("y", numThreads.y);
+        PrintMember("z", numThreads.z);
+    }
+    EndObject();
+}
+
+void ReflectionJSONPrinter::PrintCostEstimate(const Reflection::CostEstimate& cost)
+{
+    NextValue("cost");
+    BeginObject();
+    {
+        PrintMember ( "arithmeticOps",     cost.arithmeticOps     );
+        PrintMember ( "divisionOps",       cost.divisionOps       );
+        PrintMember ( "bitwiseOps",        cost.bitwiseOps        );
+        PrintMember ( "comparisonOps",     cost.comparisonOps     );
+        PrintMember ( "transcendentalOps", cost.transcendentalOps );
+        PrintMember ( "intrinsicCalls",    cost.intrinsicCalls    );
+        PrintMember ( "textureSamples",    cost.textureSamples    );
+        PrintMember ( "textureFetches",    cost.textureFetches    );
+        PrintMember ( "loops",             cost.loops             );
+        PrintMember ( "dynamicLoops",      cost.dynamicLoops      );
+        PrintMember ( "branches",          cost.branches          );
+        PrintMember ( "dynamicBranches",   cost.dynamicBranches   );
+        PrintMember ( "interpolators",     cost.interpolators     );
+        PrintStrings( "intrinsics",        cost.intrinsics        );
+    }
+    EndObject();
+}
+
+void ReflectionJSONPrinter::PrintRegisterPressure(const Reflection::RegisterPressure& registerPressure)
+{
+    NextValue("registerPressure");
+    BeginObject();
+    {
+        PrintMember("maxLiveComponents", registerPressure.maxLiveComponents);
+        PrintMember("temporaries",       registerPressure.temporaries);
+        PrintMember("function",          registerPressure.function);
+        PrintMember("line",              registerPressure.line);
+        PrintMember("column",            registerPressure.column);
+
+        NextValue("liveVariables");
+        BeginArray();
+        {
+            for (const auto& obj : registerPressure.liveVariables)
+            {
+                NextValue();
+                BeginObject();
+                {
+                    PrintMember("name",       obj.name);
+                    PrintMember("components", obj.components);
+                }
+                EndObject();
+            }
+        }
+        EndArray();
+    }
+    EndObject();
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
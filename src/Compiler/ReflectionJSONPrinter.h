@@ -0,0 +1,95 @@
+/*
+ * ReflectionJSONPrinter.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_REFLECTION_JSON_PRINTER_H
+#define XSC_REFLECTION_JSON_PRINTER_H
+
+
+#include <Xsc/IndentHandler.h>
+#include <Xsc/Reflection.h>
+#include <ostream>
+
+
+namespace Xsc
+{
+
+
+// Printer for the reflection data in the JSON format.
+class ReflectionJSONPrinter
+{
+
+    public:
+
+        ReflectionJSONPrinter(std::ostream& output);
+
+        void PrintReflection(const Reflection::ReflectionData& reflectionData);
+
+    private:
+
+        /* --- JSON output --- */
+
+        void BeginObject();
+        void EndObject();
+
+        void BeginArray();
+        void EndArray();
+
+        // Writes the separator and indentation for the next array element or object member with the specified key.
+        void NextValue(const char* key = nullptr);
+
+        void PrintString(const std::string& s);
+
+        template <typename T>
+        void PrintRealNumber(T value);
+
+        void PrintNumber(unsigned int value);
+        void PrintNumber(float value);
+        void PrintNumber(double value);
+
+        void PrintMember(const char* key, const std::string& value);
+        void PrintMember(const char* key, const char* value);
+        void PrintMember(const char* key, bool value);
+        void PrintMember(const char* key, int value);
+        void PrintMember(const char* key, unsigned int value);
+        void PrintMember(const char* key, float value);
+        void PrintMember(const char* key, double value);
+
+        template <typename T>
+        void PrintInlineArray(const char* key, const T* values, std::size_t count);
+
+        /* --- Reflection objects --- */
+
+        void PrintStrings(const char* key, const std::vector<std::string>& strings);
+        void PrintFields(const std::vector<Reflection::Field>& fields);
+        void PrintAttributes(const char* key, const std::vector<Reflection::Attribute>& attributes);
+
+        void PrintIncludeFiles(const std::vector<Reflection::IncludeFile>& includeFiles);
+        void PrintRecords(const std::vector<Reflection::Record>& records);
+        void PrintSpecConstants(const std::vector<Reflection::SpecConstant>& specConstants);
+        void PrintResources(const std::vector<Reflection::Resource>& resources);
+        void PrintConstantBuffers(const std::vector<Reflection::ConstantBuffer>& constantBuffers);
+        void PrintSamplerStates(const std::vector<Reflection::SamplerState>& samplerStates);
+        void PrintStaticSamplerStates(const std::vector<Reflection::StaticSamplerState>& samplerStates);
+        void PrintNumThreads(const Reflection::NumThreads& numThreads);
+        void PrintCostEstimate(const Reflection::CostEstimate& cost);
+        void PrintRegisterPressure(const Reflection::RegisterPressure& registerPressure);
+
+        std::ostream&   output_;
+        IndentHandler   indentHandler_;
+        bool            firstValue_     = true;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
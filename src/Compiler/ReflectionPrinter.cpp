@@ -7,6 +7,7 @@
 
 #include "ReflectionPrinter.h"
 #include "ReportIdents.h"
+#include "Helper.h"
 #include <algorithm>
 
 
@@ -25,15 +26,20 @@ void ReflectionPrinter::PrintReflection(const Reflection::ReflectionData& reflec
     indentHandler_.IncIndent();
     {
         PrintReflectionObjects  ( reflectionData.macros,                "Macros"                               );
+        PrintReflectionObjects  ( reflectionData.usedMacros,            "Used Macros"                          );
+        PrintReflectionObjects  ( reflectionData.includeFiles,          "Include Files"                        );
         PrintReflectionObjects  ( reflectionData.records,               "Structures",           referencedOnly );
         PrintReflectionObjects  ( reflectionData.inputAttributes,       "Input Attributes",     referencedOnly );
         PrintReflectionObjects  ( reflectionData.outputAttributes,      "Output Attributes",    referencedOnly );
         PrintReflectionObjects  ( reflectionData.uniforms,              "Uniforms",             referencedOnly );
+        PrintReflectionObjects  ( reflectionData.specConstants,         "Spec. Constants",      referencedOnly );
         PrintReflectionObjects  ( reflectionData.resources,             "Resources",            referencedOnly );
         PrintReflectionObjects  ( reflectionData.constantBuffers,       "Constant Buffers",     referencedOnly );
         PrintReflectionObjects  ( reflectionData.samplerStates,         "Sampler States",       referencedOnly );
         PrintReflectionObjects  ( reflectionData.staticSamplerStates,   "Static Sampler States"                );
         PrintReflectionAttribute( reflectionData.numThreads,            "Number of Threads"                    );
+        PrintReflectionAttribute( reflectionData.cost,                  "Cost Estimate"                        );
+        PrintReflectionAttribute( reflectionData.registerPressure,      "Register Pressure"                    );
     }
     indentHandler_.DecIndent();
 }
@@ -96,6 +102,20 @@ void ReflectionPrinter::PrintReflectionObjects(const std::vector<std::string>& i
         IndentOut() << "< none >" << std::endl;
 }
 
+void ReflectionPrinter::PrintReflectionObjects(const std::vector<Reflection::IncludeFile>& objects, const char* title)
+{
+    IndentOut() << title << ':' << std::endl;
+    ScopedIndent indent { indentHandler_ };
+
+    if (!objects.empty())
+    {
+        for (const auto& obj : objects)
+            IndentOut() << obj.path << " <Hash(" << ToHexString(obj.hash) << ")>" << std::endl;
+    }
+    else
+        IndentOut() << "< none >" << std::endl;
+}
+
 void ReflectionPrinter::PrintFields(const std::vector<Reflection::Field>& objects, bool referencedOnly)
 {
     if (!objects.empty() && (!referencedOnly || HasAnyReferencedObjects(objects)))
@@ -115,6 +135,25 @@ void ReflectionPrinter::PrintFields(const std::vector<Reflection::Field>& object
     }
 }
 
+void ReflectionPrinter::PrintBindingSet(int set)
+{
+    /* Print descriptor set only if it is not the default set */
+    if (set > 0)
+        output_ << " <set: " << set << '>';
+}
+
+void ReflectionPrinter::PrintMergedBuffers(const std::vector<Reflection::ConstantBufferRange>& objects)
+{
+    /* Print ranges of merged constant buffers */
+    for (const auto& obj : objects)
+    {
+        output_ << indentHandler_.FullIndent();
+        if (obj.slot >= 0)
+            output_ << obj.slot << ": ";
+        output_ << obj.name << " <MergedBuffer(offset: " << obj.offset << ", size: " << obj.size << ", fields: " << obj.numFields << ")>" << std::endl;
+    }
+}
+
 void ReflectionPrinter::PrintReflectionObjects(const std::vector<Reflection::Record>& objects, const char* title, bool referencedOnly)
 {
     IndentOut() << title << ':' << std::endl;
@@ -176,6 +215,35 @@ void ReflectionPrinter::PrintReflectionObjects(const std::vector<Reflection::Att
         IndentOut() << "< none >" << std::endl;
 }
 
+void ReflectionPrinter::PrintReflectionObjects(const std::vector<Reflection::SpecConstant>& objects, const char* title, bool referencedOnly)
+{
+    IndentOut() << title << ':' << std::endl;
+    ScopedIndent indent { indentHandler_ };
+
+    if (!objects.empty() && (!referencedOnly || HasAnyReferencedObjects(objects)))
+    {
+        /* Determines the offset for right-aligned constant IDs */
+        int maxConstantID = 0;
+        for (const auto& obj : objects)
+            maxConstantID = std::max(maxConstantID, obj.constantID);
+
+        auto maxConstantIDLen = std::to_string(maxConstantID).size();
+
+        /* Print constant IDs and default values */
+        for (const auto& obj : objects)
+        {
+            if (!referencedOnly || obj.referenced)
+            {
+                output_ << indentHandler_.FullIndent();
+                output_ << std::string(maxConstantIDLen - std::to_string(obj.constantID).size(), ' ') << obj.constantID << ": ";
+                output_ << obj.name << " <default: " << obj.defaultValue << '>' << std::endl;
+            }
+        }
+    }
+    else
+        IndentOut() << "< none >" << std::endl;
+}
+
 void ReflectionPrinter::PrintReflectionObjects(const std::vector<Reflection::Resource>& objects, const char* title, bool referencedOnly)
 {
     IndentOut() << title << ':' << std::endl;
@@ -200,7 +268,9 @@ void ReflectionPrinter::PrintReflectionObjects(const std::vector<Reflection::Res
                     else
                         output_ << std::string(maxSlotLen, ' ') << "  ";
                 }
-                output_ << obj.name << " <" << ToString(obj.type) << '>' << std::endl;
+                output_ << obj.name << " <" << ToString(obj.type) << '>';
+                PrintBindingSet(obj.set);
+                output_ << std::endl;
             }
         }
     }
@@ -236,11 +306,17 @@ void ReflectionPrinter::PrintReflectionObjects(const std::vector<Reflection::Con
                 output_ << obj.name << " <" << ToString(obj.type);
                 if (obj.size != ~0)
                     output_ << "(size: " << obj.size << ", padding: " << obj.padding << ')';
-                output_ << '>' << std::endl;
-
-                /* Print fields */
+                output_ << '>';
+                if (obj.pushConstant)
+                    output_ << " <push_constant>";
+                else
+                    PrintBindingSet(obj.set);
+                output_ << std::endl;
+
+                /* Print fields and merged constant buffers */
                 ScopedIndent indent { indentHandler_ };
                 PrintFields(obj.fields, referencedOnly);
+                PrintMergedBuffers(obj.mergedBuffers);
             }
         }
     }
@@ -272,7 +348,9 @@ void ReflectionPrinter::PrintReflectionObjects(const std::vector<Reflection::Sam
                     else
                         output_ << std::string(maxSlotLen, ' ') << "  ";
                 }
-                output_ << obj.name << std::endl;
+                output_ << obj.name;
+                PrintBindingSet(obj.set);
+                output_ << std::endl;
             }
         }
     }
@@ -325,6 +403,64 @@ void ReflectionPrinter::PrintReflectionAttribute(const Reflection::NumThreads& n
     }
 }
 
+void ReflectionPrinter::PrintReflectionAttribute(const Reflection::CostEstimate& cost, const char* title)
+{
+    IndentOut() << title << ':' << std::endl;
+    ScopedIndent indent { indentHandler_ };
+
+    IndentOut() << "Arithmetic Ops     = " << cost.arithmeticOps << std::endl;
+    IndentOut() << "Division Ops       = " << cost.divisionOps << std::endl;
+    IndentOut() << "Bitwise Ops        = " << cost.bitwiseOps << std::endl;
+    IndentOut() << "Comparison Ops     = " << cost.comparisonOps << std::endl;
+    IndentOut() << "Transcendental Ops = " << cost.transcendentalOps << std::endl;
+    IndentOut() << "Intrinsic Calls    = " << cost.intrinsicCalls << std::endl;
+    IndentOut() << "Texture Samples    = " << cost.textureSamples << std::endl;
+    IndentOut() << "Texture Fetches    = " << cost.textureFetches << std::endl;
+    IndentOut() << "Loops              = " << cost.loops << " (" << cost.dynamicLoops << " dynamic)" << std::endl;
+    IndentOut() << "Branches           = " << cost.branches << " (" << cost.dynamicBranches << " dynamic)" << std::endl;
+    IndentOut() << "Interpolators      = " << cost.interpolators << std::endl;
+
+    if (!cost.intrinsics.empty())
+    {
+        IndentOut() << "Intrinsics         = ";
+        for (std::size_t i = 0; i < cost.intrinsics.size(); ++i)
+        {
+            if (i > 0)
+                output_ << ", ";
+            output_ << cost.intrinsics[i];
+        }
+        output_ << std::endl;
+    }
+}
+
+void ReflectionPrinter::PrintReflectionAttribute(const Reflection::RegisterPressure& registerPressure, const char* title)
+{
+    IndentOut() << title << ':' << std::endl;
+    ScopedIndent indent { indentHandler_ };
+
+    IndentOut() << "Max Live Components = " << registerPressure.maxLiveComponents << " (" << registerPressure.temporaries << " temporaries)" << std::endl;
+
+    if (!registerPressure.function.empty())
+    {
+        IndentOut() << "Peak                = " << registerPressure.function;
+        if (registerPressure.line > 0)
+            output_ << " (" << registerPressure.line << ':' << registerPressure.column << ')';
+        output_ << std::endl;
+    }
+
+    if (!registerPressure.liveVariables.empty())
+    {
+        IndentOut() << "Live Variables      = ";
+        for (std::size_t i = 0; i < registerPressure.liveVariables.size(); ++i)
+        {
+            if (i > 0)
+                output_ << ", ";
+            output_ << registerPressure.liveVariables[i].name << " (" << registerPressure.liveVariables[i].components << ')';
+        }
+        output_ << std::endl;
+    }
+}
+
 
 } // /namespace Xsc
 
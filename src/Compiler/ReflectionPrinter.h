@@ -32,14 +32,20 @@ class ReflectionPrinter
         std::ostream& IndentOut();
 
         void PrintReflectionObjects(const std::vector<std::string>& idents, const char* title);
+        void PrintReflectionObjects(const std::vector<Reflection::IncludeFile>& objects, const char* title);
         void PrintFields(const std::vector<Reflection::Field>& objects, bool referencedOnly);
+        void PrintBindingSet(int set);
+        void PrintMergedBuffers(const std::vector<Reflection::ConstantBufferRange>& objects);
         void PrintReflectionObjects(const std::vector<Reflection::Record>& objects, const char* title, bool referencedOnly);
         void PrintReflectionObjects(const std::vector<Reflection::Attribute>& objects, const char* title, bool referencedOnly);
+        void PrintReflectionObjects(const std::vector<Reflection::SpecConstant>& objects, const char* title, bool referencedOnly);
         void PrintReflectionObjects(const std::vector<Reflection::Resource>& objects, const char* title, bool referencedOnly);
         void PrintReflectionObjects(const std::vector<Reflection::ConstantBuffer>& objects, const char* title, bool referencedOnly);
         void PrintReflectionObjects(const std::vector<Reflection::SamplerState>& objects, const char* title, bool referencedOnly);
         void PrintReflectionObjects(const std::vector<Reflection::StaticSamplerState>& samplerStates, const char* title);
         void PrintReflectionAttribute(const Reflection::NumThreads& numThreads, const char* title);
+        void PrintReflectionAttribute(const Reflection::CostEstimate& cost, const char* title);
+        void PrintReflectionAttribute(const Reflection::RegisterPressure& registerPressure, const char* title);
 
         std::ostream&   output_;
         IndentHandler   indentHandler_;
@@ -0,0 +1,745 @@
+/*
+ * ReflectionSerializer.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ReflectionSerializer.h"
+#include <algorithm>
+#include <cstring>
+
+
+namespace Xsc
+{
+
+namespace Reflection
+{
+
+
+using Binary::Table;
+
+static const char g_binaryMagic[4] = { 'X', 'S', 'R', 'F' };
+
+// Alignment (in bytes) of the memory block and all tables of a binary reflection.
+static const std::size_t g_binaryAlignment = 8;
+
+// Returns the size (in bytes) of a single entry of the specified table.
+static std::size_t GetTableEntrySize(const Table table)
+{
+    switch (table)
+    {
+        case Table::Macros:                 return sizeof(Binary::String);
+        case Table::UsedMacros:             return sizeof(Binary::String);
+        case Table::IncludeFiles:           return sizeof(Binary::IncludeFile);
+        case Table::Records:                return sizeof(Binary::Record);
+        case Table::Fields:                 return sizeof(Binary::Field);
+        case Table::ArrayElements:          return sizeof(std::uint32_t);
+        case Table::InputAttributes:        return sizeof(Binary::Attribute);
+        case Table::OutputAttributes:       return sizeof(Binary::Attribute);
+        case Table::Uniforms:               return sizeof(Binary::Attribute);
+        case Table::SpecConstants:          return sizeof(Binary::SpecConstant);
+        case Table::Resources:              return sizeof(Binary::Resource);
+        case Table::ConstantBuffers:        return sizeof(Binary::ConstantBuffer);
+        case Table::ConstantBufferRanges:   return sizeof(Binary::ConstantBufferRange);
+        case Table::SamplerStates:          return sizeof(Binary::SamplerState);
+        case Table::StaticSamplerStates:    return sizeof(Binary::StaticSamplerState);
+        case Table::Intrinsics:             return sizeof(Binary::String);
+        case Table::LiveVariables:          return sizeof(Binary::LiveVariable);
+        default:                            return 0;
+    }
+}
+
+
+/*
+ * ReflectionReader class
+ */
+
+ReflectionReader::ReflectionReader(const void* data, std::size_t size)
+{
+    Load(data, size);
+}
+
+bool ReflectionReader::Load(const void* data, std::size_t size)
+{
+    /* Reset previous binary reflection */
+    data_   = nullptr;
+    header_ = nullptr;
+
+    if (data == nullptr || size < sizeof(Binary::Header) || reinterpret_cast<std::uintptr_t>(data) % g_binaryAlignment != 0)
+        return false;
+
+    /* Validate header */
+    auto header = reinterpret_cast<const Binary::Header*>(data);
+
+    if (std::memcmp(header->magic, g_binaryMagic, sizeof(g_binaryMagic)) != 0 || header->version != Binary::version)
+        return false;
+
+    const std::uint64_t blockSize = header->size;
+    if (blockSize < sizeof(Binary::Header) || blockSize > size)
+        return false;
+
+    /* Validate string table (must be null-terminated) */
+    if (static_cast<std::uint64_t>(header->stringsOffset) + header->stringsSize > blockSize)
+        return false;
+
+    auto strings = reinterpret_cast<const char*>(data) + header->stringsOffset;
+    if (header->stringsSize > 0 && strings[header->stringsSize - 1] != '\0')
+        return false;
+
+    /* Validate all tables */
+    for (std::size_t i = 0; i < static_cast<std::size_t>(Table::Count); ++i)
+    {
+        const auto& range = header->tables[i];
+        if (range.count > 0)
+        {
+            const auto entrySize = GetTableEntrySize(static_cast<Table>(i));
+            if (range.offset % g_binaryAlignment != 0 || range.offset + static_cast<std::uint64_t>(range.count) * entrySize > blockSize)
+                return false;
+        }
+    }
+
+    /* Store valid binary reflection */
+    data_   = reinterpret_cast<const char*>(data);
+    header_ = header;
+
+    return true;
+}
+
+const char* ReflectionReader::GetString(const Binary::String& s) const
+{
+    if (header_ && static_cast<std::uint64_t>(s.offset) + s.length < header_->stringsSize)
+    {
+        auto str = data_ + header_->stringsOffset + s.offset;
+        if (str[s.length] == '\0')
+            return str;
+    }
+    return "";
+}
+
+ArrayView<Binary::String> ReflectionReader::GetMacros() const
+{
+    return GetTable<Binary::String>(Table::Macros);
+}
+
+ArrayView<Binary::String> ReflectionReader::GetUsedMacros() const
+{
+    return GetTable<Binary::String>(Table::UsedMacros);
+}
+
+ArrayView<Binary::IncludeFile> ReflectionReader::GetIncludeFiles() const
+{
+    return GetTable<Binary::IncludeFile>(Table::IncludeFiles);
+}
+
+ArrayView<Binary::Record> ReflectionReader::GetRecords() const
+{
+    return GetTable<Binary::Record>(Table::Records);
+}
+
+ArrayView<Binary::Attribute> ReflectionReader::GetInputAttributes() const
+{
+    return GetTable<Binary::Attribute>(Table::InputAttributes);
+}
+
+ArrayView<Binary::Attribute> ReflectionReader::GetOutputAttributes() const
+{
+    return GetTable<Binary::Attribute>(Table::OutputAttributes);
+}
+
+ArrayView<Binary::Attribute> ReflectionReader::GetUniforms() const
+{
+    return GetTable<Binary::Attribute>(Table::Uniforms);
+}
+
+ArrayView<Binary::SpecConstant> ReflectionReader::GetSpecConstants() const
+{
+    return GetTable<Binary::SpecConstant>(Table::SpecConstants);
+}
+
+ArrayView<Binary::Resource> ReflectionReader::GetResources() const
+{
+    return GetTable<Binary::Resource>(Table::Resources);
+}
+
+ArrayView<Binary::ConstantBuffer> ReflectionReader::GetConstantBuffers() const
+{
+    return GetTable<Binary::ConstantBuffer>(Table::ConstantBuffers);
+}
+
+ArrayView<Binary::SamplerState> ReflectionReader::GetSamplerStates() const
+{
+    return GetTable<Binary::SamplerState>(Table::SamplerStates);
+}
+
+ArrayView<Binary::StaticSamplerState> ReflectionReader::GetStaticSamplerStates() const
+{
+    return GetTable<Binary::StaticSamplerState>(Table::StaticSamplerStates);
+}
+
+ArrayView<Binary::String> ReflectionReader::GetIntrinsics() const
+{
+    return GetTable<Binary::String>(Table::Intrinsics);
+}
+
+ArrayView<Binary::LiveVariable> ReflectionReader::GetLiveVariables() const
+{
+    return GetTable<Binary::LiveVariable>(Table::LiveVariables);
+}
+
+ArrayView<Binary::Field> ReflectionReader::GetFields(const Binary::Record& record) const
+{
+    return GetTableRange<Binary::Field>(Table::Fields, record.firstField, record.numFields);
+}
+
+ArrayView<Binary::Field> ReflectionReader::GetFields(const Binary::ConstantBuffer& constantBuffer) const
+{
+    return GetTableRange<Binary::Field>(Table::Fields, constantBuffer.firstField, constantBuffer.numFields);
+}
+
+ArrayView<std::uint32_t> ReflectionReader::GetArrayElements(const Binary::Field& field) const
+{
+    return GetTableRange<std::uint32_t>(Table::ArrayElements, field.firstArrayElement, field.numArrayElements);
+}
+
+ArrayView<Binary::ConstantBufferRange> ReflectionReader::GetMergedBuffers(const Binary::ConstantBuffer& constantBuffer) const
+{
+    return GetTableRange<Binary::ConstantBufferRange>(Table::ConstantBufferRanges, constantBuffer.firstMergedBuffer, constantBuffer.numMergedBuffers);
+}
+
+/*
+ * ======= Private: =======
+ */
+
+template <typename T>
+ArrayView<T> ReflectionReader::GetTable(const Table table) const
+{
+    if (header_)
+    {
+        const auto& range = header_->tables[static_cast<std::size_t>(table)];
+        if (range.count > 0)
+            return ArrayView<T>(reinterpret_cast<const T*>(data_ + range.offset), range.count);
+    }
+    return ArrayView<T>();
+}
+
+template <typename T>
+ArrayView<T> ReflectionReader::GetTableRange(const Table table, std::uint32_t first, std::uint32_t count) const
+{
+    auto entries = GetTable<T>(table);
+    if (count > 0 && static_cast<std::uint64_t>(first) + count <= entries.size())
+        return ArrayView<T>(entries.begin() + first, count);
+    else
+        return ArrayView<T>();
+}
+
+
+} // /namespace Reflection
+
+
+/*
+ * ReflectionSerializer class
+ */
+
+using namespace Reflection;
+
+void ReflectionSerializer::Serialize(const ReflectionData& reflectionData, std::vector<char>& buffer)
+{
+    /* Convert all objects into their binary entries */
+    for (const auto& s : reflectionData.macros)
+        macros_.push_back(MakeString(s));
+
+    for (const auto& s : reflectionData.usedMacros)
+        usedMacros_.push_back(MakeString(s));
+
+    for (const auto& s : reflectionData.includeFiles)
+        includeFiles_.push_back({ MakeString(s.name), MakeString(s.path), s.hash });
+
+    for (const auto& s : reflectionData.records)
+    {
+        Binary::Record entry;
+        {
+            entry.name              = MakeString(s.name);
+            entry.referenced        = (s.referenced ? 1u : 0u);
+            entry.baseRecordIndex   = s.baseRecordIndex;
+            entry.firstField        = AppendFields(s.fields);
+            entry.numFields         = static_cast<std::uint32_t>(s.fields.size());
+            entry.size              = s.size;
+            entry.padding           = s.padding;
+        }
+        records_.push_back(entry);
+    }
+
+    AppendAttributes(inputAttributes_, reflectionData.inputAttributes);
+    AppendAttributes(outputAttributes_, reflectionData.outputAttributes);
+    AppendAttributes(uniforms_, reflectionData.uniforms);
+
+    for (const auto& s : reflectionData.specConstants)
+    {
+        Binary::SpecConstant entry;
+        {
+            entry.name              = MakeString(s.name);
+            entry.referenced        = (s.referenced ? 1u : 0u);
+            entry.type              = static_cast<std::uint32_t>(s.type);
+            entry.constantID        = s.constantID;
+            entry.reserved          = 0;
+            entry.defaultValue      = s.defaultValue;
+        }
+        specConstants_.push_back(entry);
+    }
+
+    for (const auto& s : reflectionData.resources)
+    {
+        Binary::Resource entry;
+        {
+            entry.name              = MakeString(s.name);
+            entry.referenced        = (s.referenced ? 1u : 0u);
+            entry.type              = static_cast<std::uint32_t>(s.type);
+            entry.slot              = s.slot;
+            entry.set               = s.set;
+        }
+        resources_.push_back(entry);
+    }
+
+    for (const auto& s : reflectionData.constantBuffers)
+    {
+        Binary::ConstantBuffer entry;
+        {
+            entry.name              = MakeString(s.name);
+            entry.referenced        = (s.referenced ? 1u : 0u);
+            entry.pushConstant      = (s.pushConstant ? 1u : 0u);
+            entry.type              = static_cast<std::uint32_t>(s.type);
+            entry.slot              = s.slot;
+            entry.set               = s.set;
+            entry.size              = s.size;
+            entry.padding           = s.padding;
+            entry.firstField        = AppendFields(s.fields);
+            entry.numFields         = static_cast<std::uint32_t>(s.fields.size());
+            entry.firstMergedBuffer = static_cast<std::uint32_t>(constantBufferRanges_.size());
+            entry.numMergedBuffers  = static_cast<std::uint32_t>(s.mergedBuffers.size());
+        }
+        constantBuffers_.push_back(entry);
+
+        for (const auto& range : s.mergedBuffers)
+        {
+            Binary::ConstantBufferRange rangeEntry;
+            {
+                rangeEntry.name         = MakeString(range.name);
+                rangeEntry.slot         = range.slot;
+                rangeEntry.offset       = range.offset;
+                rangeEntry.size         = range.size;
+                rangeEntry.firstField   = static_cast<std::uint32_t>(range.firstField);
+                rangeEntry.numFields    = static_cast<std::uint32_t>(range.numFields);
+            }
+            constantBufferRanges_.push_back(rangeEntry);
+        }
+    }
+
+    for (const auto& s : reflectionData.samplerStates)
+    {
+        Binary::SamplerState entry;
+        {
+            entry.name              = MakeString(s.name);
+            entry.referenced        = (s.referenced ? 1u : 0u);
+            entry.type              = static_cast<std::uint32_t>(s.type);
+            entry.slot              = s.slot;
+            entry.set               = s.set;
+        }
+        samplerStates_.push_back(entry);
+    }
+
+    for (const auto& s : reflectionData.staticSamplerStates)
+    {
+        Binary::StaticSamplerState entry;
+        {
+            entry.name              = MakeString(s.name);
+            entry.type              = static_cast<std::uint32_t>(s.type);
+            entry.filter            = static_cast<std::uint32_t>(s.desc.filter);
+            entry.addressU          = static_cast<std::uint32_t>(s.desc.addressU);
+            entry.addressV          = static_cast<std::uint32_t>(s.desc.addressV);
+            entry.addressW          = static_cast<std::uint32_t>(s.desc.addressW);
+            entry.mipLODBias        = s.desc.mipLODBias;
+            entry.maxAnisotropy     = s.desc.maxAnisotropy;
+            entry.comparisonFunc    = static_cast<std::uint32_t>(s.desc.comparisonFunc);
+            entry.minLOD            = s.desc.minLOD;
+            entry.maxLOD            = s.desc.maxLOD;
+            std::copy(std::begin(s.desc.borderColor), std::end(s.desc.borderColor), entry.borderColor);
+        }
+        staticSamplerStates_.push_back(entry);
+    }
+
+    for (const auto& s : reflectionData.cost.intrinsics)
+        intrinsics_.push_back(MakeString(s));
+
+    for (const auto& v : reflectionData.registerPressure.liveVariables)
+    {
+        Binary::LiveVariable entry;
+        {
+            entry.name          = MakeString(v.name);
+            entry.components    = v.components;
+        }
+        liveVariables_.push_back(entry);
+    }
+
+    /* Write header placeholder (zero-initialized) */
+    buffer_ = (&buffer);
+    buffer.assign(sizeof(Binary::Header), 0);
+
+    std::memset(&header_, 0, sizeof(header_));
+    std::copy(std::begin(g_binaryMagic), std::end(g_binaryMagic), header_.magic);
+
+    header_.version         = Binary::version;
+    header_.numThreads[0]   = reflectionData.numThreads.x;
+    header_.numThreads[1]   = reflectionData.numThreads.y;
+    header_.numThreads[2]   = reflectionData.numThreads.z;
+
+    const auto& cost = reflectionData.cost;
+    {
+        header_.cost.arithmeticOps      = cost.arithmeticOps;
+        header_.cost.divisionOps        = cost.divisionOps;
+        header_.cost.bitwiseOps         = cost.bitwiseOps;
+        header_.cost.comparisonOps      = cost.comparisonOps;
+        header_.cost.transcendentalOps  = cost.transcendentalOps;
+        header_.cost.intrinsicCalls     = cost.intrinsicCalls;
+        header_.cost.textureSamples     = cost.textureSamples;
+        header_.cost.textureFetches     = cost.textureFetches;
+        header_.cost.loops              = cost.loops;
+        header_.cost.dynamicLoops       = cost.dynamicLoops;
+        header_.cost.branches           = cost.branches;
+        header_.cost.dynamicBranches    = cost.dynamicBranches;
+        header_.cost.interpolators      = cost.interpolators;
+    }
+
+    const auto& registerPressure = reflectionData.registerPressure;
+    {
+        header_.registerPressure.maxLiveComponents  = registerPressure.maxLiveComponents;
+        header_.registerPressure.temporaries        = registerPressure.temporaries;
+        header_.registerPressure.function           = MakeString(registerPressure.function);
+        header_.registerPressure.line               = registerPressure.line;
+        header_.registerPressure.column             = registerPressure.column;
+    }
+
+    /* Write all tables */
+    WriteTable( Table::Macros,               macros_               );
+    WriteTable( Table::UsedMacros,           usedMacros_           );
+    WriteTable( Table::IncludeFiles,         includeFiles_         );
+    WriteTable( Table::Records,              records_              );
+    WriteTable( Table::Fields,               fields_               );
+    WriteTable( Table::ArrayElements,        arrayElements_        );
+    WriteTable( Table::InputAttributes,      inputAttributes_      );
+    WriteTable( Table::OutputAttributes,     outputAttributes_     );
+    WriteTable( Table::Uniforms,             uniforms_             );
+    WriteTable( Table::SpecConstants,        specConstants_        );
+    WriteTable( Table::Resources,            resources_            );
+    WriteTable( Table::ConstantBuffers,      constantBuffers_      );
+    WriteTable( Table::ConstantBufferRanges, constantBufferRanges_ );
+    WriteTable( Table::SamplerStates,        samplerStates_        );
+    WriteTable( Table::StaticSamplerStates,  staticSamplerStates_  );
+    WriteTable( Table::Intrinsics,           intrinsics_           );
+    WriteTable( Table::LiveVariables,        liveVariables_        );
+
+    /* Write string table */
+    header_.stringsOffset   = static_cast<std::uint32_t>(buffer.size());
+    header_.stringsSize     = static_cast<std::uint32_t>(strings_.size());
+    buffer.insert(buffer.end(), strings_.begin(), strings_.end());
+
+    /* Pad the memory block, so that multiple binary reflections can be stored consecutively */
+    buffer.resize((buffer.size() + g_binaryAlignment - 1) / g_binaryAlignment * g_binaryAlignment, 0);
+
+    /* Write final header */
+    header_.size = static_cast<std::uint32_t>(buffer.size());
+    std::memcpy(buffer.data(), &header_, sizeof(header_));
+}
+
+// Converts the specified binary fields into reflection fields.
+static void DeserializeFields(const ReflectionReader& reader, const ArrayView<Binary::Field>& src, std::vector<Field>& dst)
+{
+    for (const auto& s : src)
+    {
+        Field field;
+        {
+            field.referenced        = (s.referenced != 0);
+            field.name              = reader.GetString(s.name);
+            field.type              = static_cast<FieldType>(s.type);
+            field.dimensions[0]     = s.dimensions[0];
+            field.dimensions[1]     = s.dimensions[1];
+            field.typeRecordIndex   = s.typeRecordIndex;
+            field.size              = s.size;
+            field.offset            = s.offset;
+
+            auto arrayElements = reader.GetArrayElements(s);
+            field.arrayElements.assign(arrayElements.begin(), arrayElements.end());
+        }
+        dst.push_back(field);
+    }
+}
+
+// Converts the specified binary attributes into reflection attributes.
+static void DeserializeAttributes(const ReflectionReader& reader, const ArrayView<Binary::Attribute>& src, std::vector<Attribute>& dst)
+{
+    for (const auto& s : src)
+    {
+        Attribute attrib { reader.GetString(s.name), s.slot };
+        attrib.referenced = (s.referenced != 0);
+        dst.push_back(attrib);
+    }
+}
+
+void ReflectionSerializer::Deserialize(const ReflectionReader& reader, ReflectionData& reflectionData)
+{
+    ReflectionData data;
+
+    for (const auto& s : reader.GetMacros())
+        data.macros.push_back(reader.GetString(s));
+
+    for (const auto& s : reader.GetUsedMacros())
+        data.usedMacros.push_back(reader.GetString(s));
+
+    for (const auto& s : reader.GetIncludeFiles())
+    {
+        IncludeFile includeFile;
+        {
+            includeFile.name    = reader.GetString(s.name);
+            includeFile.path    = reader.GetString(s.path);
+            includeFile.hash    = s.hash;
+        }
+        data.includeFiles.push_back(includeFile);
+    }
+
+    for (const auto& s : reader.GetRecords())
+    {
+        Record record;
+        {
+            record.referenced       = (s.referenced != 0);
+            record.name             = reader.GetString(s.name);
+            record.baseRecordIndex  = s.baseRecordIndex;
+            record.size             = s.size;
+            record.padding          = s.padding;
+            DeserializeFields(reader, reader.GetFields(s), record.fields);
+        }
+        data.records.push_back(record);
+    }
+
+    DeserializeAttributes(reader, reader.GetInputAttributes(), data.inputAttributes);
+    DeserializeAttributes(reader, reader.GetOutputAttributes(), data.outputAttributes);
+    DeserializeAttributes(reader, reader.GetUniforms(), data.uniforms);
+
+    for (const auto& s : reader.GetSpecConstants())
+    {
+        SpecConstant specConstant;
+        {
+            specConstant.referenced     = (s.referenced != 0);
+            specConstant.name           = reader.GetString(s.name);
+            specConstant.type           = static_cast<FieldType>(s.type);
+            specConstant.constantID     = s.constantID;
+            specConstant.defaultValue   = s.defaultValue;
+        }
+        data.specConstants.push_back(specConstant);
+    }
+
+    for (const auto& s : reader.GetResources())
+    {
+        Resource resource;
+        {
+            resource.referenced = (s.referenced != 0);
+            resource.type       = static_cast<ResourceType>(s.type);
+            resource.name       = reader.GetString(s.name);
+            resource.slot       = s.slot;
+            resource.set        = s.set;
+        }
+        data.resources.push_back(resource);
+    }
+
+    for (const auto& s : reader.GetConstantBuffers())
+    {
+        ConstantBuffer constantBuffer;
+        {
+            constantBuffer.referenced   = (s.referenced != 0);
+            constantBuffer.type         = static_cast<ResourceType>(s.type);
+            constantBuffer.name         = reader.GetString(s.name);
+            constantBuffer.slot         = s.slot;
+            constantBuffer.set          = s.set;
+            constantBuffer.pushConstant = (s.pushConstant != 0);
+            constantBuffer.size         = s.size;
+            constantBuffer.padding      = s.padding;
+            DeserializeFields(reader, reader.GetFields(s), constantBuffer.fields);
+
+            for (const auto& range : reader.GetMergedBuffers(s))
+            {
+                ConstantBufferRange mergedBuffer;
+                {
+                    mergedBuffer.name       = reader.GetString(range.name);
+                    mergedBuffer.slot       = range.slot;
+                    mergedBuffer.offset     = range.offset;
+                    mergedBuffer.size       = range.size;
+                    mergedBuffer.firstField = range.firstField;
+                    mergedBuffer.numFields  = range.numFields;
+                }
+                constantBuffer.mergedBuffers.push_back(mergedBuffer);
+            }
+        }
+        data.constantBuffers.push_back(constantBuffer);
+    }
+
+    for (const auto& s : reader.GetSamplerStates())
+    {
+        SamplerState samplerState;
+        {
+            samplerState.type       = static_cast<ResourceType>(s.type);
+            samplerState.name       = reader.GetString(s.name);
+            samplerState.slot       = s.slot;
+            samplerState.set        = s.set;
+            samplerState.referenced = (s.referenced != 0);
+        }
+        data.samplerStates.push_back(samplerState);
+    }
+
+    for (const auto& s : reader.GetStaticSamplerStates())
+    {
+        StaticSamplerState samplerState;
+        {
+            samplerState.type                   = static_cast<ResourceType>(s.type);
+            samplerState.name                   = reader.GetString(s.name);
+            samplerState.desc.filter            = static_cast<Filter>(s.filter);
+            samplerState.desc.addressU          = static_cast<TextureAddressMode>(s.addressU);
+            samplerState.desc.addressV          = static_cast<TextureAddressMode>(s.addressV);
+            samplerState.desc.addressW          = static_cast<TextureAddressMode>(s.addressW);
+            samplerState.desc.mipLODBias        = s.mipLODBias;
+            samplerState.desc.maxAnisotropy     = s.maxAnisotropy;
+            samplerState.desc.comparisonFunc    = static_cast<ComparisonFunc>(s.comparisonFunc);
+            samplerState.desc.minLOD            = s.minLOD;
+            samplerState.desc.maxLOD            = s.maxLOD;
+            std::copy(std::begin(s.borderColor), std::end(s.borderColor), samplerState.desc.borderColor);
+        }
+        data.staticSamplerStates.push_back(samplerState);
+    }
+
+    if (auto header = reader.GetHeader())
+    {
+        data.numThreads.x = header->numThreads[0];
+        data.numThreads.y = header->numThreads[1];
+        data.numThreads.z = header->numThreads[2];
+
+        auto& cost = data.cost;
+        {
+            cost.arithmeticOps      = header->cost.arithmeticOps;
+            cost.divisionOps        = header->cost.divisionOps;
+            cost.bitwiseOps         = header->cost.bitwiseOps;
+            cost.comparisonOps      = header->cost.comparisonOps;
+            cost.transcendentalOps  = header->cost.transcendentalOps;
+            cost.intrinsicCalls     = header->cost.intrinsicCalls;
+            cost.textureSamples     = header->cost.textureSamples;
+            cost.textureFetches     = header->cost.textureFetches;
+            cost.loops              = header->cost.loops;
+            cost.dynamicLoops       = header->cost.dynamicLoops;
+            cost.branches           = header->cost.branches;
+            cost.dynamicBranches    = header->cost.dynamicBranches;
+            cost.interpolators      = header->cost.interpolators;
+        }
+
+        auto& registerPressure = data.registerPressure;
+        {
+            registerPressure.maxLiveComponents  = header->registerPressure.maxLiveComponents;
+            registerPressure.temporaries        = header->registerPressure.temporaries;
+            registerPressure.function           = reader.GetString(header->registerPressure.function);
+            registerPressure.line               = header->registerPressure.line;
+            registerPressure.column             = header->registerPressure.column;
+        }
+    }
+
+    for (const auto& s : reader.GetIntrinsics())
+        data.cost.intrinsics.push_back(reader.GetString(s));
+
+    for (const auto& v : reader.GetLiveVariables())
+    {
+        Reflection::LiveVariable liveVar;
+        {
+            liveVar.name        = reader.GetString(v.name);
+            liveVar.components  = v.components;
+        }
+        data.registerPressure.liveVariables.push_back(liveVar);
+    }
+
+    reflectionData = std::move(data);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+Binary::String ReflectionSerializer::MakeString(const std::string& s)
+{
+    auto it = stringRefs_.find(s);
+    if (it != stringRefs_.end())
+        return it->second;
+
+    /* Append null-terminated string to the string table */
+    Binary::String ref;
+    {
+        ref.offset = static_cast<std::uint32_t>(strings_.size());
+        ref.length = static_cast<std::uint32_t>(s.size());
+    }
+    strings_.append(s.c_str(), s.size() + 1);
+
+    stringRefs_[s] = ref;
+    return ref;
+}
+
+std::uint32_t ReflectionSerializer::AppendFields(const std::vector<Field>& fields)
+{
+    const auto firstField = static_cast<std::uint32_t>(fields_.size());
+
+    for (const auto& s : fields)
+    {
+        Binary::Field entry;
+        {
+            entry.name              = MakeString(s.name);
+            entry.referenced        = (s.referenced ? 1u : 0u);
+            entry.type              = static_cast<std::uint32_t>(s.type);
+            entry.dimensions[0]     = s.dimensions[0];
+            entry.dimensions[1]     = s.dimensions[1];
+            entry.typeRecordIndex   = s.typeRecordIndex;
+            entry.size              = s.size;
+            entry.offset            = s.offset;
+            entry.firstArrayElement = static_cast<std::uint32_t>(arrayElements_.size());
+            entry.numArrayElements  = static_cast<std::uint32_t>(s.arrayElements.size());
+        }
+        fields_.push_back(entry);
+
+        arrayElements_.insert(arrayElements_.end(), s.arrayElements.begin(), s.arrayElements.end());
+    }
+
+    return firstField;
+}
+
+void ReflectionSerializer::AppendAttributes(std::vector<Binary::Attribute>& dst, const std::vector<Attribute>& src)
+{
+    for (const auto& s : src)
+        dst.push_back({ MakeString(s.name), (s.referenced ? 1u : 0u), s.slot });
+}
+
+template <typename T>
+void ReflectionSerializer::WriteTable(const Table table, const std::vector<T>& entries)
+{
+    /* Align table offset */
+    auto& buffer = *buffer_;
+    buffer.resize((buffer.size() + g_binaryAlignment - 1) / g_binaryAlignment * g_binaryAlignment, 0);
+
+    auto& range = header_.tables[static_cast<std::size_t>(table)];
+    range.offset    = static_cast<std::uint32_t>(buffer.size());
+    range.count     = static_cast<std::uint32_t>(entries.size());
+
+    if (!entries.empty())
+    {
+        auto data = reinterpret_cast<const char*>(entries.data());
+        buffer.insert(buffer.end(), data, data + entries.size() * sizeof(T));
+    }
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
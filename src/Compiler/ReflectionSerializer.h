@@ -0,0 +1,86 @@
+/*
+ * ReflectionSerializer.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_REFLECTION_SERIALIZER_H
+#define XSC_REFLECTION_SERIALIZER_H
+
+
+#include <Xsc/Reflection.h>
+#include <string>
+#include <vector>
+#include <map>
+
+
+namespace Xsc
+{
+
+
+// Serializer for the binary reflection format (see Reflection::Binary).
+class ReflectionSerializer
+{
+
+    public:
+
+        // Serializes the specified reflection data into the binary reflection format.
+        void Serialize(const Reflection::ReflectionData& reflectionData, std::vector<char>& buffer);
+
+        // Deserializes the reflection data from the binary reflection of the specified (valid) reader.
+        static void Deserialize(const Reflection::ReflectionReader& reader, Reflection::ReflectionData& reflectionData);
+
+    private:
+
+        /* === Functions === */
+
+        // Returns the reference of the specified string within the string table (equal strings are only stored once).
+        Reflection::Binary::String MakeString(const std::string& s);
+
+        // Appends the specified fields (of a record or constant buffer) to the fields table and returns the index of the first field.
+        std::uint32_t AppendFields(const std::vector<Reflection::Field>& fields);
+
+        void AppendAttributes(std::vector<Reflection::Binary::Attribute>& dst, const std::vector<Reflection::Attribute>& src);
+
+        // Appends the specified table to the buffer with an 8-byte alignment.
+        template <typename T>
+        void WriteTable(const Reflection::Binary::Table table, const std::vector<T>& entries);
+
+        /* === Members === */
+
+        std::vector<char>*                                      buffer_                 = nullptr;
+        Reflection::Binary::Header                              header_;
+
+        std::string                                             strings_;
+        std::map<std::string, Reflection::Binary::String>       stringRefs_;
+
+        std::vector<Reflection::Binary::String>                 macros_;
+        std::vector<Reflection::Binary::String>                 usedMacros_;
+        std::vector<Reflection::Binary::IncludeFile>            includeFiles_;
+        std::vector<Reflection::Binary::Record>                 records_;
+        std::vector<Reflection::Binary::Field>                  fields_;
+        std::vector<std::uint32_t>                              arrayElements_;
+        std::vector<Reflection::Binary::Attribute>              inputAttributes_;
+        std::vector<Reflection::Binary::Attribute>              outputAttributes_;
+        std::vector<Reflection::Binary::Attribute>              uniforms_;
+        std::vector<Reflection::Binary::SpecConstant>           specConstants_;
+        std::vector<Reflection::Binary::Resource>               resources_;
+        std::vector<Reflection::Binary::ConstantBuffer>         constantBuffers_;
+        std::vector<Reflection::Binary::ConstantBufferRange>    constantBufferRanges_;
+        std::vector<Reflection::Binary::SamplerState>           samplerStates_;
+        std::vector<Reflection::Binary::StaticSamplerState>     staticSamplerStates_;
+        std::vector<Reflection::Binary::String>                 intrinsics_;
+        std::vector<Reflection::Binary::LiveVariable>           liveVariables_;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -16,6 +16,7 @@ DECL_REPORT( Warning,                           "warning"
 DECL_REPORT( Error,                             "error"                                                                                                         );
 DECL_REPORT( CodeGenerationError,               "code generation error"                                                                                         );
 DECL_REPORT( CodeReflection,                    "code reflection"                                                                                               );
+DECL_REPORT( CompileStatistics,                 "compile statistics"                                                                                            );
 DECL_REPORT( SyntaxError,                       "syntax error"                                                                                                  );
 DECL_REPORT( ContextError,                      "context error"                                                                                                 );
 DECL_REPORT( InternalError,                     "internal error"                                                                                                );
@@ -120,6 +121,7 @@ DECL_REPORT( InvalidNumElementsInInitializer,   "invalid number of elements in i
 DECL_REPORT( NotEnoughElementsInInitializer,    "not enough elements in initializer expression"                                                                 );
 DECL_REPORT( NotEnoughIndicesForInitializer,    "not enough array indices specified for initializer expression"                                                 );
 DECL_REPORT( ArrayIndexOutOfBounds,             "array index out of bounds[: {0} is not in range \\[0, {1})]"                                                   );
+DECL_REPORT( CantCopyASTNode,                   "cannot copy AST node"                                                                                          );
 
 /* ----- ASTEnums ----- */
 
@@ -305,6 +307,8 @@ DECL_REPORT( TextureCubeArray,                  "texture cube array"
 DECL_REPORT( RWStructuredBufferObject,          "RW structured buffer object"                                                                                   );
 DECL_REPORT( RWTextureObject,                   "RW texture object"                                                                                             );
 DECL_REPORT( PackOffsetLayout,                  "pack offset layout"                                                                                            );
+DECL_REPORT( VaryingLocation,                   "explicit varying location"                                                                                     );
+DECL_REPORT( PackedVarying,                     "packed varying"                                                                                                );
 DECL_REPORT( ConstantBuffer,                    "constant buffer"                                                                                               );
 DECL_REPORT( ExplicitBindingSlot,               "explicit binding slot"                                                                                         );
 DECL_REPORT( MultiSampledTexture,               "multi-sampled texture"                                                                                         );
@@ -337,6 +341,9 @@ DECL_REPORT( NotAllStorageClassesMappedToGLSL,  "not all storage classes can be
 DECL_REPORT( NotAllInterpModMappedToGLSL,       "not all interpolation modifiers can be mapped to GLSL keywords"                                                );
 DECL_REPORT( CantTranslateSamplerToGLSL,        "cannot translate sampler state object to GLSL sampler"                                                         );
 DECL_REPORT( MissingArrayPrefixForIOSemantic,   "missing array prefix expression for input/output semantic[ '{0}']"                                             );
+DECL_REPORT( CantMatchBufferMemberLayout,       "cannot match HLSL packing of member '{0}' in constant buffer '{1}' with std140 layout"                         );
+DECL_REPORT( PushConstantBufferNotFound,        "push constant buffer '{0}' specified but not found"                                                            );
+DECL_REPORT( PushConstantBufferTooLarge,        "size of push constant buffer '{0}' ({1} bytes) exceeds the guaranteed limit of {2} bytes"                      );
 
 /* ----- GLSLPreProcessor ----- */
 
@@ -384,6 +391,7 @@ DECL_REPORT( KeywordNotSupportedYet,            "keyword[ '{0}'] is currently no
 /* ----- HLSLParser ----- */
 
 DECL_REPORT( UnknownAttribute,                  "unknown attribute: '{0}'"                                                                                      );
+DECL_REPORT( InvalidRegisterSpace,              "invalid register space '{0}' (expected 'space' followed by an index)"                                          );
 DECL_REPORT( UnknownSlotRegister,               "unknown slot register: '{0}'"                                                                                  );
 DECL_REPORT( ExpectedExplicitArrayDim,          "explicit array dimension expected"                                                                             );
 DECL_REPORT( ExpectedVarOrAssignOrFuncCall,     "expected variable declaration, assignment, or function call statement"                                         );
@@ -484,6 +492,11 @@ DECL_REPORT( MemberVarsCantHaveDefaultValues,   "member variables cannot have de
 DECL_REPORT( DeclTypeDiffersFromDefType,        "declaration type '{0}' differs from definition type '{1}'"                                                     );
 DECL_REPORT( ArrayTypeCanOnlyAppearInDef,       "array type can only appear in definition of static member variables[: '{0}']"                                  );
 DECL_REPORT( FuncCallShadowsClassIntrinsic,     "function call shadows class intrinsic '{0}'"                                                                   );
+DECL_REPORT( InvalidSpecConstant,               "specialization constant '{0}' must be a global constant of scalar type with a constant initializer"            );
+DECL_REPORT( InvalidSpecConstantID,             "invalid specialization constant ID {0} for '{1}'"                                                              );
+DECL_REPORT( DuplicateSpecConstantID,           "specialization constant ID {0} is already used by '{1}'"                                                       );
+DECL_REPORT( UndeclaredSpecConstant,            "undeclared identifier '{0}' for specialization constant"                                                       );
+DECL_REPORT( SpecConstantsRequireVKSL,          "specialization constants are only supported for VKSL output"                                                   );
 
 /* ----- Instruction ----- */
 
@@ -508,12 +521,14 @@ DECL_REPORT( OutputStreamCantBeNull,            "output stream must not be null"
 DECL_REPORT( NameManglingPrefixResCantBeEmpty,  "name mangling prefix for reserved words must not be empty"                                                     );
 DECL_REPORT( NameManglingPrefixTmpCantBeEmpty,  "name mangling prefix for temporary variables must not be empty"                                                );
 DECL_REPORT( OverlappingNameManglingPrefixes,   "overlapping name mangling prefixes"                                                                            );
+DECL_REPORT( MismatchingShaderStageCount,       "number of input and output descriptors for shader stages must be equal"                                        );
 DECL_REPORT( LangExtensionsNotSupported,        "compiler was not build with language extensions"                                                               );
 DECL_REPORT( PreProcessingSourceFailed,         "preprocessing input code failed"                                                                               );
 DECL_REPORT( ParsingSourceFailed,               "parsing input code failed"                                                                                     );
 DECL_REPORT( AnalyzingSourceFailed,             "analyzing input code failed"                                                                                   );
 DECL_REPORT( GeneratingOutputCodeFailed,        "generating output code failed"                                                                                 );
 DECL_REPORT( GLSLFrontendIsIncomplete,          "GLSL frontend is incomplete"                                                                                   );
+DECL_REPORT( CantSpecializeUniform,             "cannot specialize uniform \"{0}\" (expected global uniform or constant buffer member of scalar type)"          );
 DECL_REPORT( InvalidILForDisassembling,         "invalid intermediate language for disassembling"                                                               );
 DECL_REPORT( NotBuildWithSPIRV,                 "compiler was not build with SPIR-V"                                                                            );
 
@@ -557,11 +572,25 @@ DECL_REPORT( CmdHelpDetailsWarn,                "all           => all kinds of w
                                                 "unused-vars   => warn for unused variables"                                                                    );
 DECL_REPORT( CmdHelpShowAST,                    "Enables/disables debug output for the AST (Abstract Syntax Tree); default={0}"                                 );
 DECL_REPORT( CmdHelpShowTimes,                  "Enables/disables debug output for timings of each compilation step; default={0}"                               );
+DECL_REPORT( CmdHelpShowStats,                  "Enables/disables compile statistics output (timings of all passes, token and AST node counts); default={0}"    );
+DECL_REPORT( CmdHelpTrace,                      "Writes timings of all compiler stages and passes of all compiled files to FILE (Trace Event Format in JSON)"   );
 DECL_REPORT( CmdHelpReflect,                    "Enables/disables code reflection output; default={0}"                                                          );
+DECL_REPORT( CmdHelpReflectOnly,                "Enables/disables to only analyze source code for code reflection (implies --reflect); default={0}"             );
+DECL_REPORT( CmdHelpReflectOut,                 "Writes code reflection to FILE in binary format, or in JSON format for '*.json'"                               );
 DECL_REPORT( CmdHelpPPOnly,                     "Enables/disables to only preprocess source code; default={0}"                                                  );
+DECL_REPORT( CmdHelpDependencies,               "Enables/disables writing include dependencies to '<OUTPUT>.d' (Makefile format); default={0}"                  );
 DECL_REPORT( CmdHelpMacro,                      "Adds the identifier <IDENT> to the pre-defined macros with an optional VALUE"                                  );
 DECL_REPORT( CmdHelpSemantic,                   "Adds the vertex semantic <IDENT> binding to VALUE (Requires -EB)"                                              );
 DECL_REPORT( CmdHelpPackUniforms,               "Packs global uniforms into a single constant buffer; default={0}"                                              );
+DECL_REPORT( CmdHelpReorderUniforms,            "Reorders members of packed uniforms and 'reorder_members' cbuffers to minimize size; default={0}"              );
+DECL_REPORT( CmdHelpMatchLayout,                "Lays out cbuffer members with the HLSL packing rules (offsets for VKSL, padding for GLSL); default={0}"        );
+DECL_REPORT( CmdHelpMergeBuffers,               "Merges cbuffers of equal update frequency, or of at most SIZE bytes, into a single uniform buffer"             );
+DECL_REPORT( CmdHelpCompactBindings,            "Maps register spaces to descriptor sets and compacts their bindings (only for VKSL output); default={0}"       );
+DECL_REPORT( CmdHelpPushConstants,              "Maps the cbuffer <IDENT> to a push constant block (only for VKSL output)"                                      );
+DECL_REPORT( CmdHelpUniformValue,               "Specializes the shader by replacing the uniform <IDENT> with the constant VALUE"                               );
+DECL_REPORT( CmdHelpSpecConstant,               "Declares the global constant <IDENT> as specialization constant with the constant ID (only for VKSL output)"   );
+DECL_REPORT( CmdHelpInferPrecision,             "Infers the precision qualifiers by semantics and usage (only for ESSL output); default={0}"                    );
+DECL_REPORT( CmdHelpLinkStage,                  "Links the varyings with the entry point <ENTRY> of the shader stage TARGET in the same input file"             );
 DECL_REPORT( CmdHelpPause,                      "Waits for user input after the translation process"                                                            );
 DECL_REPORT( CmdHelpPresetting,                 "Parse further arguments from the presetting file"                                                              );
 DECL_REPORT( CmdHelpVersion,                    "Prints the version information"                                                                                );
@@ -569,6 +598,7 @@ DECL_REPORT( CmdHelpHelp,                       "Prints the help reference"
 DECL_REPORT( CmdHelpVerbose,                    "Enables/disables more output for compiler reports; default={0}"                                                );
 DECL_REPORT( CmdHelpColor,                      "Enables/disables color highlighting for shell output; default={0}"                                             );
 DECL_REPORT( CmdHelpOptimize,                   "Enables/disables optimization; default={0}"                                                                    );
+DECL_REPORT( CmdHelpReachableOnly,              "Enables/disables analyzing only the functions reachable from the entry point; default={0}"                    );
 DECL_REPORT( CmdHelpExtension,                  "Enables/disables shader extension output; default={0}"                                                         );
 DECL_REPORT( CmdHelpEnumExtension,              "Enumerates all supported GLSL extensions"                                                                      );
 DECL_REPORT( CmdHelpValidate,                   "Enables/disables to only validate source code; default={0}"                                                    );
@@ -609,6 +639,9 @@ DECL_REPORT( InvalidFormattingType,             "invalid formatting type[: '{0}'
 DECL_REPORT( InvalidPrefixType,                 "invalid prefix type[: '{0}']"                                                                                  );
 DECL_REPORT( InvalidNameManglingType,           "invalid name-mangling type[: '{0}']"                                                                           );
 DECL_REPORT( VertexAttribValueExpectedFor,      "vertex attribute value expected for \"{0}\""                                                                   );
+DECL_REPORT( UniformValueExpectedFor,           "uniform value expected for \"{0}\""                                                                            );
+DECL_REPORT( SpecConstantIDExpectedFor,         "specialization constant ID expected for \"{0}\""                                                               );
+DECL_REPORT( EntryPointExpectedFor,             "entry point expected for \"{0}\""                                                                              );
 DECL_REPORT( LoopInPresettingFiles,             "loop in presetting files detected"                                                                             );
 DECL_REPORT( RunPresetting,                     "run presetting[: \"{0}\"]"                                                                                     );
 DECL_REPORT( ChoosePresetting,                  "choose presetting"                                                                                             );
@@ -626,10 +659,15 @@ DECL_REPORT( AttributeRequiresExtension,        "attribute '{0}' requires langua
 DECL_REPORT( IllegalVectorSpaceAssignment,      "illegal assignment of '{0}' vector-space to '{1}' vector-space"                                                );
 DECL_REPORT( InconsistVectorSpacesInTypes,      "inconsistent vector-spaces between type denoters[ (found '{0}' and '{1}')]"                                    );
 DECL_REPORT( ExpectedIdentInSpaceAttr,          "expected identifier as argument in 'space' attribute"                                                          );
+DECL_REPORT( InvalidConstantIDAttr,             "'constant_id' attribute can only be used for a single global constant"                                         );
+DECL_REPORT( InvalidConstantBufferAttr,         "'{0}' attribute can only be used for constant buffers"                                                         );
 DECL_REPORT( CmdHelpLanguageExtension,          "Enables/disables the specified language extension; default={0}; valid types:"                                  );
-DECL_REPORT( CmdHelpDetailsLanguageExtension,   "all         => all kinds of extensions\n"                                  \
-                                                "attr-layout => enable 'layout' attribute to specify image layout format\n" \
-                                                "attr-space  => enable 'space' attribute for a stronger type system"                                            );
+DECL_REPORT( CmdHelpDetailsLanguageExtension,   "all                   => all kinds of extensions\n"                                     \
+                                                "attr-constant-id      => enable 'constant_id' attribute for specialization constants\n" \
+                                                "attr-layout           => enable 'layout' attribute to specify image layout format\n"    \
+                                                "attr-reorder-members  => enable 'reorder_members' attribute for constant buffers\n"     \
+                                                "attr-space            => enable 'space' attribute for a stronger type system\n"         \
+                                                "attr-update-frequency => enable 'update_frequency' attribute for constant buffers"                             );
 DECL_REPORT( InvalidExtensionType,              "invalid extension type[: '{0}']"                                                                               );
 
 #endif
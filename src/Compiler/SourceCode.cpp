@@ -23,29 +23,37 @@ bool SourceCode::IsValid() const
     return (stream_ != nullptr && stream_->good());
 }
 
-char SourceCode::Next()
+void SourceCode::AppendRun(std::string& out, unsigned char charClass)
 {
-    /* Check if reader is at end-of-line */
-    while (pos_.Column() >= currentLine_.size())
-    {
-        /* Check if end-of-file is reached */
-        if (!IsValid() || stream_->eof())
-            return 0;
+    const auto begin = pos_.Column();
 
-        /* Read new line in source file */
-        std::getline(*stream_, currentLine_);
-        currentLine_ += '\n';
-        pos_.IncRow();
+    auto end = begin;
+    for (auto n = currentLine_.size(); end < n && IsCharClass(currentLine_[end], charClass); ++end);
 
-        /* Store current line for later reports */
-        lines_.push_back(currentLine_);
-    }
+    out.append(currentLine_, begin, end - begin);
+    pos_.IncColumn(end - begin);
+}
 
-    /* Increment column and return current character */
-    auto chr = currentLine_[pos_.Column()];
-    pos_.IncColumn();
+void SourceCode::AppendUntil(std::string& out, const char* delimiters)
+{
+    const auto begin = pos_.Column();
 
-    return chr;
+    auto end = currentLine_.find_first_of(delimiters, begin);
+    if (end == std::string::npos)
+        end = currentLine_.size();
+
+    out.append(currentLine_, begin, end - begin);
+    pos_.IncColumn(static_cast<unsigned int>(end - begin));
+}
+
+void SourceCode::IgnoreRun(unsigned char charClass)
+{
+    const auto begin = pos_.Column();
+
+    auto end = begin;
+    for (auto n = currentLine_.size(); end < n && IsCharClass(currentLine_[end], charClass); ++end);
+
+    pos_.IncColumn(end - begin);
 }
 
 // Builds the line marker for reports (e.g. "^~~~~~~")
@@ -134,6 +142,31 @@ std::string SourceCode::GetLine(std::size_t lineIndex) const
     return (lineIndex < lines_.size() ? lines_[lineIndex] : "");
 }
 
+char SourceCode::NextLine()
+{
+    /* Check if reader is at end-of-line */
+    while (pos_.Column() >= currentLine_.size())
+    {
+        /* Check if end-of-file is reached */
+        if (!IsValid() || stream_->eof())
+            return 0;
+
+        /* Read new line in source file */
+        std::getline(*stream_, currentLine_);
+        currentLine_ += '\n';
+        pos_.IncRow();
+
+        /* Store current line for later reports */
+        lines_.push_back(currentLine_);
+    }
+
+    /* Increment column and return current character */
+    auto chr = currentLine_[pos_.Column()];
+    pos_.IncColumn();
+
+    return chr;
+}
+
 
 } // /namespace Xsc
 
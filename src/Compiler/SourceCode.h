@@ -10,6 +10,7 @@
 
 
 #include "SourceArea.h"
+#include "CharClass.h"
 
 #include <istream>
 #include <string>
@@ -33,7 +34,26 @@ class SourceCode
         bool IsValid() const;
 
         // Returns the next character from the source.
-        char Next();
+        inline char Next()
+        {
+            /* Fast path: return next character from the current line */
+            if (pos_.Column() < currentLine_.size())
+            {
+                auto chr = currentLine_[pos_.Column()];
+                pos_.IncColumn();
+                return chr;
+            }
+            return NextLine();
+        }
+
+        // Appends all following characters of the current line, that belong to the specified character class, to the output string.
+        void AppendRun(std::string& out, unsigned char charClass);
+
+        // Appends all following characters of the current line, until any of the specified delimiters appears, to the output string.
+        void AppendUntil(std::string& out, const char* delimiters);
+
+        // Ignores all following characters of the current line, that belong to the specified character class.
+        void IgnoreRun(unsigned char charClass);
 
         // Fetches the line with the marker string of the specified source position.
         bool FetchLineMarker(const SourceArea& area, std::string& line, std::string& marker);
@@ -69,6 +89,9 @@ class SourceCode
         // Returns the line (if it has already been read) by the zero-based line index.
         std::string GetLine(std::size_t lineIndex) const;
 
+        // Reads the next line from the stream and returns its first character, or 0 if the end-of-file is reached.
+        char NextLine();
+
         std::shared_ptr<std::istream>   stream_;
         std::string                     currentLine_;
         std::vector<std::string>        lines_;
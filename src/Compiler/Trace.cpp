@@ -0,0 +1,212 @@
+/*
+ * Trace.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <Xsc/Trace.h>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <map>
+#include <cstdio>
+
+
+namespace Xsc
+{
+
+
+/*
+ * Internal types
+ */
+
+struct TraceEvent
+{
+    std::string     name;
+    std::string     category;
+    std::string     filename;
+    std::uint64_t   startTime   = 0;
+    std::uint64_t   duration    = 0;
+    unsigned int    threadID    = 0;
+};
+
+
+/*
+ * Internal functions
+ */
+
+static void WriteJSONString(std::ostream& stream, const std::string& s)
+{
+    stream << '\"';
+
+    for (auto c : s)
+    {
+        switch (c)
+        {
+            case '\"':  stream << "\\\"";  break;
+            case '\\':  stream << "\\\\";  break;
+            case '\n':  stream << "\\n";   break;
+            case '\r':  stream << "\\r";   break;
+            case '\t':  stream << "\\t";   break;
+            default:
+            {
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char hex[8];
+                    std::snprintf(hex, sizeof(hex), "\\u%04x", static_cast<unsigned>(c));
+                    stream << hex;
+                }
+                else
+                    stream << c;
+            }
+            break;
+        }
+    }
+
+    stream << '\"';
+}
+
+// Writes the specified time (in nanoseconds) in microseconds, which is the time unit of the Trace Event Format.
+static void WriteMicroseconds(std::ostream& stream, std::uint64_t time)
+{
+    char fraction[8];
+    std::snprintf(fraction, sizeof(fraction), ".%03u", static_cast<unsigned>(time % 1000));
+    stream << (time / 1000) << fraction;
+}
+
+
+/*
+ * TraceRecorder class
+ */
+
+struct TraceRecorder::OpaqueData
+{
+    std::chrono::steady_clock::time_point   startTime;
+    mutable std::mutex                      mutex;
+    std::vector<TraceEvent>                 events;
+    std::map<std::thread::id, unsigned int> threadIDs;
+};
+
+TraceRecorder::TraceRecorder() :
+    data_ { new OpaqueData() }
+{
+    data_->startTime = std::chrono::steady_clock::now();
+}
+
+TraceRecorder::~TraceRecorder()
+{
+    delete data_;
+}
+
+std::uint64_t TraceRecorder::Now() const
+{
+    const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - data_->startTime);
+    return static_cast<std::uint64_t>(duration.count());
+}
+
+void TraceRecorder::RecordEvent(
+    const std::string&  name,
+    const std::string&  category,
+    std::uint64_t       startTime,
+    std::uint64_t       duration,
+    const std::string&  filename)
+{
+    TraceEvent event;
+    {
+        event.name      = name;
+        event.category  = category;
+        event.filename  = filename;
+        event.startTime = startTime;
+        event.duration  = duration;
+    }
+
+    std::lock_guard<std::mutex> guard { data_->mutex };
+
+    /* Enumerate threads in the order of their first event, since the native thread IDs are not portable */
+    auto threadIt = data_->threadIDs.find(std::this_thread::get_id());
+    if (threadIt == data_->threadIDs.end())
+    {
+        const auto threadID = static_cast<unsigned int>(data_->threadIDs.size() + 1);
+        threadIt = data_->threadIDs.insert({ std::this_thread::get_id(), threadID }).first;
+    }
+
+    event.threadID = threadIt->second;
+
+    data_->events.push_back(event);
+}
+
+void TraceRecorder::WriteJSON(std::ostream& stream) const
+{
+    std::lock_guard<std::mutex> guard { data_->mutex };
+
+    stream << "{\n  \"displayTimeUnit\": \"ns\",\n  \"traceEvents\": [";
+
+    bool isFirst = true;
+
+    auto BeginEvent = [&stream, &isFirst]()
+    {
+        stream << (isFirst ? "\n    { " : ",\n    { ");
+        isFirst = false;
+    };
+
+    /* Write metadata events to name the threads */
+    for (const auto& it : data_->threadIDs)
+    {
+        BeginEvent();
+        stream << "\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << it.second;
+        stream << ", \"args\": { \"name\": \"Thread " << it.second << "\" } }";
+    }
+
+    /* Write complete events (with start time and duration) */
+    for (const auto& event : data_->events)
+    {
+        BeginEvent();
+
+        stream << "\"name\": ";
+        WriteJSONString(stream, event.name);
+
+        stream << ", \"cat\": ";
+        WriteJSONString(stream, event.category);
+
+        stream << ", \"ph\": \"X\", \"pid\": 1, \"tid\": " << event.threadID;
+
+        stream << ", \"ts\": ";
+        WriteMicroseconds(stream, event.startTime);
+
+        stream << ", \"dur\": ";
+        WriteMicroseconds(stream, event.duration);
+
+        if (!event.filename.empty())
+        {
+            stream << ", \"args\": { \"file\": ";
+            WriteJSONString(stream, event.filename);
+            stream << " }";
+        }
+
+        stream << " }";
+    }
+
+    stream << "\n  ]\n}\n";
+}
+
+std::size_t TraceRecorder::NumEvents() const
+{
+    std::lock_guard<std::mutex> guard { data_->mutex };
+    return data_->events.size();
+}
+
+void TraceRecorder::Clear()
+{
+    std::lock_guard<std::mutex> guard { data_->mutex };
+    data_->events.clear();
+    data_->threadIDs.clear();
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
@@ -8,6 +8,9 @@
 #include "Variant.h"
 #include "Helper.h"
 #include <sstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
 
 
 namespace Xsc
@@ -316,27 +319,30 @@ Variant::Types Variant::FindCommonType(const Variant& lhs, const Variant& rhs)
     return lhsType;
 }
 
-static void CropStringRight(std::string& s, std::size_t pos)
-{
-    if (pos < s.size())
-        s.erase(pos, std::string::npos);
-}
-
 static std::string RealToString(Variant::RealType v)
 {
-    auto s = std::to_string(v);
-    auto posFract = s.find('.');
-    if (posFract != std::string::npos)
+    /* Keep previous representation of infinity and NaN */
+    if (!std::isfinite(v))
+        return std::to_string(v);
+
+    /*
+    Find the shortest representation that round-trips to the same value:
+    decimal literals with up to 15 significant digits are reproduced exactly,
+    while 17 significant digits are always sufficient for a double.
+    */
+    char buffer[32];
+    for (int precision = 15; precision <= 17; ++precision)
     {
-        auto pos = s.find_last_not_of('0');
-        if (pos != std::string::npos)
-        {
-            if (pos == posFract)
-                CropStringRight(s, pos + 2);
-            else
-                CropStringRight(s, pos + 1);
-        }
+        std::snprintf(buffer, sizeof(buffer), "%.*g", precision, v);
+        if (std::strtod(buffer, nullptr) == v)
+            break;
     }
+
+    /* Ensure the result remains a floating-point literal */
+    std::string s = buffer;
+    if (s.find_first_of(".eE") == std::string::npos)
+        s += ".0";
+
     return s;
 }
 
@@ -9,6 +9,7 @@
 #include "Compiler.h"
 #include "ReportIdents.h"
 #include <algorithm>
+#include <iomanip>
 
 #ifdef XSC_ENABLE_SPIRV
 #   include "SPIRVDisassembler.h"
@@ -23,57 +24,139 @@ XSC_EXPORT bool CompileShader(
     const ShaderInput&          inputDesc,
     const ShaderOutput&         outputDesc,
     Log*                        log,
-    Reflection::ReflectionData* reflectionData)
+    Reflection::ReflectionData* reflectionData,
+    CompileStatistics*          statistics)
 {
-    /* Compile shader with compiler driver */
-    Compiler::StageTimePoints timePoints;
+    /* Collect statistics internally if only the timings are shown */
+    CompileStatistics timingStatistics;
+
+    if (!statistics && outputDesc.options.showTimes && log)
+        statistics = (&timingStatistics);
 
+    /* Compile shader with compiler driver */
     Compiler compiler(log);
 
     auto result = compiler.CompileShader(
         inputDesc,
         outputDesc,
         reflectionData,
-        &timePoints
+        statistics
     );
 
     /* Show timings */
     if (outputDesc.options.showTimes && log)
     {
-        using TimePoint = Compiler::TimePoint;
-
-        auto PrintTiming = [log](const std::string& processName, const TimePoint startTime, const TimePoint endTime)
+        auto PrintTiming = [log](const std::string& processName, std::uint64_t duration)
         {
-            long long duration = 0ll;
-
-            if (endTime > startTime)
-            {
-                duration =
-                (
-                    std::chrono::duration_cast<std::chrono::milliseconds>(
-                        std::chrono::duration<float>(endTime - startTime)
-                    ).count()
-                );
-            }
-
             log->SubmitReport(
                 Report(
                     ReportTypes::Info,
-                    "timing " + processName + std::to_string(duration) + " ms"
+                    "timing " + processName + std::to_string(duration / 1000000ull) + " ms"
                 )
             );
         };
 
-        PrintTiming( "pre-processing:   ", timePoints.preprocessor, timePoints.parser     );
-        PrintTiming( "parsing:          ", timePoints.parser,       timePoints.analyzer   );
-        PrintTiming( "context analysis: ", timePoints.analyzer,     timePoints.optimizer  );
-        PrintTiming( "optimization:     ", timePoints.optimizer,    timePoints.generation );
-        PrintTiming( "code generation:  ", timePoints.generation,   timePoints.reflection );
+        PrintTiming( "pre-processing:   ", statistics->preProcessingTime );
+        PrintTiming( "parsing:          ", statistics->parsingTime       );
+        PrintTiming( "context analysis: ", statistics->analysisTime      );
+        PrintTiming( "optimization:     ", statistics->optimizationTime  );
+        PrintTiming( "code generation:  ", statistics->generationTime    );
     }
 
     return result;
 }
 
+XSC_EXPORT void PrintStatistics(std::ostream& stream, const CompileStatistics& statistics)
+{
+    auto PrintDuration = [&stream](const std::string& name, std::size_t nameWidth, std::uint64_t duration)
+    {
+        stream << "    " << std::left << std::setw(static_cast<int>(nameWidth)) << name << " = ";
+        stream << std::fixed << std::setprecision(3) << (static_cast<double>(duration) / 1000000.0) << " ms" << std::endl;
+    };
+
+    const auto prevFlags        = stream.flags();
+    const auto prevPrecision    = stream.precision();
+
+    stream << R_CompileStatistics() << ':' << std::endl;
+
+    stream << "  Stages:" << std::endl;
+    {
+        PrintDuration( "Pre-Processing",   16, statistics.preProcessingTime );
+        PrintDuration( "Parsing",          16, statistics.parsingTime       );
+        PrintDuration( "Context Analysis", 16, statistics.analysisTime      );
+        PrintDuration( "Optimization",     16, statistics.optimizationTime  );
+        PrintDuration( "Code Generation",  16, statistics.generationTime    );
+        PrintDuration( "Code Reflection",  16, statistics.reflectionTime    );
+    }
+
+    if (!statistics.passes.empty())
+    {
+        std::size_t nameWidth = 0;
+        for (const auto& pass : statistics.passes)
+            nameWidth = std::max(nameWidth, pass.name.size());
+
+        stream << "  Passes:" << std::endl;
+        for (const auto& pass : statistics.passes)
+            PrintDuration(pass.name, nameWidth, pass.duration);
+    }
+
+    stream << "  Tokens      = " << statistics.numTokens << std::endl;
+    stream << "  AST Nodes   = " << statistics.numASTNodes << std::endl;
+    stream << "  Allocations = " << statistics.numAllocations << std::endl;
+    stream << "  Peak Memory = " << (statistics.peakMemory / 1024) << " KB" << std::endl;
+
+    stream.flags(prevFlags);
+    stream.precision(prevPrecision);
+}
+
+XSC_EXPORT bool LinkShaderStages(
+    const std::vector<ShaderInput>& inputDescs,
+    std::vector<ShaderOutput>&      outputDescs,
+    Log*                            log)
+{
+    if (inputDescs.size() != outputDescs.size())
+        throw std::invalid_argument(R_MismatchingShaderStageCount);
+
+    /* Analyze varyings of all shader stages */
+    std::vector<VaryingLinker::ShaderInterface> shaderInterfaces(inputDescs.size());
+
+    bool packComponents = true;
+
+    for (std::size_t i = 0; i < inputDescs.size(); ++i)
+    {
+        const auto& inputDesc = inputDescs[i];
+        if (!inputDesc.sourceCode)
+            throw std::invalid_argument(R_InputStreamCantBeNull);
+
+        /* Analyze shader stage and reset input stream afterwards */
+        const auto inputPos = inputDesc.sourceCode->tellg();
+
+        Compiler compiler(log);
+        auto result = compiler.AnalyzeVaryings(inputDesc, outputDescs[i], shaderInterfaces[i]);
+
+        inputDesc.sourceCode->clear();
+        inputDesc.sourceCode->seekg(inputPos);
+
+        if (!result)
+            return false;
+
+        /* Components can not be packed in ESSL, since it does not support the 'component' layout qualifier */
+        if (IsLanguageESSL(outputDescs[i].shaderVersion))
+            packComponents = false;
+    }
+
+    /* Determine layout between each pair of consecutive shader stages */
+    for (std::size_t i = 0; i + 1 < inputDescs.size(); ++i)
+    {
+        VaryingLayout layout;
+        VaryingLinker::LinkVaryings(shaderInterfaces[i].outputs, shaderInterfaces[i + 1].inputs, packComponents, layout);
+        outputDescs[i].outputVaryings       = layout;
+        outputDescs[i + 1].inputVaryings    = layout;
+    }
+
+    return true;
+}
+
 XSC_EXPORT void DisassembleShader(
     std::istream&               streamIn,
     std::ostream&               streamOut,
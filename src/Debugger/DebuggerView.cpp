@@ -221,6 +221,7 @@ void DebuggerView::CreateLayoutPropertyGridOptions(wxPropertyGrid& pg)
     pg.Append(new wxPropertyCategory("Options"));
 
     pg.Append(new wxBoolProperty("Allow Extensions", "extensions"));
+    pg.Append(new wxBoolProperty("Analyze Reachable Only", "reachableOnly"));
     pg.Append(new wxBoolProperty("Auto. Binding", "autoBinding"));
     pg.Append(new wxIntProperty("Auto. Binding Start Slot", "autoBindingStartSlot"));
     pg.Append(new wxBoolProperty("Explicit Binding", "binding"));
@@ -447,6 +448,8 @@ void DebuggerView::OnPropertyGridChange(wxPropertyGridEvent& event)
         shaderOutput_.formatting.indent = ValueStr();
     else if (name == "extensions")
         shaderOutput_.options.allowExtensions = ValueBool();
+    else if (name == "reachableOnly")
+        shaderOutput_.options.analyzeReachableOnly = ValueBool();
     else if (name == "binding")
         shaderOutput_.options.explicitBinding = ValueBool();
     else if (name == "optimize")
@@ -42,6 +42,22 @@ T MapStringToType(const std::string& search, const std::map<std::string, T>& map
     return it->second;
 }
 
+static ShaderTarget StringToShaderTarget(const std::string& target)
+{
+    return MapStringToType<ShaderTarget>(
+        target,
+        {
+            { "vert", ShaderTarget::VertexShader                 },
+            { "tesc", ShaderTarget::TessellationControlShader    },
+            { "tese", ShaderTarget::TessellationEvaluationShader },
+            { "geom", ShaderTarget::GeometryShader               },
+            { "frag", ShaderTarget::FragmentShader               },
+            { "comp", ShaderTarget::ComputeShader                },
+        },
+        R_InvalidShaderTarget(target)
+    );
+}
+
 static void SetFlagsByBoolean(CommandLine& cmdLine, unsigned int& flagsOut, unsigned int flags)
 {
     if (cmdLine.AcceptBoolean(true))
@@ -134,18 +150,7 @@ void TargetCommand::Run(CommandLine& cmdLine, ShellState& state)
 {
     const auto target = cmdLine.Accept();
 
-    state.inputDesc.shaderTarget = MapStringToType<ShaderTarget>(
-        target,
-        {
-            { "vert", ShaderTarget::VertexShader                 },
-            { "tesc", ShaderTarget::TessellationControlShader    },
-            { "tese", ShaderTarget::TessellationEvaluationShader },
-            { "geom", ShaderTarget::GeometryShader               },
-            { "frag", ShaderTarget::FragmentShader               },
-            { "comp", ShaderTarget::ComputeShader                },
-        },
-        R_InvalidShaderTarget(target)
-    );
+    state.inputDesc.shaderTarget = StringToShaderTarget(target);
 }
 
 
@@ -394,6 +399,54 @@ void ShowTimesCommand::Run(CommandLine& cmdLine, ShellState& state)
 }
 
 
+/*
+ * ShowStatsCommand class
+ */
+
+std::vector<Command::Identifier> ShowStatsCommand::Idents() const
+{
+    return { { "--show-stats" } };
+}
+
+HelpDescriptor ShowStatsCommand::Help() const
+{
+    return
+    {
+        "--show-stats [" + CommandLine::GetBooleanOption() + "]",
+        R_CmdHelpShowStats(CommandLine::GetBooleanFalse())
+    };
+}
+
+void ShowStatsCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.showStatistics = cmdLine.AcceptBoolean(true);
+}
+
+
+/*
+ * TraceCommand class
+ */
+
+std::vector<Command::Identifier> TraceCommand::Idents() const
+{
+    return { { "--trace" } };
+}
+
+HelpDescriptor TraceCommand::Help() const
+{
+    return
+    {
+        "--trace FILE",
+        R_CmdHelpTrace()
+    };
+}
+
+void TraceCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.traceFilename = cmdLine.Accept();
+}
+
+
 /*
  * ReflectCommand class
  */
@@ -418,6 +471,56 @@ void ReflectCommand::Run(CommandLine& cmdLine, ShellState& state)
 }
 
 
+/*
+ * ReflectOnlyCommand class
+ */
+
+std::vector<Command::Identifier> ReflectOnlyCommand::Idents() const
+{
+    return { { "--reflect-only" } };
+}
+
+HelpDescriptor ReflectOnlyCommand::Help() const
+{
+    return
+    {
+        "--reflect-only [" + CommandLine::GetBooleanOption() + "]",
+        R_CmdHelpReflectOnly(CommandLine::GetBooleanFalse())
+    };
+}
+
+void ReflectOnlyCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.reflectOnly = cmdLine.AcceptBoolean(true);
+    if (state.outputDesc.options.reflectOnly)
+        state.showReflection = true;
+}
+
+
+/*
+ * ReflectOutCommand class
+ */
+
+std::vector<Command::Identifier> ReflectOutCommand::Idents() const
+{
+    return { { "--reflect-out" } };
+}
+
+HelpDescriptor ReflectOutCommand::Help() const
+{
+    return
+    {
+        "--reflect-out FILE",
+        R_CmdHelpReflectOut()
+    };
+}
+
+void ReflectOutCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.reflectionFilename = cmdLine.Accept();
+}
+
+
 /*
  * PPOnlyCommand class
  */
@@ -442,6 +545,30 @@ void PPOnlyCommand::Run(CommandLine& cmdLine, ShellState& state)
 }
 
 
+/*
+ * DependencyCommand class
+ */
+
+std::vector<Command::Identifier> DependencyCommand::Idents() const
+{
+    return { { "-MD" }, { "--dependencies" } };
+}
+
+HelpDescriptor DependencyCommand::Help() const
+{
+    return
+    {
+        "-MD, --dependencies [" + CommandLine::GetBooleanOption() + "]",
+        R_CmdHelpDependencies(CommandLine::GetBooleanFalse())
+    };
+}
+
+void DependencyCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.writeDependencies = cmdLine.AcceptBoolean(true);
+}
+
+
 /*
  * MacroCommand class
  */
@@ -539,6 +666,274 @@ void PackUniformsCommand::Run(CommandLine& cmdLine, ShellState& state)
 }
 
 
+/*
+ * ReorderUniformsCommand class
+ */
+
+std::vector<Command::Identifier> ReorderUniformsCommand::Idents() const
+{
+    return { { "--reorder-uniforms" } };
+}
+
+HelpDescriptor ReorderUniformsCommand::Help() const
+{
+    return
+    {
+        "--reorder-uniforms [" + CommandLine::GetBooleanOption() + "]",
+        R_CmdHelpReorderUniforms(CommandLine::GetBooleanFalse())
+    };
+}
+
+void ReorderUniformsCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.reorderUniforms = cmdLine.AcceptBoolean(true);
+}
+
+
+/*
+ * MatchLayoutCommand class
+ */
+
+std::vector<Command::Identifier> MatchLayoutCommand::Idents() const
+{
+    return { { "--match-layout" } };
+}
+
+HelpDescriptor MatchLayoutCommand::Help() const
+{
+    return
+    {
+        "--match-layout [" + CommandLine::GetBooleanOption() + "]",
+        R_CmdHelpMatchLayout(CommandLine::GetBooleanFalse())
+    };
+}
+
+void MatchLayoutCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.matchBufferLayout = cmdLine.AcceptBoolean(true);
+}
+
+
+/*
+ * MergeBuffersCommand class
+ */
+
+std::vector<Command::Identifier> MergeBuffersCommand::Idents() const
+{
+    return { { "--merge-cbuffers" } };
+}
+
+HelpDescriptor MergeBuffersCommand::Help() const
+{
+    return
+    {
+        "--merge-cbuffers SIZE",
+        R_CmdHelpMergeBuffers
+    };
+}
+
+void MergeBuffersCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    auto& bufferMerging = state.outputDesc.bufferMerging;
+    bufferMerging.enabled       = true;
+    bufferMerging.sizeThreshold = static_cast<unsigned int>(std::stoi(cmdLine.Accept()));
+}
+
+
+/*
+ * CompactBindingsCommand class
+ */
+
+std::vector<Command::Identifier> CompactBindingsCommand::Idents() const
+{
+    return { { "--compact-bindings" } };
+}
+
+HelpDescriptor CompactBindingsCommand::Help() const
+{
+    return
+    {
+        "--compact-bindings [" + CommandLine::GetBooleanOption() + "]",
+        R_CmdHelpCompactBindings(CommandLine::GetBooleanFalse())
+    };
+}
+
+void CompactBindingsCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.bindingLayout.enabled = cmdLine.AcceptBoolean(true);
+}
+
+
+/*
+ * PushConstantsCommand class
+ */
+
+std::vector<Command::Identifier> PushConstantsCommand::Idents() const
+{
+    return { { "--push-constants" } };
+}
+
+HelpDescriptor PushConstantsCommand::Help() const
+{
+    return
+    {
+        "--push-constants IDENT",
+        R_CmdHelpPushConstants
+    };
+}
+
+void PushConstantsCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.bindingLayout.pushConstantBuffer = cmdLine.Accept();
+}
+
+
+/*
+ * UniformValueCommand class
+ */
+
+std::vector<Command::Identifier> UniformValueCommand::Idents() const
+{
+    return { { "--uniform" } };
+}
+
+HelpDescriptor UniformValueCommand::Help() const
+{
+    return
+    {
+        "--uniform IDENT=VALUE",
+        R_CmdHelpUniformValue
+    };
+}
+
+void UniformValueCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    auto arg = cmdLine.Accept();
+
+    auto pos = arg.find('=');
+    if (pos != std::string::npos && pos + 1 < arg.size())
+    {
+        /* Get uniform name and parse value as boolean, floating-point, or integral value */
+        auto ident = arg.substr(0, pos);
+        auto value = arg.substr(pos + 1);
+
+        UniformValue uniformValue;
+
+        if (value == "true" || value == "false")
+            uniformValue = (value == "true");
+        else if (value.find_first_of(".eE") != std::string::npos || value.back() == 'f')
+            uniformValue = std::stod(value.back() == 'f' ? value.substr(0, value.size() - 1) : value);
+        else
+            uniformValue = std::stoll(value, nullptr, 0);
+
+        state.outputDesc.uniformValues[ident] = uniformValue;
+    }
+    else
+        throw std::runtime_error(R_UniformValueExpectedFor(arg));
+}
+
+
+/*
+ * SpecConstantCommand class
+ */
+
+std::vector<Command::Identifier> SpecConstantCommand::Idents() const
+{
+    return { { "--spec-const" } };
+}
+
+HelpDescriptor SpecConstantCommand::Help() const
+{
+    return
+    {
+        "--spec-const IDENT=ID",
+        R_CmdHelpSpecConstant
+    };
+}
+
+void SpecConstantCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    auto arg = cmdLine.Accept();
+
+    auto pos = arg.find('=');
+    if (pos != std::string::npos && pos + 1 < arg.size())
+    {
+        /* Get constant name and parse constant ID */
+        auto ident = arg.substr(0, pos);
+        auto value = arg.substr(pos + 1);
+
+        state.outputDesc.specConstantIDs[ident] = std::stoi(value);
+    }
+    else
+        throw std::runtime_error(R_SpecConstantIDExpectedFor(arg));
+}
+
+
+/*
+ * InferPrecisionCommand class
+ */
+
+std::vector<Command::Identifier> InferPrecisionCommand::Idents() const
+{
+    return { { "--infer-precision" } };
+}
+
+HelpDescriptor InferPrecisionCommand::Help() const
+{
+    return
+    {
+        "--infer-precision [" + CommandLine::GetBooleanOption() + "]",
+        R_CmdHelpInferPrecision(CommandLine::GetBooleanFalse())
+    };
+}
+
+void InferPrecisionCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.precisionPolicy.enabled = cmdLine.AcceptBoolean(true);
+}
+
+
+/*
+ * LinkStageCommand class
+ */
+
+std::vector<Command::Identifier> LinkStageCommand::Idents() const
+{
+    return { { "--link" } };
+}
+
+HelpDescriptor LinkStageCommand::Help() const
+{
+    return
+    {
+        "--link TARGET=ENTRY",
+        R_CmdHelpLinkStage
+    };
+}
+
+void LinkStageCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    auto arg = cmdLine.Accept();
+
+    auto pos = arg.find('=');
+    if (pos != std::string::npos && pos + 1 < arg.size())
+    {
+        /* Get shader target and entry point of the linked shader stage */
+        auto target     = arg.substr(0, pos);
+        auto entryPoint = arg.substr(pos + 1);
+
+        LinkedStage linkedStage;
+        {
+            linkedStage.shaderTarget    = StringToShaderTarget(target);
+            linkedStage.entryPoint      = entryPoint;
+        }
+        state.linkedStages.push_back(linkedStage);
+    }
+    else
+        throw std::runtime_error(R_EntryPointExpectedFor(arg));
+}
+
+
 /*
  * PauseCommand class
  */
@@ -967,6 +1362,30 @@ void OptimizeCommand::Run(CommandLine& cmdLine, ShellState& state)
 }
 
 
+/*
+ * ReachableOnlyCommand class
+ */
+
+std::vector<Command::Identifier> ReachableOnlyCommand::Idents() const
+{
+    return { { "--reachable-only" } };
+}
+
+HelpDescriptor ReachableOnlyCommand::Help() const
+{
+    return
+    {
+        "--reachable-only [" + CommandLine::GetBooleanOption() + "]",
+        R_CmdHelpReachableOnly(CommandLine::GetBooleanFalse())
+    };
+}
+
+void ReachableOnlyCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.analyzeReachableOnly = cmdLine.AcceptBoolean(true);
+}
+
+
 /*
  * ExtensionCommand class
  */
@@ -1504,9 +1923,12 @@ void LanguageExtensionCommand::Run(CommandLine& cmdLine, ShellState& state)
     const auto flags = MapStringToType<unsigned int>(
         type,
         {
-            { "all",         Extensions::All             },
-            { "attr-layout", Extensions::LayoutAttribute },
-            { "attr-space",  Extensions::SpaceAttribute  },
+            { "all",                   Extensions::All                      },
+            { "attr-constant-id",      Extensions::ConstantIDAttribute      },
+            { "attr-layout",           Extensions::LayoutAttribute          },
+            { "attr-reorder-members",  Extensions::ReorderMembersAttribute  },
+            { "attr-space",            Extensions::SpaceAttribute           },
+            { "attr-update-frequency", Extensions::UpdateFrequencyAttribute },
         },
         R_InvalidExtensionType(type)
     );
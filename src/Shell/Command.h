@@ -78,11 +78,25 @@ DECL_SHELL_COMMAND( IncludePathCommand           );
 DECL_SHELL_COMMAND( WarnCommand                  );
 DECL_SHELL_COMMAND( ShowASTCommand               );
 DECL_SHELL_COMMAND( ShowTimesCommand             );
+DECL_SHELL_COMMAND( ShowStatsCommand             );
+DECL_SHELL_COMMAND( TraceCommand                 );
 DECL_SHELL_COMMAND( ReflectCommand               );
+DECL_SHELL_COMMAND( ReflectOnlyCommand           );
+DECL_SHELL_COMMAND( ReflectOutCommand            );
 DECL_SHELL_COMMAND( PPOnlyCommand                );
+DECL_SHELL_COMMAND( DependencyCommand            );
 DECL_SHELL_COMMAND( MacroCommand                 );
 DECL_SHELL_COMMAND( SemanticCommand              );
 DECL_SHELL_COMMAND( PackUniformsCommand          );
+DECL_SHELL_COMMAND( ReorderUniformsCommand       );
+DECL_SHELL_COMMAND( MatchLayoutCommand           );
+DECL_SHELL_COMMAND( MergeBuffersCommand          );
+DECL_SHELL_COMMAND( CompactBindingsCommand       );
+DECL_SHELL_COMMAND( PushConstantsCommand         );
+DECL_SHELL_COMMAND( UniformValueCommand          );
+DECL_SHELL_COMMAND( SpecConstantCommand          );
+DECL_SHELL_COMMAND( InferPrecisionCommand        );
+DECL_SHELL_COMMAND( LinkStageCommand             );
 DECL_SHELL_COMMAND( PauseCommand                 );
 DECL_SHELL_COMMAND( PresettingCommand            );
 DECL_SHELL_COMMAND( VersionCommand               );
@@ -90,6 +104,7 @@ DECL_SHELL_COMMAND( HelpCommand                  );
 DECL_SHELL_COMMAND( VerboseCommand               );
 DECL_SHELL_COMMAND( ColorCommand                 );
 DECL_SHELL_COMMAND( OptimizeCommand              );
+DECL_SHELL_COMMAND( ReachableOnlyCommand         );
 DECL_SHELL_COMMAND( ExtensionCommand             );
 DECL_SHELL_COMMAND( EnumExtensionCommand         );
 DECL_SHELL_COMMAND( ValidateCommand              );
@@ -65,11 +65,25 @@ CommandFactory::CommandFactory()
         WarnCommand,
         ShowASTCommand,
         ShowTimesCommand,
+        ShowStatsCommand,
+        TraceCommand,
         ReflectCommand,
+        ReflectOnlyCommand,
+        ReflectOutCommand,
         PPOnlyCommand,
+        DependencyCommand,
         MacroCommand,
         SemanticCommand,
         PackUniformsCommand,
+        ReorderUniformsCommand,
+        MatchLayoutCommand,
+        MergeBuffersCommand,
+        CompactBindingsCommand,
+        PushConstantsCommand,
+        UniformValueCommand,
+        SpecConstantCommand,
+        InferPrecisionCommand,
+        LinkStageCommand,
         PauseCommand,
         PresettingCommand,
         VersionCommand,
@@ -77,6 +91,7 @@ CommandFactory::CommandFactory()
         VerboseCommand,
         ColorCommand,
         OptimizeCommand,
+        ReachableOnlyCommand,
         ExtensionCommand,
         EnumExtensionCommand,
         ValidateCommand,
@@ -127,6 +127,10 @@ bool Shell::ExecuteCommandLine(CommandLine& cmdLine, bool enableBriefHelp)
             }
         }
 
+        /* Write trace events of all compilations after the outermost command line (presettings are executed within nested command lines) */
+        if (stateStack_.empty() && !traceFilename_.empty())
+            WriteTrace();
+
         if (!state_.actionPerformed)
         {
             /* No action performed -> return false */
@@ -184,6 +188,13 @@ static std::string GetFilePart(const std::string& s)
     return (pos == std::string::npos ? s : s.substr(0, pos));
 }
 
+// Returns the file extension from the specified string.
+static std::string GetFileExtPart(const std::string& s)
+{
+    const auto pos = s.find_last_of('.');
+    return (pos == std::string::npos ? "" : s.substr(pos + 1));
+}
+
 // Returns the path without its filename from the specified string.
 static std::string GetPathPart(const std::string& s)
 {
@@ -225,6 +236,9 @@ bool Shell::Compile(const std::string& filename)
     else
         Replace(outputFilename, "*", defaultOutputFilename);
 
+    auto reflectionFilename = state_.reflectionFilename;
+    Replace(reflectionFilename, "*", defaultOutputFilename);
+
     try
     {
         /* Add pre-defined macros at the top of the input stream */
@@ -253,10 +267,20 @@ bool Shell::Compile(const std::string& filename)
         state_.inputDesc.sourceCode  = inputStream;
         state_.outputDesc.sourceCode = &outputStream;
 
+        /* Record trace events (if enabled) */
+        if (!state_.traceFilename.empty())
+        {
+            traceFilename_ = state_.traceFilename;
+            state_.outputDesc.traceRecorder = (&traceRecorder_);
+        }
+        else
+            state_.outputDesc.traceRecorder = nullptr;
+
         /* Final setup before compilation */
         StdLog                      log;
         IncludeHandler              includeHandler;
         Reflection::ReflectionData  reflectionData;
+        CompileStatistics           statistics;
 
         includeHandler.GetSearchPaths() = state_.searchPaths;
         state_.inputDesc.includeHandler = &includeHandler;
@@ -266,22 +290,30 @@ bool Shell::Compile(const std::string& filename)
         if (!inputPath.empty())
             includeHandler.GetSearchPaths().push_back(inputPath);
 
+        /* Reflection-only mode does not generate any output code, so it is handled like a validation */
+        const bool validateOnly = (state_.outputDesc.options.validateOnly || state_.outputDesc.options.reflectOnly);
+
         /* Show compilation/validation status */
         if (state_.verbose)
         {
-            if (state_.outputDesc.options.validateOnly)
+            if (validateOnly)
                 output << R_ValidateShader(filename) << std::endl;
             else
                 output << R_CompileShader(filename, outputFilename) << std::endl;
         }
 
-        /* Compile shader file */
-        succeeded = CompileShader(
-            state_.inputDesc,
-            state_.outputDesc,
-            &log,
-            (state_.showReflection ? &reflectionData : nullptr)
-        );
+        /* Link varyings with the other shader stages (if enabled) */
+        if (state_.linkedStages.empty() || LinkStages(inputStream->str()))
+        {
+            /* Compile shader file */
+            succeeded = CompileShader(
+                state_.inputDesc,
+                state_.outputDesc,
+                &log,
+                (state_.showReflection || state_.writeDependencies || !reflectionFilename.empty() ? &reflectionData : nullptr),
+                (state_.showStatistics ? &statistics : nullptr)
+            );
+        }
 
         /* Print all reports to the log output */
         log.PrintAll(state_.verbose);
@@ -290,7 +322,7 @@ bool Shell::Compile(const std::string& filename)
         {
             ScopedColor color { ColorFlags::Green | ColorFlags::Intens };
 
-            if (!state_.outputDesc.options.validateOnly)
+            if (!validateOnly)
             {
                 if (state_.verbose)
                     output << R_CompilationSuccessful() << std::endl;
@@ -304,16 +336,40 @@ bool Shell::Compile(const std::string& filename)
 
                 /* Store output filename after successful compilation */
                 lastOutputFilename_ = outputFilename;
+
+                /* Write include dependencies into Makefile dependency file */
+                if (state_.writeDependencies)
+                {
+                    const auto depFilename = outputFilename + ".d";
+                    std::ofstream depFile(depFilename);
+                    if (depFile.good())
+                        PrintDependencies(depFile, outputFilename, filename, reflectionData);
+                    else
+                        throw std::runtime_error(R_FailedToWriteFile(depFilename));
+                }
             }
             else if (state_.verbose)
                 output << R_ValidationSuccessful() << std::endl;
+
+            /* Write code reflection into binary or JSON file */
+            if (!reflectionFilename.empty())
+            {
+                std::ofstream reflectionFile(reflectionFilename, std::ios::binary);
+                if (!reflectionFile.good())
+                    throw std::runtime_error(R_FailedToWriteFile(reflectionFilename));
+
+                if (GetFileExtPart(reflectionFilename) == "json")
+                    PrintReflectionJSON(reflectionFile, reflectionData);
+                else
+                    WriteReflection(reflectionFile, reflectionData);
+            }
         }
         else
         {
             ScopedColor color { ColorFlags::Red | ColorFlags::Intens };
 
             /* Always print message on failure */
-            if (state_.outputDesc.options.validateOnly)
+            if (validateOnly)
                 output << R_ValidationFailed() << std::endl;
             else
                 output << R_CompilationFailed() << std::endl;
@@ -322,6 +378,10 @@ bool Shell::Compile(const std::string& filename)
         /* Show output statistics (if enabled) */
         if (state_.showReflection)
             PrintReflection(output, reflectionData, !state_.showReflectionExt);
+
+        /* Show compile statistics (if enabled) */
+        if (state_.showStatistics)
+            PrintStatistics(output, statistics);
     }
     catch (const std::exception& err)
     {
@@ -332,6 +392,80 @@ bool Shell::Compile(const std::string& filename)
     return succeeded;
 }
 
+bool Shell::LinkStages(const std::string& sourceCode)
+{
+    /* Gather all shader stages in pipeline order (including the stage to be compiled) */
+    std::vector<std::pair<LinkedStage, bool>> stages;
+
+    for (const auto& stage : state_.linkedStages)
+        stages.push_back({ stage, false });
+
+    LinkedStage compiledStage;
+    {
+        compiledStage.shaderTarget  = state_.inputDesc.shaderTarget;
+        compiledStage.entryPoint    = state_.inputDesc.entryPoint;
+    }
+    stages.push_back({ compiledStage, true });
+
+    std::stable_sort(
+        stages.begin(), stages.end(),
+        [](const std::pair<LinkedStage, bool>& lhs, const std::pair<LinkedStage, bool>& rhs)
+        {
+            return (lhs.first.shaderTarget < rhs.first.shaderTarget);
+        }
+    );
+
+    /* Analyze the varyings of all shader stages from the same source code */
+    std::vector<ShaderInput> inputDescs;
+    std::vector<ShaderOutput> outputDescs;
+
+    for (const auto& stage : stages)
+    {
+        auto inputDesc = state_.inputDesc;
+        {
+            inputDesc.shaderTarget  = stage.first.shaderTarget;
+            inputDesc.entryPoint    = stage.first.entryPoint;
+            inputDesc.sourceCode    = std::make_shared<std::stringstream>(sourceCode);
+        }
+        inputDescs.push_back(inputDesc);
+        outputDescs.push_back(state_.outputDesc);
+    }
+
+    /* Reports of the analysis are only printed on failure, since the stage is compiled again afterwards */
+    StdLog log;
+
+    if (!LinkShaderStages(inputDescs, outputDescs, &log))
+    {
+        log.PrintAll(state_.verbose);
+        return false;
+    }
+
+    /* Take varying layout of the stage to be compiled */
+    for (std::size_t i = 0; i < stages.size(); ++i)
+    {
+        if (stages[i].second)
+        {
+            state_.outputDesc.inputVaryings     = outputDescs[i].inputVaryings;
+            state_.outputDesc.outputVaryings    = outputDescs[i].outputVaryings;
+        }
+    }
+
+    return true;
+}
+
+void Shell::WriteTrace()
+{
+    std::ofstream traceFile(traceFilename_);
+    if (!traceFile.good())
+        throw std::runtime_error(R_FailedToWriteFile(traceFilename_));
+
+    traceRecorder_.WriteJSON(traceFile);
+
+    /* Start new trace for the next command line */
+    traceRecorder_.Clear();
+    traceFilename_.clear();
+}
+
 
 } // /namespace Util
 
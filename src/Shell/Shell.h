@@ -11,6 +11,7 @@
 
 #include <Xsc/IndentHandler.h>
 #include <Xsc/Reflection.h>
+#include <Xsc/Trace.h>
 #include "ShellState.h"
 #include "CommandLine.h"
 #include <ostream>
@@ -62,12 +63,18 @@ class Shell
         std::string GetDefaultOutputFilename(const std::string& filename) const;
 
         bool Compile(const std::string& filename);
+        bool LinkStages(const std::string& sourceCode);
+
+        void WriteTrace();
 
         ShellState              state_;
         std::stack<ShellState>  stateStack_;
 
         std::string             lastOutputFilename_;
 
+        TraceRecorder           traceRecorder_;
+        std::string             traceFilename_;         // Output filename of the trace events that have been recorded so far.
+
         static Shell*           instance_;
 
 };
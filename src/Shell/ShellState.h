@@ -37,6 +37,15 @@ struct PredefinedMacro
     std::string value;
 };
 
+struct LinkedStage
+{
+    // Shader target of the linked shader stage
+    ShaderTarget    shaderTarget    = ShaderTarget::Undefined;
+
+    // Entry point of the linked shader stage
+    std::string     entryPoint;
+};
+
 struct ShellState
 {
     // Shader input descriptor.
@@ -54,6 +63,9 @@ struct ShellState
     // Include search paths for the preprocessor.
     std::vector<std::string>        searchPaths;
 
+    // Other shader stages in the same input file, whose varyings are linked with the compiled shader stage.
+    std::vector<LinkedStage>        linkedStages;
+
     // Print line marks for compiler reports.
     bool                            verbose             = true;
 
@@ -66,6 +78,18 @@ struct ShellState
     // Show extended code reflection (including all unreferenced objects).
     bool                            showReflectionExt   = false;
 
+    // Show compile statistics after compilation.
+    bool                            showStatistics      = false;
+
+    // Output filename for the trace events of all compilations (empty to disable).
+    std::string                     traceFilename;
+
+    // Output filename for the code reflection in the binary or JSON format (empty to disable).
+    std::string                     reflectionFilename;
+
+    // Write include dependencies into a Makefile dependency file next to the output file.
+    bool                            writeDependencies   = false;
+
     // True, if any meaningful action has been performed (e.g. printed version or compiled any files).
     bool                            actionPerformed     = false;
 
@@ -49,9 +49,11 @@ struct CompilerContext
     Xsc::Reflection::ReflectionData     reflection;
 
     std::vector<const char*>            macros;
+    std::vector<const char*>            usedMacros;
     std::vector<XscAttribute>           inputAttributes;
     std::vector<XscAttribute>           outputAttributes;
     std::vector<XscAttribute>           uniforms;
+    std::vector<XscSpecConstant>        specConstants;
     std::vector<XscResource>            resources;
     std::vector<XscConstantBuffer>      constantBuffers;
     std::vector<XscSamplerState>        samplerStates;
@@ -79,14 +81,18 @@ static void InitializeFormatting(struct XscFormatting* s)
 static void InitializeOptions(struct XscOptions* s)
 {
     s->allowExtensions          = 0;
+    s->analyzeReachableOnly     = 0;
     s->autoBinding              = 0;
     s->autoBindingStartSlot     = 0;
     s->explicitBinding          = 0;
+    s->matchBufferLayout        = 0;
     s->obfuscate                = 0;
     s->optimize                 = 0;
     s->preprocessOnly           = 0;
     s->preserveComments         = 0;
     s->preferWrappers           = 0;
+    s->reflectOnly              = 0;
+    s->reorderUniforms          = 0;
     s->rowMajorAlignment        = 0;
     s->separateSamplers         = 1;
     s->separateShaders          = 0;
@@ -159,12 +165,64 @@ static bool ValidateShaderOutput(const struct XscShaderOutput* s)
     return (s != NULL && s->sourceCode != NULL && (s->vertexSemanticsCount == 0 || s->vertexSemantics != NULL));
 }
 
+static void ClearReflectionBuffers()
+{
+    g_compilerContext.macros.clear();
+    g_compilerContext.usedMacros.clear();
+    g_compilerContext.inputAttributes.clear();
+    g_compilerContext.outputAttributes.clear();
+    g_compilerContext.uniforms.clear();
+    g_compilerContext.specConstants.clear();
+    g_compilerContext.resources.clear();
+    g_compilerContext.constantBuffers.clear();
+    g_compilerContext.samplerStates.clear();
+    g_compilerContext.staticSamplerStates.clear();
+}
+
+static void AssignReflectionBuffers(struct XscReflectionData* dst)
+{
+    dst->macros                     = g_compilerContext.macros.data();
+    dst->macrosCount                = g_compilerContext.macros.size();
+
+    dst->usedMacros                 = g_compilerContext.usedMacros.data();
+    dst->usedMacrosCount            = g_compilerContext.usedMacros.size();
+
+    dst->inputAttributes            = g_compilerContext.inputAttributes.data();
+    dst->inputAttributesCount       = g_compilerContext.inputAttributes.size();
+
+    dst->outputAttributes           = g_compilerContext.outputAttributes.data();
+    dst->outputAttributesCount      = g_compilerContext.outputAttributes.size();
+
+    dst->uniforms                   = g_compilerContext.uniforms.data();
+    dst->uniformsCount              = g_compilerContext.uniforms.size();
+
+    dst->specConstants              = g_compilerContext.specConstants.data();
+    dst->specConstantsCount         = g_compilerContext.specConstants.size();
+
+    dst->resources                  = g_compilerContext.resources.data();
+    dst->resourcesCount             = g_compilerContext.resources.size();
+
+    dst->constantBuffers            = g_compilerContext.constantBuffers.data();
+    dst->constantBufferCounts       = g_compilerContext.constantBuffers.size();
+
+    dst->samplerStates              = g_compilerContext.samplerStates.data();
+    dst->samplerStatesCount         = g_compilerContext.samplerStates.size();
+
+    dst->staticSamplerStates        = g_compilerContext.staticSamplerStates.data();
+    dst->staticSamplerStatesCount   = g_compilerContext.staticSamplerStates.size();
+}
+
 static void CopyReflection(const Xsc::Reflection::ReflectionData& src, struct XscReflectionData* dst)
 {
     /* Fill context buffers */
+    ClearReflectionBuffers();
+
     for (const auto& s : src.macros)
         g_compilerContext.macros.push_back(s.c_str());
 
+    for (const auto& s : src.usedMacros)
+        g_compilerContext.usedMacros.push_back(s.c_str());
+
     for (const auto& s : src.inputAttributes)
         g_compilerContext.inputAttributes.push_back({ s.name.c_str(), s.slot });
 
@@ -174,6 +232,9 @@ static void CopyReflection(const Xsc::Reflection::ReflectionData& src, struct Xs
     for (const auto& s : src.uniforms)
         g_compilerContext.uniforms.push_back({ s.name.c_str(), s.slot });
 
+    for (const auto& s : src.specConstants)
+        g_compilerContext.specConstants.push_back({ s.name.c_str(), s.constantID, s.defaultValue });
+
     for (const auto& s : src.resources)
     {
         g_compilerContext.resources.push_back(
@@ -229,34 +290,91 @@ static void CopyReflection(const Xsc::Reflection::ReflectionData& src, struct Xs
     }
 
     /* Set references to output buffers */
-    dst->macros                     = g_compilerContext.macros.data();
-    dst->macrosCount                = g_compilerContext.macros.size();
+    AssignReflectionBuffers(dst);
 
-    dst->inputAttributes            = g_compilerContext.inputAttributes.data();
-    dst->inputAttributesCount       = g_compilerContext.inputAttributes.size();
+    /* Copy remaining data fields */
+    dst->numThreads.x = src.numThreads.x;
+    dst->numThreads.y = src.numThreads.y;
+    dst->numThreads.z = src.numThreads.z;
+}
 
-    dst->outputAttributes           = g_compilerContext.outputAttributes.data();
-    dst->outputAttributesCount      = g_compilerContext.outputAttributes.size();
+// Copies the binary reflection into the output reflection, whose strings refer directly to the binary reflection.
+static void CopyBinaryReflection(const Xsc::Reflection::ReflectionReader& src, struct XscReflectionData* dst)
+{
+    /* Fill context buffers */
+    ClearReflectionBuffers();
 
-    dst->uniforms                   = g_compilerContext.uniforms.data();
-    dst->uniformsCount              = g_compilerContext.uniforms.size();
+    for (const auto& s : src.GetMacros())
+        g_compilerContext.macros.push_back(src.GetString(s));
 
-    dst->resources                  = g_compilerContext.resources.data();
-    dst->resourcesCount             = g_compilerContext.resources.size();
+    for (const auto& s : src.GetUsedMacros())
+        g_compilerContext.usedMacros.push_back(src.GetString(s));
 
-    dst->constantBuffers            = g_compilerContext.constantBuffers.data();
-    dst->constantBufferCounts       = g_compilerContext.constantBuffers.size();
+    for (const auto& s : src.GetInputAttributes())
+        g_compilerContext.inputAttributes.push_back({ src.GetString(s.name), s.slot });
 
-    dst->samplerStates              = g_compilerContext.samplerStates.data();
-    dst->samplerStatesCount         = g_compilerContext.samplerStates.size();
+    for (const auto& s : src.GetOutputAttributes())
+        g_compilerContext.outputAttributes.push_back({ src.GetString(s.name), s.slot });
 
-    dst->staticSamplerStates        = g_compilerContext.staticSamplerStates.data();
-    dst->staticSamplerStatesCount   = g_compilerContext.staticSamplerStates.size();
+    for (const auto& s : src.GetUniforms())
+        g_compilerContext.uniforms.push_back({ src.GetString(s.name), s.slot });
+
+    for (const auto& s : src.GetSpecConstants())
+        g_compilerContext.specConstants.push_back({ src.GetString(s.name), s.constantID, s.defaultValue });
+
+    for (const auto& s : src.GetResources())
+        g_compilerContext.resources.push_back({ static_cast<XscResourceType>(s.type), src.GetString(s.name), s.slot });
+
+    for (const auto& s : src.GetConstantBuffers())
+    {
+        g_compilerContext.constantBuffers.push_back(
+            {
+                static_cast<XscResourceType>(s.type),
+                src.GetString(s.name),
+                s.slot,
+                s.size,
+                s.padding
+            }
+        );
+    }
+
+    for (const auto& s : src.GetSamplerStates())
+        g_compilerContext.samplerStates.push_back({ static_cast<XscResourceType>(s.type), src.GetString(s.name), s.slot });
+
+    for (const auto& s : src.GetStaticSamplerStates())
+    {
+        g_compilerContext.staticSamplerStates.push_back(
+            {
+                static_cast<XscResourceType>(s.type),
+                src.GetString(s.name),
+                {
+                    static_cast<XscFilter>(s.filter),
+                    static_cast<XscTextureAddressMode>(s.addressU),
+                    static_cast<XscTextureAddressMode>(s.addressV),
+                    static_cast<XscTextureAddressMode>(s.addressW),
+                    s.mipLODBias,
+                    s.maxAnisotropy,
+                    static_cast<XscComparisonFunc>(s.comparisonFunc),
+                    {
+                        s.borderColor[0],
+                        s.borderColor[1],
+                        s.borderColor[2],
+                        s.borderColor[3]
+                    },
+                    s.minLOD,
+                    s.maxLOD
+                }
+            }
+        );
+    }
+
+    /* Set references to output buffers */
+    AssignReflectionBuffers(dst);
 
     /* Copy remaining data fields */
-    dst->numThreads.x = src.numThreads.x;
-    dst->numThreads.y = src.numThreads.y;
-    dst->numThreads.z = src.numThreads.z;
+    dst->numThreads.x = src.GetHeader()->numThreads[0];
+    dst->numThreads.y = src.GetHeader()->numThreads[1];
+    dst->numThreads.z = src.GetHeader()->numThreads[2];
 }
 
 
@@ -401,14 +519,18 @@ XSC_EXPORT int XscCompileShader(
 
     /* Copy output options descriptor */
     out.options.allowExtensions         = (outputDesc->options.allowExtensions != 0);
+    out.options.analyzeReachableOnly    = (outputDesc->options.analyzeReachableOnly != 0);
     out.options.autoBinding             = (outputDesc->options.autoBinding != 0);
     out.options.autoBindingStartSlot    = outputDesc->options.autoBindingStartSlot;
     out.options.explicitBinding         = (outputDesc->options.explicitBinding != 0);
+    out.options.matchBufferLayout       = (outputDesc->options.matchBufferLayout != 0);
     out.options.obfuscate               = (outputDesc->options.obfuscate != 0);
     out.options.optimize                = (outputDesc->options.optimize != 0);
     out.options.preferWrappers          = (outputDesc->options.preferWrappers != 0);
     out.options.preprocessOnly          = (outputDesc->options.preprocessOnly != 0);
     out.options.preserveComments        = (outputDesc->options.preserveComments != 0);
+    out.options.reflectOnly             = (outputDesc->options.reflectOnly != 0);
+    out.options.reorderUniforms         = (outputDesc->options.reorderUniforms != 0);
     out.options.rowMajorAlignment       = (outputDesc->options.rowMajorAlignment != 0);
     out.options.separateShaders         = (outputDesc->options.separateShaders != 0);
     out.options.separateSamplers        = (outputDesc->options.separateSamplers != 0);
@@ -449,6 +571,8 @@ XSC_EXPORT int XscCompileShader(
     /* Compile shader with C++ API */
     bool result = false;
 
+    g_compilerContext.reflection = Xsc::Reflection::ReflectionData();
+
     try
     {
         result = Xsc::CompileShader(
@@ -480,6 +604,40 @@ XSC_EXPORT int XscCompileShader(
     return (result ? 1 : 0);
 }
 
+XSC_EXPORT size_t XscWriteReflection(void* buffer, size_t maxSize)
+{
+    std::stringstream stream;
+    Xsc::WriteReflection(stream, g_compilerContext.reflection);
+
+    const auto data = stream.str();
+    if (buffer != NULL && data.size() <= maxSize)
+        memcpy(buffer, data.data(), data.size());
+
+    return data.size();
+}
+
+XSC_EXPORT int XscReadReflection(const void* data, size_t size, struct XscReflectionData* reflectionData)
+{
+    Xsc::Reflection::ReflectionReader reader;
+    if (reflectionData != NULL && reader.Load(data, size))
+    {
+        CopyBinaryReflection(reader, reflectionData);
+        return 1;
+    }
+    return 0;
+}
+
+XSC_EXPORT size_t XscWriteReflectionJSON(char* str, size_t maxSize)
+{
+    std::stringstream stream;
+    Xsc::PrintReflectionJSON(stream, g_compilerContext.reflection);
+
+    const auto s = stream.str();
+    WriteStringC(s, str, maxSize);
+
+    return (s.size() + 1);
+}
+
 XSC_EXPORT void XscFilterToString(const enum XscFilter t, char* str, size_t maxSize)
 {
     WriteStringC(Xsc::ToString(static_cast<Xsc::Reflection::Filter>(t)), str, maxSize);
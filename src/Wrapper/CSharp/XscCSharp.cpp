@@ -238,12 +238,15 @@ public ref class XscCompiler
         [Flags]
         enum class Extensions : System::UInt32
         {
-            Disabled        = 0,        // No extensions.
+            Disabled                 = 0,        // No extensions.
 
-            LayoutAttribute = (1 << 0), //!< Enables the 'layout' attribute extension (e.g. "[layout(rgba8)]").
-            SpaceAttribute  = (1 << 1), //!< Enables the 'space' attribute extension for a stronger type system (e.g. "[space(OBJECT, MODEL)]").
+            LayoutAttribute          = (1 << 0), //!< Enables the 'layout' attribute extension (e.g. "[layout(rgba8)]").
+            SpaceAttribute           = (1 << 1), //!< Enables the 'space' attribute extension for a stronger type system (e.g. "[space(OBJECT, MODEL)]").
+            ConstantIDAttribute      = (1 << 2), //!< Enables the 'constant_id' attribute extension for Vulkan specialization constants (e.g. "[constant_id(3)]").
+            ReorderMembersAttribute  = (1 << 3), //!< Enables the 'reorder_members' attribute extension for constant buffers (e.g. "[reorder_members] cbuffer Settings { ... };").
+            UpdateFrequencyAttribute = (1 << 4), //!< Enables the 'update_frequency' attribute extension for constant buffers (e.g. "[update_frequency(PerFrame)] cbuffer Camera { ... };").
 
-            All             = (~0u)     //!< All extensions.
+            All                      = (~0u)     //!< All extensions.
         };
 
         /// <summary>Static sampler state descriptor structure (D3D11_SAMPLER_DESC).</summary>
@@ -533,14 +536,18 @@ public ref class XscCompiler
                 OutputOptions()
                 {
                     AllowExtensions         = false;
+                    AnalyzeReachableOnly    = false;
                     AutoBinding             = false;
                     AutoBindingStartSlot    = 0;
                     ExplicitBinding         = false;
+                    MatchBufferLayout       = false;
                     Obfuscate               = false;
                     Optimize                = false;
                     PreferWrappers          = false;
                     PreprocessOnly          = false;
                     PreserveComments        = false;
+                    ReflectOnly             = false;
+                    ReorderUniforms         = false;
                     RowMajorAlignment       = false;
                     SeparateSamplers        = true;
                     SeparateShaders         = false;
@@ -554,6 +561,10 @@ public ref class XscCompiler
                 /// <summary>If true, the shader output may contain GLSL extensions, if the target shader version is too low. By default false.</summary>
                 property bool   AllowExtensions;
 
+                /// <summary>If true, only the functions which are reachable from the entry point(s) are analyzed. By default false.</summary>
+                /// <remarks>This speeds up the compilation of large shader libraries, but no errors or warnings are reported for unreachable functions.</remarks>
+                property bool   AnalyzeReachableOnly;
+
                 /// <summary>If true, binding slots for all buffer types will be generated sequentially, starting with index at 'AutoBindingStartSlot'. By default false.</summary>
                 /// <remarks> This will also enable 'ExplicitBinding'.</remarks>
                 property bool   AutoBinding;
@@ -564,6 +575,10 @@ public ref class XscCompiler
                 /// <summary>If true, explicit binding slots are enabled. By default false.</summary>
                 property bool   ExplicitBinding;
 
+                /// <summary>If true, the members of constant buffers are laid out to match the HLSL packing rules byte by byte (as reported by the reflection). By default false.</summary>
+                /// <remarks>VKSL output uses explicit 'offset' layout qualifiers, and GLSL output uses inserted padding members.</remarks>
+                property bool   MatchBufferLayout;
+
                 /// <summary>If true, code obfuscation is performed. By default false.</summary>
                 property bool   Obfuscate;
 
@@ -579,6 +594,12 @@ public ref class XscCompiler
                 /// <summary>If true, commentaries are preserved for each statement. By default false.</summary>
                 property bool   PreserveComments;
 
+                /// <summary>If true, only the code reflection is performed, i.e. the shader is analyzed, but neither converted nor generated. By default false.</summary>
+                property bool   ReflectOnly;
+
+                /// <summary>If true, the members of the packed uniform buffer and of all constant buffers with the 'reorder_members' attribute are reordered to minimize the buffer size. By default false.</summary>
+                property bool   ReorderUniforms;
+
                 /// <summary>If true, matrices have row-major alignment. Otherwise the matrices have column-major alignment. By default false.</summary>
                 property bool   RowMajorAlignment;
 
@@ -1283,14 +1304,18 @@ bool XscCompiler::CompileShader(ShaderInput^ inputDesc, ShaderOutput^ outputDesc
 
     /* Copy output options descriptor */
     out.options.allowExtensions         = outputDesc->Options->AllowExtensions;
+    out.options.analyzeReachableOnly    = outputDesc->Options->AnalyzeReachableOnly;
     out.options.autoBinding             = outputDesc->Options->AutoBinding;
     out.options.autoBindingStartSlot    = outputDesc->Options->AutoBindingStartSlot;
     out.options.explicitBinding         = outputDesc->Options->ExplicitBinding;
+    out.options.matchBufferLayout       = outputDesc->Options->MatchBufferLayout;
     out.options.obfuscate               = outputDesc->Options->Obfuscate;
     out.options.optimize                = outputDesc->Options->Optimize;
     out.options.preferWrappers          = outputDesc->Options->PreferWrappers;
     out.options.preprocessOnly          = outputDesc->Options->PreprocessOnly;
     out.options.preserveComments        = outputDesc->Options->PreserveComments;
+    out.options.reflectOnly             = outputDesc->Options->ReflectOnly;
+    out.options.reorderUniforms         = outputDesc->Options->ReorderUniforms;
     out.options.rowMajorAlignment       = outputDesc->Options->RowMajorAlignment;
     out.options.separateSamplers        = outputDesc->Options->SeparateSamplers;
     out.options.separateShaders         = outputDesc->Options->SeparateShaders;
@@ -0,0 +1,62 @@
+// Common Subexpression Elimination Test 1
+// 18/10/2026
+
+Texture2D tex : register(t0);
+SamplerState smpl : register(s0);
+
+cbuffer Settings : register(b0)
+{
+    float4 arr[4];
+};
+
+float4 Blur(float2 tc, float2 offset)
+{
+    float4 c = tex.Sample(smpl, tc);
+    c += tex.Sample(smpl, tc + offset);
+    c += tex.Sample(smpl, tc - offset);
+    return c / 3.0;
+}
+
+float4 Shift(float2 tc, float2 offset)
+{
+    // Written parameter is copied, so this sample is not moved out of the inlined function body
+    tc += offset;
+    return tex.Sample(smpl, tc) * tex.Sample(smpl, tc).a;
+}
+
+float4 Lookup(uint idx, float2 v)
+{
+    float4 r = (float4)0;
+    {
+        // Code block is left early by the bounds check, so the array access is not moved before it
+        if (idx >= 4)
+            return r;
+        r.x = sqrt(arr[idx].x*v.x+v.y);
+        r.y = sqrt(arr[idx].x*v.x+v.y)*2.0;
+    }
+    return r;
+}
+
+float4 PS(float2 tc : TEXCOORD, float a : FOG) : SV_Target
+{
+    // Cheap expressions are not moved into temporaries
+    float b = (a == 0.0 ? 1.0 : a + 1.0);
+    float d = a + 1.0;
+
+    // Non-trivial arithmetic is moved into temporaries
+    float e = a * 2.0 + b;
+    float f = a * 2.0 + b;
+
+    // Both inlined functions sample 'tex' at 'tc', which is merged into a single sample
+    float4 c = Blur(tc, float2(0.01, 0.0));
+    c += Blur(tc, float2(0.0, 0.01));
+
+    if (a > 0.5)
+    {
+        c += Shift(tc, float2(a, 0.0));
+    }
+
+    c += Lookup((uint)a, tc);
+
+    return c * (d + e + f);
+}
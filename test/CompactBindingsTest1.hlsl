@@ -0,0 +1,52 @@
+// Descriptor Set Binding Compaction Test
+// 18/10/2026
+
+cbuffer Scene : register(b4, space1)
+{
+    float4x4 viewProjection;
+};
+
+cbuffer Material : register(b7, space2)
+{
+    float4 tint;
+};
+
+cbuffer DrawParams : register(b0)
+{
+    uint   drawIndex;
+    float3 offset;
+};
+
+cbuffer Unused : register(b3)
+{
+    float4 unusedValue;
+};
+
+Texture2D       albedoMap   : register(t5, space2);
+Texture2D       normalMap   : register(t2, space2);
+Texture2D       shadowMap   : register(t9, space1);
+SamplerState    linearSmp   : register(s3, space2);
+SamplerComparisonState shadowSmp : register(ps_5_0, s1, space1);
+
+struct VOut
+{
+    float4 position : SV_Position;
+    float3 normal   : NORMAL;
+    float2 texCoord : TEXCOORD;
+};
+
+VOut VS(float3 position : POSITION, float3 normal : NORMAL, float2 texCoord : TEXCOORD)
+{
+    VOut outp;
+    outp.position   = mul(viewProjection, float4(position + offset * drawIndex, 1));
+    outp.normal     = normal;
+    outp.texCoord   = texCoord;
+    return outp;
+}
+
+float4 PS(VOut inp) : SV_Target
+{
+    float3 n = normalize(inp.normal + normalMap.Sample(linearSmp, inp.texCoord).xyz * 2 - 1);
+    float shadow = shadowMap.SampleCmp(shadowSmp, inp.texCoord, inp.position.z);
+    return albedoMap.Sample(linearSmp, inp.texCoord) * tint * saturate(n.y) * shadow;
+}
@@ -0,0 +1,17 @@
+// Constant Folding Test 1
+// 18/10/2026
+
+cbuffer Settings : register(b0)
+{
+    const float cb = 5.0; // uniform with default value (must not be propagated)
+    float4 v;
+};
+
+const float globalConst = 4.0;          // non-static global constant is a uniform (must not be propagated)
+static const float staticConst = 2.0;   // must be propagated
+
+float4 VS(float4 p : POSITION) : SV_Position
+{
+    const float localConst = 3.0;       // must be propagated
+    return p * staticConst * localConst * globalConst * cb + v;
+}
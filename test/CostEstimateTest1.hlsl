@@ -0,0 +1,63 @@
+// Cost Estimate Test 1
+// 18/10/2026
+
+cbuffer Settings : register(b0)
+{
+    float4x4    wvpMatrix;
+    float3      lightDir;
+    int         numLights;
+    bool        useFog;
+};
+
+Texture2D       colorMap    : register(t0);
+Texture2D       normalMap   : register(t1);
+Buffer<float4>  lightColors : register(t2);
+SamplerState    linearSampler;
+
+struct VOut
+{
+    float4 position : SV_Position;
+    float3 normal   : NORMAL;
+    float2 texCoord : TEXCOORD0;
+    float  fog      : FOG;
+};
+
+VOut VS(float3 position : POSITION, float3 normal : NORMAL, float2 texCoord : TEXCOORD)
+{
+    VOut outp;
+    outp.position   = mul(wvpMatrix, float4(position, 1));
+    outp.normal     = normal;
+    outp.texCoord   = texCoord;
+    outp.fog        = exp(-outp.position.z * 0.1);
+    return outp;
+}
+
+float Shade(float3 normal, float3 dir)
+{
+    return pow(saturate(dot(normal, -dir)), 2.0);
+}
+
+float4 PS(VOut inp) : SV_Target
+{
+    float4 color = colorMap.Sample(linearSampler, inp.texCoord);
+    float3 normal = normalize(inp.normal + normalMap.Sample(linearSampler, inp.texCoord).xyz * 2 - 1);
+
+    // Static loop (constant iteration count)
+    float4 light = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        if (i == 2)
+            light *= 0.5;
+        light += lightColors[i] * Shade(normal, lightDir);
+    }
+
+    // Dynamic loop (iteration count from constant buffer)
+    for (int j = 0; j < numLights; ++j)
+        light += lightColors.Load(j) / (j + 1);
+
+    if (useFog)
+        color.rgb = lerp(color.rgb, (float3)0.5, inp.fog);
+
+    return color * light;
+}
+
@@ -0,0 +1,30 @@
+// Dead Code Elimination Test 1
+// 18/10/2026
+
+// Statements after jump statements are only removed with optimizations (-O)
+
+float4 PS(float4 color : COLOR, int n : TEXCOORD) : SV_Target
+{
+    float4 c = color;
+    float unused = color.r * 2.0;
+    
+    for (int i = 0; i < n; ++i)
+    {
+        c *= 0.5;
+        if (c.r < 0.1)
+        {
+            break;
+            c = 0.0;
+        }
+        continue;
+        c += 1.0;
+    }
+    
+    if (c.a < 0.5)
+    {
+        discard;
+        c.a = 0.0;
+    }
+    
+    return c;
+}
@@ -0,0 +1,7 @@
+// Dependency Test 1 (Header)
+// 18/10/2026
+
+float4 Tint(float4 c)
+{
+    return c * float4(1.0, 0.9, 0.8, 1.0);
+}
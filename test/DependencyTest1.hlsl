@@ -0,0 +1,12 @@
+// Dependency Test 1
+// 18/10/2026
+
+#include "DependencyTest1.h"
+
+Texture2D tex : register(t0);
+SamplerState smpl : register(s0);
+
+float4 PS(float2 tc : TEXCOORD) : SV_Target
+{
+    return Tint(tex.Sample(smpl, tc));
+}
@@ -0,0 +1,23 @@
+// Constant ID attribute extension test
+// 18/10/2026
+
+[constant_id(0)]
+static const int numSamples = 8;
+
+[constant_id(1)]
+static const float radius = 0.25;
+
+static const float scale = 2.0;
+
+Texture2D tex : register(t0);
+SamplerState smpl : register(s0);
+
+float4 main(float2 tc : TEXCOORD) : SV_Target
+{
+    float4 c = 0;
+    
+    for (int i = 0; i < numSamples; ++i)
+        c += tex.Sample(smpl, tc + radius * (float)i * scale);
+    
+    return c / numSamples;
+}
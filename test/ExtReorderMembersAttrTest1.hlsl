@@ -0,0 +1,25 @@
+// Reorder members attribute extension test
+// 18/10/2026
+
+[reorder_members]
+cbuffer Material : register(b0)
+{
+    float   roughness;
+    float3  albedo;
+    float   metallic;
+    float2  uvScale;
+    float3  emissive;
+    float   alpha;
+};
+
+cbuffer Scene : register(b1)
+{
+    float   time;
+    float3  ambient;
+};
+
+float4 main(float2 tc : TEXCOORD) : SV_Target
+{
+    float3 c = albedo * (1 - metallic) + emissive * roughness + ambient * sin(time);
+    return float4(c * tc.xyx * uvScale.xyx, alpha);
+}
@@ -0,0 +1,36 @@
+// Update Frequency Attribute Extension Test
+// 18/10/2026
+
+[update_frequency(PerFrame)]
+cbuffer Camera : register(b0)
+{
+    float4x4 viewProjection;
+    float3   cameraPosition;
+};
+
+[update_frequency(PerObject)]
+cbuffer Object : register(b1)
+{
+    float4x4 world;
+};
+
+[update_frequency(PerFrame)]
+cbuffer Scene : register(b2)
+{
+    float3 sunDirection;
+    float  time;
+};
+
+[update_frequency(PerObject)]
+cbuffer ObjectMaterial : register(b3)
+{
+    float4 tint;
+};
+
+float4 main(float4 position : POSITION, float3 normal : NORMAL, out float4 color : COLOR) : SV_Position
+{
+    float3 worldPos = mul(world, position).xyz;
+    float3 viewDir = normalize(cameraPosition - worldPos);
+    color = tint * saturate(dot(normal, -sunDirection)) * (1 + 0.1 * sin(time)) + float4(viewDir, 0);
+    return mul(viewProjection, float4(worldPos, 1));
+}
@@ -0,0 +1,40 @@
+// Function Inlining Test 1
+// 18/10/2026
+
+Texture2D tex : register(t0);
+SamplerState smpl : register(s0);
+
+float Sq(float x)
+{
+    return x*x;
+}
+
+int Twice(int x)
+{
+    return x*2;
+}
+
+float4 Fetch(Texture2D t, float2 tc)
+{
+    return t.Sample(smpl, tc);
+}
+
+// Empty function: no code must be left at the call site
+void Touch(inout float4 v) {}
+
+// Only 'v' is written, so 'n' is not copied back
+void Scale(inout float4 v, inout float n)
+{
+    v *= n;
+    v.w = 1;
+}
+
+float4 PS(float2 tc : TEXCOORD, float a : FOG) : SV_Target
+{
+    float4 c = Fetch(tex, tc);
+    float n = Sq(a) + Sq(a + 1);
+    int i = Twice((int)n);
+    Touch(c);
+    Scale(c, n);
+    return c * (float)i;
+}
@@ -0,0 +1,53 @@
+// Varying Linker Test
+// 18/10/2026
+
+cbuffer Matrices : register(b0)
+{
+    float4x4 wvpMatrix;
+    float4x4 worldMatrix;
+};
+
+struct VertexIn
+{
+    float3 position : POSITION;
+    float3 normal   : NORMAL;
+    float2 texCoord : TEXCOORD;
+    float4 color    : COLOR;
+};
+
+struct VertexOut
+{
+    float4 position         : SV_Position;
+    float3 normal           : NORMAL;
+    float2 texCoord         : TEXCOORD0;
+    float  fog              : FOG;
+    float4 color            : COLOR;
+    float3 worldPos         : WORLDPOS;
+    nointerpolation int id  : INSTANCEID;
+};
+
+VertexOut VS(VertexIn inp, uint instanceID : SV_InstanceID)
+{
+    VertexOut outp;
+    outp.position = mul(wvpMatrix, float4(inp.position, 1));
+    outp.normal   = normalize(mul((float3x3)worldMatrix, inp.normal));
+    outp.texCoord = inp.texCoord;
+    outp.worldPos = mul(worldMatrix, float4(inp.position, 1)).xyz;
+    outp.fog      = saturate(length(outp.worldPos) * 0.01);
+    outp.color    = inp.color * 2.0;
+    outp.id       = (int)instanceID;
+    return outp;
+}
+
+Texture2D tex : register(t0);
+SamplerState smpl : register(s0);
+
+float4 PS(VertexOut inp) : SV_Target
+{
+    float4 c = tex.Sample(smpl, inp.texCoord);
+    c.rgb *= saturate(dot(inp.normal, float3(0, 0, -1)));
+    c.rgb = lerp(c.rgb, float3(0.5, 0.5, 0.5), inp.fog);
+    if (inp.id > 3)
+        c.a = 0.5;
+    return c;
+}
@@ -0,0 +1,87 @@
+// Loop Unroll Test 1
+// 18/10/2026
+
+cbuffer Settings : register(b0)
+{
+    float4 arr[8];
+};
+
+static const int N = 4;
+
+float4 PS(float4 pos : SV_Position) : SV_Target
+{
+    float4 c = (float4)0;
+
+    // Ascending counter with constant bound is unrolled
+    [unroll]
+    for (int i = 0; i < N; ++i)
+        c += arr[i];
+
+    // Descending counter is unrolled
+    [unroll]
+    for (int j = 3; j >= 0; j--)
+        c.x += arr[j].x * j;
+
+    // Strided counter is unrolled
+    [unroll]
+    for (uint k = 0; k < 8; k += 2)
+    {
+        c.y += arr[k].y;
+    }
+
+    // Explicit iteration count below the trip count keeps the loop rolled
+    [unroll(2)]
+    for (int i2 = 0; i2 < N; ++i2)
+        c.z += arr[i2].z;
+
+    // [loop] attribute keeps the loop rolled
+    [loop]
+    for (int i3 = 0; i3 < N; ++i3)
+        c.w += arr[i3].w;
+
+    // Loop without iterations is removed
+    [unroll]
+    for (int i4 = N; i4 < N; ++i4)
+        c -= arr[i4];
+
+    // Jump statements of the loop keep it rolled
+    [unroll]
+    for (int i5 = 0; i5 < N; ++i5)
+    {
+        if (arr[i5].x > pos.x)
+            break;
+        c += arr[i5];
+    }
+
+    [unroll]
+    for (int i6 = 0; i6 < N; ++i6)
+    {
+        if (arr[i6].y > pos.y)
+            continue;
+        c -= arr[i6];
+    }
+
+    // Written induction variable keeps the loop rolled
+    [unroll]
+    for (int i7 = 0; i7 < N; ++i7)
+    {
+        c *= arr[i7];
+        i7 += (int)pos.z;
+    }
+
+    // More than 256 iterations keep the loop rolled
+    [unroll]
+    for (int i8 = 0; i8 < 300; ++i8)
+        c.x += arr[i8 % 8].x;
+
+    // More than 4096 unrolled statements keep the outer loop rolled (17 * 255 statements), while the inner loop is unrolled
+    [unroll]
+    for (int i9 = 0; i9 < 255; ++i9)
+    {
+        [unroll]
+        for (int j9 = 0; j9 < 17; ++j9)
+            c.y += arr[j9 % 8].y * i9;
+    }
+
+    return c;
+}
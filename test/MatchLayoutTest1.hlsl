@@ -0,0 +1,37 @@
+// Buffer Layout Matching Test
+// 18/10/2026
+
+struct Light
+{
+    float3 direction;
+    float  intensity;
+    float4 color;
+};
+
+cbuffer Transform : register(b0)
+{
+    float4x4 wvpMatrix;
+    float4x3 boneMatrices[2];
+    float3   eyePosition;
+    float    time;
+};
+
+cbuffer Lighting : register(b1)
+{
+    Light  lights[2];
+    float2 uvScale, uvBias;
+    float  exposure;
+};
+
+float4 VS(float4 position : POSITION, uint bone : BLENDINDICES) : SV_Position
+{
+    float3 pos = mul(boneMatrices[bone], position);
+    return mul(wvpMatrix, float4(pos + eyePosition * time, 1));
+}
+
+float4 PS(float2 texCoord : TEXCOORD) : SV_Target
+{
+    float2 uv = texCoord * uvScale + uvBias;
+    float3 c = lights[0].color.rgb * lights[0].intensity + lights[1].color.rgb * lights[1].intensity;
+    return float4(c * exposure, uv.x);
+}
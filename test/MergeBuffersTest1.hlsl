@@ -0,0 +1,52 @@
+// Constant Buffer Merging Test
+// 18/10/2026
+
+cbuffer Material : register(b2)
+{
+    float4 diffuse;
+    float  roughness;
+};
+
+cbuffer Transform : register(b0)
+{
+    float4x4 wvpMatrix;
+    float4x4 worldMatrix;
+};
+
+cbuffer Fog : register(b3)
+{
+    float2 fogRange;
+};
+
+cbuffer Unused : register(b4)
+{
+    float unusedValue;
+};
+
+cbuffer Timing : register(b1)
+{
+    float time;
+};
+
+struct VOut
+{
+    float4 position : SV_Position;
+    float3 normal   : NORMAL;
+    float  depth    : DEPTH;
+};
+
+VOut VS(float4 position : POSITION, float3 normal : NORMAL)
+{
+    VOut outp;
+    outp.position   = mul(wvpMatrix, position);
+    outp.normal     = mul((float3x3)worldMatrix, normal);
+    outp.depth      = outp.position.z;
+    return outp;
+}
+
+float4 PS(VOut inp) : SV_Target
+{
+    float fog = saturate((inp.depth - fogRange.x) / (fogRange.y - fogRange.x));
+    float shade = saturate(dot(normalize(inp.normal), float3(0, 1, 0))) * (1 - roughness);
+    return lerp(diffuse * shade, float4(1, 1, 1, 1), fog) * frac(time);
+}
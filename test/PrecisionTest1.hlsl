@@ -0,0 +1,59 @@
+// ESSL Precision Inference Test
+// 18/10/2026
+
+cbuffer Settings : register(b0)
+{
+    float4x4 wvpMatrix;
+    float3   lightDir;
+    float    timer;
+};
+
+struct VertexIn
+{
+    float4 position : POSITION;
+    float3 normal   : NORMAL;
+    float4 color    : COLOR;
+    float2 texCoord : TEXCOORD;
+};
+
+struct VertexOut
+{
+    float4 position : SV_Position;
+    float3 normal   : NORMAL;
+    float4 color    : COLOR;
+    float2 texCoord : TEXCOORD;
+    half   fog      : FOG;
+};
+
+VertexOut VS(VertexIn i)
+{
+    VertexOut o;
+    o.position  = mul(wvpMatrix, i.position);
+    o.normal    = i.normal;
+    o.color     = i.color;
+    o.texCoord  = i.texCoord;
+    o.fog       = (half)saturate(o.position.z * 0.01);
+    return o;
+}
+
+Texture2D tex : register(t0);
+SamplerState smpl : register(s0);
+
+float4 PS(VertexOut i) : SV_Target
+{
+    // Medium precision (only from medium precision sources)
+    float3 normal = normalize(i.normal);
+    float4 albedo = i.color;
+    albedo.rgb *= 0.5;
+    
+    // High precision (from texture coordinates and uniforms)
+    float2 uv = i.texCoord + timer;
+    float NdotL = saturate(dot(normal, -lightDir));
+    
+    // Default precision (only from literals)
+    float scale = 1.0;
+    for (float t = 0.0; t < 1.0; t += 0.25)
+        scale *= 0.9;
+    
+    return lerp(albedo * tex.Sample(smpl, uv) * NdotL * scale, float4(0.5, 0.5, 0.5, 1.0), i.fog);
+}
@@ -0,0 +1,38 @@
+// Reachability Test 1
+// 18/10/2026
+
+Texture2D tex : register(t0);
+SamplerState smpl : register(s0);
+
+float4 Inner(float2 tc)
+{
+    return tex.Sample(smpl, tc);
+}
+
+float4 Helper(float2 tc)
+{
+    return Inner(tc) * 0.5;
+}
+
+// Functions below are never reached from the entry point, so their errors are not reported with "--reachable-only"
+
+float4 UnusedUndeclared(float2 tc)
+{
+    return undeclaredTexture.Sample(smpl, tc);
+}
+
+float UnusedTypeMismatch(float2 tc)
+{
+    Texture2D t = tc;
+    return t;
+}
+
+float4 UnusedCaller(float2 tc)
+{
+    return UnusedUndeclared(tc) + UnusedTypeMismatch(tc);
+}
+
+float4 PS(float2 tc : TEXCOORD) : SV_Target
+{
+    return Helper(tc);
+}
@@ -0,0 +1,49 @@
+// Register Pressure Test 1
+// 18/10/2026
+
+cbuffer Settings : register(b0)
+{
+    float4x4 wvpMatrix;
+    float3 lightDir;
+    int numLights;
+};
+
+Texture2D tex : register(t0);
+SamplerState smpl : register(s0);
+
+struct VOut
+{
+    float4 position : SV_Position;
+    float3 normal : NORMAL;
+    float2 texCoord : TEXCOORD;
+};
+
+VOut VS(float3 position : POSITION, float3 normal : NORMAL, float2 texCoord : TEXCOORD)
+{
+    VOut outp;
+    outp.position = mul(wvpMatrix, float4(position, 1));
+    outp.normal = normal;
+    outp.texCoord = texCoord;
+    return outp;
+}
+
+float3 Shade(float3 n, float3 color, int i)
+{
+    float3 l = normalize(lightDir + float3(i, 0, 0));
+    float nDotL = saturate(dot(n, l));
+    return color * nDotL;
+}
+
+float4 PS(VOut inp) : SV_Target
+{
+    float3 n = normalize(inp.normal);
+    float4 albedo = tex.Sample(smpl, inp.texCoord);
+    float3 result = (float3)0;
+
+    for (int i = 0; i < numLights; ++i)
+        result += Shade(n, albedo.rgb, i);
+
+    float3 unused = n * 2.0;
+
+    return float4(result, albedo.a);
+}
@@ -0,0 +1,17 @@
+// Register Pressure Test 2
+// 18/10/2026
+
+// Packed uniforms (with --pack-uniforms) are no local variables,
+// so the register pressure is "Max Live Components = 9" with and without packing.
+
+float   time;
+float4x4 wvpMatrix;
+float   scale;
+float3  offset;
+
+float4 VS(float3 position : POSITION) : SV_Position
+{
+    float3 worldPos = position * scale + offset;
+    float3 wave = worldPos + sin(time);
+    return mul(wvpMatrix, float4(wave, 1));
+}
@@ -0,0 +1,41 @@
+// Uniform Reordering Test
+// 18/10/2026
+
+struct Light
+{
+    float3 position;
+    float  radius;
+};
+
+cbuffer Settings : register(b0)
+{
+    float   gamma;
+    float3  tint;
+    float   exposure;
+    float2  jitter;
+    Light   light;
+    float   fogDensity;
+    float3  fogColor;
+};
+
+float   time;
+float4x4 wvpMatrix;
+float   scale;
+float3  offset;
+float2  uvScale, uvBias;
+
+Texture2D tex : register(t0);
+SamplerState smpl : register(s0);
+
+float4 VS(float3 position : POSITION) : SV_Position
+{
+    return mul(wvpMatrix, float4(position * scale + offset + sin(time), 1));
+}
+
+float4 PS(float2 tc : TEXCOORD) : SV_Target
+{
+    float4 c = tex.Sample(smpl, tc * uvScale + uvBias + jitter);
+    c.rgb = pow(c.rgb * tint * exposure, gamma);
+    c.rgb += light.position * light.radius;
+    return float4(lerp(c.rgb, fogColor, fogDensity), c.a);
+}
@@ -0,0 +1,27 @@
+// Vulkan Specialization Constant Test
+// 18/10/2026
+
+static const bool   useFog      = true;
+static const float  fogDensity  = 0.5, gamma = 2.2;
+static const int    numLights   = 4;
+static const uint   unusedID    = 7;
+
+cbuffer Settings : register(b0)
+{
+    float4 color;
+};
+
+float4 main(float4 pos : SV_Position) : SV_Target
+{
+    float4 c = color;
+    
+    if (useFog)
+        c.rgb *= exp(-fogDensity * pos.z);
+    else
+        c.rgb = pow(c.rgb, gamma);
+    
+    for (int i = 0; i < numLights; ++i)
+        c += 0.1;
+    
+    return c;
+}
@@ -0,0 +1,43 @@
+// Uniform Specialization Test
+// 18/10/2026
+
+uniform bool    useFog;
+uniform float   fogDensity, gamma;
+uniform int     numLights;
+
+cbuffer Settings : register(b0)
+{
+    float4  color;
+    float   intensity;
+    bool    invert;
+    float4  tint; // Offset remains unchanged when 'invert' is specialized
+};
+
+cbuffer Flags : register(b1)
+{
+    bool enableAlpha;
+};
+
+float4 main(float4 pos : SV_Position) : SV_Target
+{
+    float4 c = color * intensity;
+    
+    if (useFog)
+        c.rgb *= exp(-fogDensity * pos.z);
+    else
+        c.rgb = pow(c.rgb, gamma);
+    
+    [unroll]
+    for (int i = 0; i < numLights; ++i)
+        c += 0.1;
+    
+    if (invert)
+        c = 1.0 - c;
+    
+    c *= tint;
+    
+    if (enableAlpha && useFog)
+        c.a = 1.0;
+    
+    return c;
+}
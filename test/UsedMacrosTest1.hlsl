@@ -0,0 +1,25 @@
+// Used Macros Test 1
+// 18/10/2026
+
+// Compiled with "-DENABLE_TINT -DUSE_GAMMA -DSCALE=2.0 -DUNUSED_MACRO": All of these macros except UNUSED_MACRO are reported as used macros
+
+#ifdef ENABLE_TINT
+static const float4 tint = float4(1.0, 0.9, 0.8, 1.0);
+#else
+static const float4 tint = (float4)1.0;
+#endif
+
+#if defined(USE_GAMMA) && !defined(USE_LINEAR)
+#   define TO_OUTPUT(c) pow(c, 1.0 / 2.2)
+#else
+#   define TO_OUTPUT(c) (c)
+#endif
+
+Texture2D tex : register(t0);
+SamplerState smpl : register(s0);
+
+float4 PS(float2 tc : TEXCOORD) : SV_Target
+{
+    float4 c = tex.Sample(smpl, tc) * tint;
+    return TO_OUTPUT(c * SCALE);
+}
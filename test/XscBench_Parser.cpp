@@ -0,0 +1,109 @@
+/*
+ * XscBench_Parser.cpp
+ *
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <Xsc/Xsc.h>
+#include "HLSLParser.h"
+#include <iostream>
+#include <sstream>
+#include <chrono>
+#include <string>
+#include <memory>
+
+
+using namespace Xsc;
+
+// Generates an HLSL shader that returns a single expression with the specified number of terms.
+static std::string GenerateExprSource(int numTerms, bool mixedOps)
+{
+    static const char* ops[] = { " + ", " * ", " - ", " / " };
+
+    std::string text = "float4 main(float4 v : COLOR) : SV_Target\n{\n    return v.x";
+
+    for (int i = 1; i < numTerms; ++i)
+    {
+        text += (mixedOps ? ops[i % 4] : ops[0]);
+        text += "v." + std::string(1, "xyzw"[i % 4]) + " * " + std::to_string(i % 100) + ".5";
+    }
+
+    text += ";\n}\n";
+    return text;
+}
+
+// Prints the elapsed time since the specified start time.
+static void PrintElapsedTime(const std::string& name, const std::chrono::high_resolution_clock::time_point& startTime, int iterations)
+{
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto millis = std::chrono::duration<double, std::milli>(endTime - startTime).count() / iterations;
+    std::cout << name << ": " << millis << " ms" << std::endl;
+}
+
+// Parses the specified source several times and prints the average parsing time.
+static void BenchmarkParser(const std::string& name, const std::string& text, int iterations)
+{
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        auto stream = std::make_shared<std::stringstream>(text);
+
+        HLSLParser parser;
+        if (!parser.ParseSource(std::make_shared<SourceCode>(stream), NameMangling(), InputShaderVersion::HLSL5))
+        {
+            std::cerr << name << ": parsing failed" << std::endl;
+            return;
+        }
+    }
+
+    PrintElapsedTime(name + " (parse)", startTime, iterations);
+}
+
+// Compiles the specified source (HLSL to GLSL) several times and prints the average compilation time.
+static void BenchmarkCompiler(const std::string& name, const std::string& text, int iterations, bool optimize)
+{
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        ShaderInput inputDesc;
+        inputDesc.sourceCode    = std::make_shared<std::stringstream>(text);
+        inputDesc.shaderTarget  = ShaderTarget::FragmentShader;
+
+        std::stringstream output;
+        ShaderOutput outputDesc;
+        outputDesc.sourceCode       = &output;
+        outputDesc.options.optimize = optimize;
+
+        if (!CompileShader(inputDesc, outputDesc))
+        {
+            std::cerr << name << ": compilation failed" << std::endl;
+            return;
+        }
+    }
+
+    PrintElapsedTime(name + (optimize ? " (compile optimized)" : " (compile)"), startTime, iterations);
+}
+
+int main()
+{
+    /* Include very long expressions to make sure no compiler stage recurses over the chain of binary expressions */
+    for (int numTerms : { 100, 1000, 10000, 100000 })
+    {
+        for (bool mixedOps : { false, true })
+        {
+            auto name = std::to_string(numTerms) + (mixedOps ? " mixed terms" : " sum terms");
+            auto text = GenerateExprSource(numTerms, mixedOps);
+            BenchmarkParser(name, text, (numTerms < 100000 ? 10 : 1));
+            BenchmarkCompiler(name, text, 1, false);
+            BenchmarkCompiler(name, text, 1, true);
+        }
+    }
+    return 0;
+}
+
+
+
+// ================================================================================
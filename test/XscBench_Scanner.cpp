@@ -0,0 +1,97 @@
+/*
+ * XscBench_Scanner.cpp
+ *
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "HLSLScanner.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <string>
+#include <memory>
+
+
+using namespace Xsc;
+
+// Scans all tokens of the specified source text and returns the number of scanned tokens.
+static std::size_t ScanAllTokens(const std::string& text)
+{
+    auto stream = std::make_shared<std::stringstream>(text);
+    auto source = std::make_shared<SourceCode>(stream);
+
+    HLSLScanner scanner(false);
+    if (!scanner.ScanSource(source))
+        return 0;
+
+    std::size_t numTokens = 0;
+    while (scanner.Next()->Type() != Token::Types::EndOfStream)
+        ++numTokens;
+
+    return numTokens;
+}
+
+// Scans the specified source text several times and prints the throughput.
+static void BenchmarkSource(const std::string& name, const std::string& text, int iterations)
+{
+    std::size_t numTokens = 0;
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < iterations; ++i)
+        numTokens = ScanAllTokens(text);
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+
+    auto seconds    = std::chrono::duration<double>(endTime - startTime).count();
+    auto megaBytes  = static_cast<double>(text.size()) * iterations / (1024.0 * 1024.0);
+
+    std::cout << name << ": " << numTokens << " tokens, " << text.size() << " bytes, ";
+    std::cout << (seconds > 0.0 ? megaBytes / seconds : 0.0) << " MB/s" << std::endl;
+}
+
+// Generates a large HLSL source with a typical mix of comments, identifiers, numbers, and white spaces.
+static std::string GenerateSource(std::size_t numFunctions)
+{
+    std::string text;
+
+    for (std::size_t i = 0; i < numFunctions; ++i)
+    {
+        auto idx = std::to_string(i);
+        text += "// Helper function number " + idx + " with a longer line comment to be skipped by the scanner\n";
+        text += "/* Block comment\n * spanning multiple lines\n */\n";
+        text += "float4 helperFunction" + idx + "(float4 inputPosition : POSITION, uniform float4x4 worldViewProjection)\n{\n";
+        text += "    float4 result = mul(worldViewProjection, inputPosition) * 0.5f + float4(1.0, 2.0e-3, 0x1F, " + idx + ");\n";
+        text += "    if (result.x >= 3.14159265 && result.y != 42)\n        result.zw += inputPosition.xy;\n";
+        text += "    return result;\n}\n\n";
+    }
+
+    return text;
+}
+
+int main(int argc, char* argv[])
+{
+    /* Benchmark generated source */
+    BenchmarkSource("<generated>", GenerateSource(20000), 5);
+
+    /* Benchmark all source files from the command line arguments */
+    for (int i = 1; i < argc; ++i)
+    {
+        std::ifstream file(argv[i]);
+        if (file.good())
+        {
+            std::string text { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+            BenchmarkSource(argv[i], text, 100);
+        }
+        else
+            std::cerr << "failed to read file: " << argv[i] << std::endl;
+    }
+
+    return 0;
+}
+
+
+
+// ================================================================================
@@ -8,6 +8,7 @@
 #include <XscC/XscC.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
 
 
 #define PRINT_FUNC                              \
@@ -100,6 +101,41 @@ void TestCompile()
         puts("*** COMPILATION FAILED ***");
 }
 
+void TestReflectionSerialization()
+{
+    PRINT_FUNC;
+
+    // Write reflection of the previous compilation into binary format
+    size_t size = XscWriteReflection(NULL, 0);
+    void* data = malloc(size);
+    XscWriteReflection(data, size);
+    printf("binary reflection size: %u bytes\n", (unsigned)size);
+
+    // Read reflection from binary format
+    struct XscReflectionData reflect;
+    memset(&reflect, 0, sizeof(reflect));
+
+    if (XscReadReflection(data, size, &reflect))
+    {
+        size_t i;
+        for (i = 0; i < reflect.resourcesCount; ++i)
+            printf("resource: %s ( slot = %d )\n", reflect.resources[i].name, reflect.resources[i].slot);
+        for (i = 0; i < reflect.constantBufferCounts; ++i)
+            printf("constant buffer: %s ( size = %u )\n", reflect.constantBuffers[i].name, reflect.constantBuffers[i].size);
+    }
+    else
+        puts("*** READING BINARY REFLECTION FAILED ***");
+
+    free(data);
+
+    // Print reflection in JSON format
+    size = XscWriteReflectionJSON(NULL, 0);
+    char* json = (char*)malloc(size);
+    XscWriteReflectionJSON(json, size);
+    puts(json);
+    free(json);
+}
+
 int main()
 {
     puts("XscTest1");
@@ -107,6 +143,7 @@ int main()
     TestGLSLExtensions();
     TestShaderTarget();
     TestCompile();
+    TestReflectionSerialization();
 
     return 0;
 }